@@ -0,0 +1,48 @@
+#include "benchmarks.hpp"
+
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+
+namespace game_engine_benchmarks {
+    volatile float benchmarkSink = 0.0f;
+
+    void BenchmarkReport::add(const char *suite, const std::string &name, const double value,
+                              const char *unit) {
+        m_results.push_back(BenchmarkResult{ suite, name, value, unit });
+    }
+
+    void BenchmarkReport::addFailure(const std::string &message) {
+        std::cerr << "Check failed: " << message << std::endl;
+
+        m_failures.push_back(message);
+    }
+
+    bool BenchmarkReport::writeJson(const std::string &path) const {
+        std::ofstream file(path);
+
+        if (!file) {
+            std::cerr << "Can't write benchmark results to " << path << std::endl;
+
+            return false;
+        }
+
+        file << std::setprecision(6);
+        file << "{\n";
+        file << "  \"version\": " << s_formatVersion << ",\n";
+        file << "  \"results\": [\n";
+
+        for (size_t i = 0; i < m_results.size(); ++i) {
+            const BenchmarkResult &result = m_results[i];
+
+            file << "    { \"suite\": \"" << result.suite << "\", \"name\": \"" << result.name
+                 << "\", \"value\": " << result.value << ", \"unit\": \"" << result.unit << "\" }"
+                 << (i + 1 < m_results.size() ? ",\n" : "\n");
+        }
+
+        file << "  ]\n";
+        file << "}\n";
+
+        return static_cast<bool>(file);
+    }
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstddef>
+
+namespace game_engine_benchmarks {
+    struct BenchmarkResult {
+        std::string suite;
+        std::string name;
+        double value = 0.0;
+        std::string unit;
+    };
+
+    class BenchmarkReport {
+    public:
+        static constexpr int s_formatVersion = 1;
+
+        void add(const char *suite, const std::string &name, const double value,
+                 const char *unit);
+        void addFailure(const std::string &message);
+        bool writeJson(const std::string &path) const;
+
+        const std::vector<BenchmarkResult> &getResults() const { return m_results; }
+        const std::vector<std::string> &getFailures() const { return m_failures; }
+
+    private:
+        std::vector<BenchmarkResult> m_results;
+        std::vector<std::string> m_failures;
+    };
+
+    extern volatile float benchmarkSink;
+
+    template<typename Function>
+    double measureNanosecondsPerOperation(const size_t operationsCount, Function function) {
+        function();
+
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < operationsCount; ++i) {
+            function();
+        }
+        const auto finish = std::chrono::steady_clock::now();
+
+        return std::chrono::duration<double, std::nano>(finish - start).count() /
+               static_cast<double>(operationsCount);
+    }
+
+    void runCullingBenchmark(BenchmarkReport &report);
+    void runEcsBenchmark(BenchmarkReport &report);
+    void runJobsBenchmark(BenchmarkReport &report);
+    void runEventsBenchmark(BenchmarkReport &report);
+    void runCameraBenchmark(BenchmarkReport &report);
+    void runRenderingBenchmark(BenchmarkReport &report);
+}
@@ -0,0 +1,67 @@
+#include "benchmarks.hpp"
+
+#include "game_engine_core/camera.hpp"
+
+#include "glm/vec3.hpp"
+#include "glm/mat4x4.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cstddef>
+
+namespace game_engine_benchmarks {
+    using game_engine::Camera;
+
+    constexpr size_t s_cameraOperationsCount = 5000000;
+
+    void printCameraResult(BenchmarkReport &report, const std::string &name,
+                           const double nanosecondsPerCall) {
+        std::cout << std::left << std::setw(32) << name << std::setw(14) << std::fixed
+                  << std::setprecision(2) << nanosecondsPerCall << std::endl;
+
+        report.add("camera", name, nanosecondsPerCall, "ns/call");
+    }
+
+    void runCameraBenchmark(BenchmarkReport &report) {
+        std::cout << std::endl << "Camera" << std::endl;
+        std::cout << std::left << std::setw(32) << "pass" << std::setw(14) << "ns/call"
+                  << std::endl;
+
+        Camera camera(glm::vec3(-5.0f, 0.0f, 0.0f));
+        float accumulator = 0.0f;
+
+        const double cachedNanoseconds = measureNanosecondsPerOperation(
+            s_cameraOperationsCount, [&camera, &accumulator]() {
+                accumulator += camera.getViewMatrix()[3][0];
+            });
+        printCameraResult(report, "getViewMatrix cached", cachedNanoseconds);
+
+        float offset = 0.0f;
+        const double updatedNanoseconds = measureNanosecondsPerOperation(
+            s_cameraOperationsCount, [&camera, &accumulator, &offset]() {
+                offset += 0.001f;
+                camera.setPosition(glm::vec3(-5.0f + offset, 0.0f, 0.0f));
+                accumulator += camera.getViewMatrix()[3][0];
+            });
+        printCameraResult(report, "getViewMatrix after move", updatedNanoseconds);
+
+        const double rotatedNanoseconds = measureNanosecondsPerOperation(
+            s_cameraOperationsCount, [&camera, &accumulator, &offset]() {
+                offset += 0.001f;
+                camera.setRotation(glm::vec3(0.0f, offset, offset));
+                accumulator += camera.getViewProjectionMatrix()[3][0];
+            });
+        printCameraResult(report, "getViewProjection after rotate", rotatedNanoseconds);
+
+        const double movedNanoseconds = measureNanosecondsPerOperation(
+            s_cameraOperationsCount, [&camera, &accumulator]() {
+                camera.addMovementAndRotation(glm::vec3(0.001f, 0.0f, 0.0f),
+                                              glm::vec3(0.0f, 0.0f, 0.01f));
+                accumulator += camera.getViewMatrix()[3][0];
+            });
+        printCameraResult(report, "addMovementAndRotation", movedNanoseconds);
+
+        benchmarkSink = accumulator;
+    }
+}
@@ -0,0 +1,110 @@
+#include "benchmarks.hpp"
+
+#include "game_engine_core/camera.hpp"
+#include "game_engine_core/frustum.hpp"
+#include "game_engine_core/frustum_culling.hpp"
+
+#include "glm/vec3.hpp"
+#include "glm/geometric.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+
+namespace game_engine_benchmarks {
+    using game_engine::CullingBackend;
+    using game_engine::FrustumCuller;
+
+    constexpr size_t s_objectsCounts[] = { 10000, 100000, 1000000 };
+    constexpr size_t s_culledObjectsPerRun = 20000000;
+    constexpr float s_worldExtent = 500.0f;
+
+    FrustumCuller generateObjects(const size_t objectsCount) {
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<float> position(-s_worldExtent, s_worldExtent);
+        std::uniform_real_distribution<float> size(0.5f, 4.0f);
+
+        FrustumCuller culler;
+        culler.reserve(objectsCount);
+
+        for (size_t i = 0; i < objectsCount; ++i) {
+            const glm::vec3 center(position(generator), position(generator), position(generator));
+            const glm::vec3 halfExtents(size(generator), size(generator), size(generator));
+
+            culler.addObject(center, glm::length(halfExtents),
+                             center - halfExtents, center + halfExtents);
+        }
+
+        return culler;
+    }
+
+    template<typename CullFunction>
+    double measureObjectsPerMillisecond(const size_t objectsCount, CullFunction cull) {
+        const size_t iterationsCount = std::max<size_t>(1, s_culledObjectsPerRun / objectsCount);
+
+        cull();
+
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterationsCount; ++i) {
+            cull();
+        }
+        const auto finish = std::chrono::steady_clock::now();
+
+        const double milliseconds =
+            std::chrono::duration<double, std::milli>(finish - start).count();
+
+        return static_cast<double>(objectsCount * iterationsCount) / milliseconds;
+    }
+
+    void runCullingBenchmark(BenchmarkReport &report) {
+        game_engine::Camera camera(glm::vec3(-s_worldExtent, 0.0f, 0.0f));
+        camera.setFarClipPlane(2.0f * s_worldExtent);
+
+        const game_engine::Frustum frustum =
+            game_engine::Frustum::fromMatrix(camera.getViewProjectionMatrix());
+
+        std::cout << "Frustum culling (objects culled per millisecond)" << std::endl;
+        std::cout << std::left << std::setw(10) << "objects" << std::setw(10) << "backend"
+                  << std::setw(10) << "visible" << std::setw(16) << "spheres"
+                  << std::setw(16) << "boxes" << std::endl;
+
+        std::vector<uint32_t> visibleIndices;
+
+        for (const size_t objectsCount : s_objectsCounts) {
+            const FrustumCuller culler = generateObjects(objectsCount);
+
+            for (const CullingBackend backend : { CullingBackend::Scalar, CullingBackend::SSE,
+                                                  CullingBackend::AVX2 }) {
+                if (!FrustumCuller::isBackendSupported(backend)) {
+                    continue;
+                }
+
+                const double spheresRate = measureObjectsPerMillisecond(objectsCount, [&]() {
+                    culler.cullSpheres(frustum, objectsCount, visibleIndices, backend);
+                });
+                const size_t visibleCount = visibleIndices.size();
+
+                const double boxesRate = measureObjectsPerMillisecond(objectsCount, [&]() {
+                    culler.cullBoxes(frustum, objectsCount, visibleIndices, backend);
+                });
+
+                std::cout << std::left << std::setw(10) << objectsCount
+                          << std::setw(10) << FrustumCuller::getBackendName(backend)
+                          << std::setw(10) << visibleCount
+                          << std::setw(16) << std::fixed << std::setprecision(0) << spheresRate
+                          << std::setw(16) << boxesRate << std::endl;
+
+                const std::string resultName = std::to_string(objectsCount) + " " +
+                                               FrustumCuller::getBackendName(backend);
+                report.add("culling", resultName + " spheres", spheresRate, "objects/ms");
+                report.add("culling", resultName + " boxes", boxesRate, "objects/ms");
+            }
+        }
+    }
+}
@@ -0,0 +1,127 @@
+#include "benchmarks.hpp"
+
+#include "game_engine_core/ecs/world.hpp"
+#include "game_engine_core/scene/components.hpp"
+
+#include "glm/vec3.hpp"
+#include "glm/mat4x4.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <vector>
+#include <cstddef>
+
+namespace game_engine_benchmarks {
+    using game_engine::Entity;
+    using game_engine::TransformComponent;
+
+    struct VelocityComponent {
+        glm::vec3 linear{0.0f};
+    };
+
+    constexpr size_t s_ecsEntitiesCount = 1000000;
+    constexpr size_t s_ecsIterationsCount = 20;
+
+    template<typename Function>
+    double measureMilliseconds(Function function) {
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        const auto finish = std::chrono::steady_clock::now();
+
+        return std::chrono::duration<double, std::milli>(finish - start).count();
+    }
+
+    void printEcsResult(BenchmarkReport &report, const char *name, const double milliseconds,
+                        const size_t entitiesCount) {
+        const double nanosecondsPerEntity =
+            milliseconds * 1000000.0 / static_cast<double>(entitiesCount);
+
+        std::cout << std::left << std::setw(32) << name
+                  << std::setw(14) << std::fixed << std::setprecision(3) << milliseconds
+                  << std::setw(14) << std::setprecision(2) << nanosecondsPerEntity
+                  << std::endl;
+
+        report.add("ecs", name, nanosecondsPerEntity, "ns/entity");
+    }
+
+    void runEcsBenchmark(BenchmarkReport &report) {
+        game_engine::World world;
+
+        std::cout << std::endl << "ECS (" << s_ecsEntitiesCount << " entities)" << std::endl;
+        std::cout << std::left << std::setw(32) << "pass" << std::setw(14) << "ms"
+                  << std::setw(14) << "ns/entity" << std::endl;
+
+        const double createMilliseconds = measureMilliseconds([&world]() {
+            for (size_t i = 0; i < s_ecsEntitiesCount; ++i) {
+                TransformComponent transform;
+                transform.position = glm::vec3(static_cast<float>(i % 1000),
+                                               static_cast<float>(i / 1000), 0.0f);
+
+                VelocityComponent velocity;
+                velocity.linear = glm::vec3(1.0f, 0.5f, 0.25f);
+
+                world.createEntity(transform, velocity);
+            }
+        });
+        printEcsResult(report, "create", createMilliseconds, s_ecsEntitiesCount);
+
+        const double integrateMilliseconds = measureMilliseconds([&world]() {
+            for (size_t iteration = 0; iteration < s_ecsIterationsCount; ++iteration) {
+                world.each<TransformComponent, VelocityComponent>(
+                    [](const Entity, TransformComponent &transform,
+                       const VelocityComponent &velocity) {
+                        transform.position += velocity.linear * 0.016f;
+                    });
+            }
+        }) / s_ecsIterationsCount;
+        printEcsResult(report, "each<Transform, Velocity>", integrateMilliseconds,
+                       s_ecsEntitiesCount);
+
+        const double chunkMilliseconds = measureMilliseconds([&world]() {
+            for (size_t iteration = 0; iteration < s_ecsIterationsCount; ++iteration) {
+                world.eachChunk<TransformComponent, VelocityComponent>(
+                    [](const size_t count, const Entity*, TransformComponent *transforms,
+                       const VelocityComponent *velocities) {
+                        for (size_t i = 0; i < count; ++i) {
+                            transforms[i].position += velocities[i].linear * 0.016f;
+                        }
+                    });
+            }
+        }) / s_ecsIterationsCount;
+        printEcsResult(report, "eachChunk<Transform, Velocity>", chunkMilliseconds,
+                       s_ecsEntitiesCount);
+
+        std::vector<glm::mat4> modelMatrices;
+        modelMatrices.reserve(s_ecsEntitiesCount);
+
+        const double matricesMilliseconds = measureMilliseconds([&world, &modelMatrices]() {
+            modelMatrices.clear();
+            world.each<TransformComponent>([&modelMatrices](const Entity,
+                                                            const TransformComponent &transform) {
+                modelMatrices.push_back(transform.getModelMatrix());
+            });
+        });
+        printEcsResult(report, "model matrices", matricesMilliseconds, s_ecsEntitiesCount);
+
+        std::vector<Entity> entities;
+        entities.reserve(s_ecsEntitiesCount);
+        world.each<VelocityComponent>([&entities](const Entity entity, const VelocityComponent&) {
+            entities.push_back(entity);
+        });
+
+        const double removeMilliseconds = measureMilliseconds([&world, &entities]() {
+            for (const Entity entity : entities) {
+                world.removeComponent<VelocityComponent>(entity);
+            }
+        });
+        printEcsResult(report, "remove component", removeMilliseconds, s_ecsEntitiesCount);
+
+        const double destroyMilliseconds = measureMilliseconds([&world, &entities]() {
+            for (const Entity entity : entities) {
+                world.destroyEntity(entity);
+            }
+        });
+        printEcsResult(report, "destroy", destroyMilliseconds, s_ecsEntitiesCount);
+    }
+}
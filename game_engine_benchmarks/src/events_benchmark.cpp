@@ -0,0 +1,87 @@
+#include "benchmarks.hpp"
+
+#include "game_engine_core/event.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <memory>
+#include <string>
+#include <cstddef>
+
+namespace game_engine_benchmarks {
+    using game_engine::EventDispatcher;
+    using game_engine::EventKeyPressed;
+    using game_engine::EventMouseMoved;
+    using game_engine::KeyCode;
+
+    constexpr size_t s_dispatchedEventsCount = 2000000;
+    constexpr size_t s_queuedEventsBatchSize = 1000;
+    constexpr size_t s_queuedEventsBatchesCount = 2000;
+    constexpr size_t s_listenersCounts[] = { 1, 8, 32 };
+
+    void printEventsResult(BenchmarkReport &report, const std::string &name,
+                           const double nanosecondsPerEvent) {
+        std::cout << std::left << std::setw(36) << name << std::setw(14) << std::fixed
+                  << std::setprecision(2) << nanosecondsPerEvent << std::endl;
+
+        report.add("events", name, nanosecondsPerEvent, "ns/event");
+    }
+
+    void runEventsBenchmark(BenchmarkReport &report) {
+        std::cout << std::endl << "Event dispatcher" << std::endl;
+        std::cout << std::left << std::setw(36) << "pass" << std::setw(14) << "ns/event"
+                  << std::endl;
+
+        for (const size_t listenersCount : s_listenersCounts) {
+            auto eventDispatcher = std::make_unique<EventDispatcher>();
+            size_t handledCount = 0;
+
+            for (size_t i = 0; i < listenersCount; ++i) {
+                eventDispatcher->addEventListener<EventKeyPressed>(
+                    [&handledCount](EventKeyPressed &event) {
+                        handledCount += static_cast<size_t>(event.m_keyCode);
+                    });
+            }
+
+            EventKeyPressed event{KeyCode::KEY_W, false};
+
+            const double dispatchNanoseconds = measureNanosecondsPerOperation(
+                s_dispatchedEventsCount, [&eventDispatcher, &event]() {
+                    eventDispatcher->dispatch(event);
+                });
+            printEventsResult(report, "dispatch " + std::to_string(listenersCount) + " listeners",
+                              dispatchNanoseconds);
+
+            const double queuedNanoseconds = measureNanosecondsPerOperation(
+                s_queuedEventsBatchesCount, [&eventDispatcher]() {
+                    for (size_t i = 0; i < s_queuedEventsBatchSize; ++i) {
+                        eventDispatcher->post(EventKeyPressed{KeyCode::KEY_W, false});
+                    }
+
+                    eventDispatcher->dispatchQueued();
+                }) / s_queuedEventsBatchSize;
+            printEventsResult(report, "post+dispatchQueued " + std::to_string(listenersCount) +
+                              " listeners", queuedNanoseconds);
+
+            benchmarkSink = static_cast<float>(handledCount);
+        }
+
+        auto eventDispatcher = std::make_unique<EventDispatcher>();
+        double lastPositionX = 0.0;
+        eventDispatcher->addEventListener<EventMouseMoved>([&lastPositionX](EventMouseMoved &event) {
+            lastPositionX = event.x;
+        });
+
+        const double coalescedNanoseconds = measureNanosecondsPerOperation(
+            s_queuedEventsBatchesCount, [&eventDispatcher]() {
+                for (size_t i = 0; i < s_queuedEventsBatchSize; ++i) {
+                    eventDispatcher->post(EventMouseMoved{static_cast<double>(i), 0.0});
+                }
+
+                eventDispatcher->dispatchQueued();
+            }) / s_queuedEventsBatchSize;
+        printEventsResult(report, "post coalesced mouse moved", coalescedNanoseconds);
+
+        benchmarkSink = static_cast<float>(lastPositionX);
+    }
+}
@@ -0,0 +1,345 @@
+#include "game_engine_core/app.hpp"
+#include "game_engine_core/input_recording.hpp"
+#include "game_engine_core/frame_timer.hpp"
+#include "game_engine_core/frame_stats.hpp"
+#include "game_engine_core/rendering/OpenGL/texture_residency.hpp"
+
+#include "glm/trigonometric.hpp"
+#include "glm/ext/scalar_constants.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <cstring>
+#include <cstdlib>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+
+namespace game_engine_benchmarks {
+    using game_engine::App;
+    using game_engine::BenchmarkRenderMode;
+    using game_engine::FrameTimeStats;
+    using game_engine::FrameTimer;
+    using game_engine::InputRecording;
+    using game_engine::FrameStats;
+    using game_engine::TextureResidency;
+
+    constexpr size_t s_flythroughFramesCount = 1200;
+    constexpr size_t s_flythroughWarmupFramesCount = 60;
+    constexpr double s_flythroughRegressionThreshold = 0.1;
+    constexpr float s_flythroughFarClipPlane = 400.0f;
+    constexpr unsigned int s_flythroughWidth = 1280;
+    constexpr unsigned int s_flythroughHeight = 720;
+    constexpr double s_flythroughTextureBudgetMb = 1.0;
+    constexpr double s_bytesPerMegabyte = 1024.0 * 1024.0;
+
+    struct FlythroughOptions {
+        std::string recordingPath;
+        std::string saveRecordingPath;
+        std::string outputPath = "flythrough_results.json";
+        std::string baselinePath;
+        double regressionThreshold = s_flythroughRegressionThreshold;
+        size_t framesCount = s_flythroughFramesCount;
+        size_t warmupFramesCount = s_flythroughWarmupFramesCount;
+        double textureBudgetMb = s_flythroughTextureBudgetMb;
+        BenchmarkRenderMode renderMode = BenchmarkRenderMode::Instanced;
+        game_engine::WindowBackend backend = game_engine::WindowBackend::HeadlessEGL;
+    };
+
+    struct RenderModeName {
+        const char *name;
+        BenchmarkRenderMode mode;
+    };
+
+    constexpr RenderModeName s_renderModeNames[] = {
+        { "per-object", BenchmarkRenderMode::PerObject },
+        { "instanced", BenchmarkRenderMode::Instanced },
+        { "indirect", BenchmarkRenderMode::MultiDrawIndirect },
+        { "gpu-culled", BenchmarkRenderMode::GpuCulled },
+        { "cpu-culled", BenchmarkRenderMode::CpuCulled }
+    };
+
+    const char *getRenderModeName(const BenchmarkRenderMode mode) {
+        for (const RenderModeName &renderModeName : s_renderModeNames) {
+            if (renderModeName.mode == mode) {
+                return renderModeName.name;
+            }
+        }
+
+        return "unknown";
+    }
+
+    InputRecording generateFlythroughRecording(const size_t framesCount) {
+        InputRecording recording;
+        recording.setTimeStep(1.0 / 60.0);
+
+        for (size_t i = 0; i < framesCount; ++i) {
+            const float t = static_cast<float>(i) / static_cast<float>(framesCount);
+            const float angle = 2.0f * glm::pi<float>() * t;
+
+            const glm::vec3 position(-30.0f + 80.0f * t, 90.0f * std::sin(angle),
+                                     25.0f * std::sin(2.0f * angle));
+            const glm::vec3 rotation(0.0f, 10.0f * std::sin(angle), -35.0f * std::cos(angle));
+
+            recording.addFrame(position, rotation, glm::vec2(0.0f));
+        }
+
+        return recording;
+    }
+
+    class FlythroughApp : public App {
+    public:
+        FlythroughApp(const size_t warmupFramesCount, const size_t textureBudgetBytes)
+            : m_warmupFramesCount{warmupFramesCount}, m_textureBudgetBytes{textureBudgetBytes} {}
+
+        virtual void onUpdate(const double deltaTime) override {
+            if (!m_isVSyncDisabled) {
+                setVSyncMode(game_engine::VSyncMode::Off);
+                TextureResidency::setBudget(m_textureBudgetBytes);
+                m_isVSyncDisabled = true;
+            }
+
+            const game_engine::FrameStatsSample &sample = FrameStats::getLastSample();
+            textureEvictionsCount += sample.get(game_engine::FrameCounter::TextureEvictions);
+            peakResidentTextureBytes = std::max(peakResidentTextureBytes,
+                                                sample.residentTextureBytes);
+
+            if (getInputRecordingMode() == game_engine::InputRecordingMode::Replaying &&
+                getInputReplayFrameIndex() >= m_warmupFramesCount) {
+                frameTimesMs.push_back(static_cast<float>(getFrameTimer().getDeltaTime() * 1000.0));
+            }
+        }
+
+        std::vector<float> frameTimesMs;
+        uint64_t textureEvictionsCount = 0;
+        uint64_t peakResidentTextureBytes = 0;
+
+    private:
+        size_t m_warmupFramesCount = 0;
+        size_t m_textureBudgetBytes = 0;
+        bool m_isVSyncDisabled = false;
+    };
+
+    bool parseFlythroughOptions(const int argc, char **argv, FlythroughOptions &options) {
+        for (int i = 1; i < argc; ++i) {
+            const bool hasValue = i + 1 < argc;
+
+            if (std::strcmp(argv[i], "--recording") == 0 && hasValue) {
+                options.recordingPath = argv[++i];
+            } else if (std::strcmp(argv[i], "--save-recording") == 0 && hasValue) {
+                options.saveRecordingPath = argv[++i];
+            } else if (std::strcmp(argv[i], "--output") == 0 && hasValue) {
+                options.outputPath = argv[++i];
+            } else if (std::strcmp(argv[i], "--baseline") == 0 && hasValue) {
+                options.baselinePath = argv[++i];
+            } else if (std::strcmp(argv[i], "--threshold") == 0 && hasValue) {
+                options.regressionThreshold = std::strtod(argv[++i], nullptr);
+            } else if (std::strcmp(argv[i], "--frames") == 0 && hasValue) {
+                options.framesCount = std::strtoull(argv[++i], nullptr, 10);
+            } else if (std::strcmp(argv[i], "--warmup") == 0 && hasValue) {
+                options.warmupFramesCount = std::strtoull(argv[++i], nullptr, 10);
+            } else if (std::strcmp(argv[i], "--texture-budget") == 0 && hasValue) {
+                options.textureBudgetMb = std::strtod(argv[++i], nullptr);
+            } else if (std::strcmp(argv[i], "--window") == 0) {
+                options.backend = game_engine::WindowBackend::Glfw;
+            } else if (std::strcmp(argv[i], "--mode") == 0 && hasValue) {
+                const char *modeName = argv[++i];
+                bool isKnownMode = false;
+
+                for (const RenderModeName &renderModeName : s_renderModeNames) {
+                    if (std::strcmp(modeName, renderModeName.name) == 0) {
+                        options.renderMode = renderModeName.mode;
+                        isKnownMode = true;
+                    }
+                }
+
+                if (!isKnownMode) {
+                    std::cerr << "Unknown render mode: " << modeName << std::endl;
+
+                    return false;
+                }
+            } else {
+                std::cerr << "Unknown argument: " << argv[i] << std::endl;
+
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool writeFlythroughResults(const std::string &path, const FlythroughOptions &options,
+                                const FlythroughApp &app, const FrameTimeStats &stats) {
+        std::ofstream file(path);
+
+        if (!file) {
+            std::cerr << "Can't write flythrough results to " << path << std::endl;
+
+            return false;
+        }
+
+        file << std::fixed << std::setprecision(4);
+        file << "{\n";
+        file << "  \"recording\": \""
+             << (options.recordingPath.empty() ? "generated" : options.recordingPath) << "\",\n";
+        file << "  \"render_mode\": \"" << getRenderModeName(options.renderMode) << "\",\n";
+        file << "  \"objects\": " << app.benchmarkObjectsCount << ",\n";
+        file << "  \"texture_budget_mb\": " << options.textureBudgetMb << ",\n";
+        file << "  \"peak_resident_texture_mb\": "
+             << app.peakResidentTextureBytes / s_bytesPerMegabyte << ",\n";
+        file << "  \"texture_evictions\": " << app.textureEvictionsCount << ",\n";
+        file << "  \"frames\": " << stats.samplesCount << ",\n";
+        file << "  \"mean_ms\": " << stats.averageMs << ",\n";
+        file << "  \"p50_ms\": " << stats.percentile50Ms << ",\n";
+        file << "  \"p95_ms\": " << stats.percentile95Ms << ",\n";
+        file << "  \"p99_ms\": " << stats.percentile99Ms << ",\n";
+        file << "  \"worst_ms\": " << stats.maximumMs << "\n";
+        file << "}\n";
+
+        return static_cast<bool>(file);
+    }
+
+    bool readFlythroughMetric(const std::string &json, const char *key, double &value) {
+        const std::string quotedKey = std::string("\"") + key + "\"";
+        const size_t keyPosition = json.find(quotedKey);
+
+        if (keyPosition == std::string::npos) {
+            return false;
+        }
+
+        const size_t colonPosition = json.find(':', keyPosition + quotedKey.size());
+
+        if (colonPosition == std::string::npos) {
+            return false;
+        }
+
+        const char *valueBegin = json.c_str() + colonPosition + 1;
+        char *valueEnd = nullptr;
+        value = std::strtod(valueBegin, &valueEnd);
+
+        return valueEnd != valueBegin;
+    }
+
+    int compareFlythroughBaseline(const std::string &path, const double threshold,
+                                  const FrameTimeStats &stats) {
+        std::ifstream file(path);
+
+        if (!file) {
+            std::cerr << "Can't read baseline " << path << std::endl;
+
+            return 2;
+        }
+
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        const std::string json = buffer.str();
+
+        const std::pair<const char*, double> metrics[] = {
+            { "mean_ms", stats.averageMs },
+            { "p50_ms", stats.percentile50Ms },
+            { "p95_ms", stats.percentile95Ms },
+            { "p99_ms", stats.percentile99Ms }
+        };
+
+        bool isRegressed = false;
+
+        std::cout << "Baseline comparison (threshold " << std::fixed << std::setprecision(1)
+                  << threshold * 100.0 << "%)" << std::endl;
+
+        for (const auto &[key, current] : metrics) {
+            double baseline = 0.0;
+
+            if (!readFlythroughMetric(json, key, baseline) || baseline <= 0.0) {
+                std::cerr << "Baseline " << path << " has no valid " << key << std::endl;
+
+                return 2;
+            }
+
+            const double change = current / baseline - 1.0;
+            const bool isMetricRegressed = change > threshold;
+            isRegressed = isRegressed || isMetricRegressed;
+
+            std::cout << std::left << std::setw(10) << key << std::setprecision(3)
+                      << std::setw(12) << baseline << std::setw(12) << current
+                      << std::showpos << std::setprecision(1) << change * 100.0 << "%"
+                      << std::noshowpos << (isMetricRegressed ? "  REGRESSED" : "") << std::endl;
+        }
+
+        return isRegressed ? 1 : 0;
+    }
+
+    int runFlythroughBenchmark(const int argc, char **argv) {
+        FlythroughOptions options;
+
+        if (!parseFlythroughOptions(argc, argv, options)) {
+            return 2;
+        }
+
+        InputRecording recording;
+
+        if (options.recordingPath.empty()) {
+            recording = generateFlythroughRecording(options.framesCount);
+        } else if (!recording.load(options.recordingPath)) {
+            return 2;
+        }
+
+        if (!options.saveRecordingPath.empty()) {
+            recording.save(options.saveRecordingPath);
+        }
+
+        auto app = std::make_unique<FlythroughApp>(options.warmupFramesCount,
+            static_cast<size_t>(options.textureBudgetMb * s_bytesPerMegabyte));
+        app->benchmarkScene = true;
+        app->benchmarkRenderMode = options.renderMode;
+        app->closeOnReplayEnd = true;
+        app->camera.setFarClipPlane(s_flythroughFarClipPlane);
+
+        if (!app->startInputReplay(std::move(recording))) {
+            return 2;
+        }
+
+        if (app->start(s_flythroughWidth, s_flythroughHeight, "GameEngine Flythrough",
+                       options.backend) != 0) {
+            return 2;
+        }
+
+        const FrameTimeStats stats = FrameTimer::calculateFrameTimeStats(app->frameTimesMs);
+
+        std::cout << "Flythrough (" << getRenderModeName(options.renderMode) << ", "
+                  << stats.samplesCount << " frames)" << std::endl;
+        std::cout << std::fixed << std::setprecision(3)
+                  << "mean " << stats.averageMs << " ms, p50 " << stats.percentile50Ms
+                  << " ms, p95 " << stats.percentile95Ms << " ms, p99 " << stats.percentile99Ms
+                  << " ms, worst " << stats.maximumMs << " ms" << std::endl;
+        std::cout << "texture budget " << options.textureBudgetMb << " MB, peak resident "
+                  << app->peakResidentTextureBytes / s_bytesPerMegabyte << " MB, "
+                  << app->textureEvictionsCount << " evictions" << std::endl;
+
+        if (stats.samplesCount == 0) {
+            std::cerr << "No frames were measured" << std::endl;
+
+            return 2;
+        }
+
+        if (!writeFlythroughResults(options.outputPath, options, *app, stats)) {
+            return 2;
+        }
+
+        if (!options.baselinePath.empty()) {
+            return compareFlythroughBaseline(options.baselinePath, options.regressionThreshold,
+                                             stats);
+        }
+
+        return 0;
+    }
+}
+
+int main(int argc, char **argv) {
+    return game_engine_benchmarks::runFlythroughBenchmark(argc, argv);
+}
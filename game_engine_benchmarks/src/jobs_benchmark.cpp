@@ -0,0 +1,103 @@
+#include "benchmarks.hpp"
+
+#include "game_engine_core/jobs/job_system.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <string>
+#include <atomic>
+#include <cmath>
+#include <algorithm>
+#include <cstddef>
+
+namespace game_engine_benchmarks {
+    using game_engine::JobCounter;
+    using game_engine::JobSystem;
+
+    constexpr size_t s_parallelForElementsCount = 4 * 1024 * 1024;
+    constexpr size_t s_parallelForGrainSize = 16 * 1024;
+    constexpr size_t s_smallJobsCount = 200000;
+
+    double measureJobsMilliseconds(void (*function)(std::vector<float>&),
+                                   std::vector<float> &values) {
+        function(values);
+
+        const auto start = std::chrono::steady_clock::now();
+        function(values);
+        const auto finish = std::chrono::steady_clock::now();
+
+        return std::chrono::duration<double, std::milli>(finish - start).count();
+    }
+
+    void runParallelFor(std::vector<float> &values) {
+        JobSystem::parallelFor(values.size(), s_parallelForGrainSize,
+                               [&values](const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                const float x = static_cast<float>(i) * 0.001f;
+                values[i] = std::sqrt(x) * std::sin(x) + std::cos(x * 0.5f);
+            }
+        });
+    }
+
+    void runSmallJobs(std::vector<float> &values) {
+        std::atomic<size_t> executedCount{0};
+        JobCounter counter;
+
+        for (size_t i = 0; i < s_smallJobsCount; ++i) {
+            JobSystem::run([&executedCount]() {
+                executedCount.fetch_add(1, std::memory_order_relaxed);
+            }, &counter);
+        }
+
+        JobSystem::wait(counter);
+        values[0] = static_cast<float>(executedCount.load());
+    }
+
+    void runJobsBenchmark(BenchmarkReport &report) {
+        const size_t hardwareThreadsCount = std::max<size_t>(1, std::thread::hardware_concurrency());
+
+        std::vector<size_t> threadsCounts;
+        for (size_t threadsCount = 1; threadsCount < hardwareThreadsCount; threadsCount *= 2) {
+            threadsCounts.push_back(threadsCount);
+        }
+        threadsCounts.push_back(hardwareThreadsCount);
+
+        std::cout << std::endl << "Job system scaling" << std::endl;
+        std::cout << std::left << std::setw(10) << "threads"
+                  << std::setw(18) << "parallelFor ms" << std::setw(12) << "speedup"
+                  << std::setw(18) << "small jobs ms" << std::setw(12) << "ns/job" << std::endl;
+
+        std::vector<float> values(s_parallelForElementsCount);
+        double singleThreadMilliseconds = 0.0;
+
+        for (const size_t threadsCount : threadsCounts) {
+            JobSystem::initialize(threadsCount);
+
+            const double parallelForMilliseconds = measureJobsMilliseconds(runParallelFor, values);
+            const double smallJobsMilliseconds = measureJobsMilliseconds(runSmallJobs, values);
+
+            JobSystem::shutdown();
+
+            if (threadsCount == 1) {
+                singleThreadMilliseconds = parallelForMilliseconds;
+            }
+
+            std::cout << std::left << std::setw(10) << threadsCount
+                      << std::setw(18) << std::fixed << std::setprecision(3)
+                      << parallelForMilliseconds
+                      << std::setw(12) << std::setprecision(2)
+                      << singleThreadMilliseconds / parallelForMilliseconds
+                      << std::setw(18) << std::setprecision(3) << smallJobsMilliseconds
+                      << std::setw(12) << std::setprecision(1)
+                      << smallJobsMilliseconds * 1000000.0 / s_smallJobsCount << std::endl;
+
+            const std::string threadsName = std::to_string(threadsCount) + " threads";
+            report.add("jobs", "parallelFor " + threadsName, parallelForMilliseconds, "ms");
+            report.add("jobs", "small jobs " + threadsName,
+                       smallJobsMilliseconds * 1000000.0 / s_smallJobsCount, "ns/job");
+        }
+    }
+}
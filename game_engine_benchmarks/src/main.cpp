@@ -0,0 +1,53 @@
+#include "benchmarks.hpp"
+
+#include <iostream>
+#include <string>
+#include <cstring>
+
+namespace game_engine_benchmarks {
+    struct BenchmarkSuite {
+        const char *name;
+        void (*run)(BenchmarkReport &report);
+    };
+
+    constexpr BenchmarkSuite s_benchmarkSuites[] = {
+        { "culling", runCullingBenchmark },
+        { "ecs", runEcsBenchmark },
+        { "jobs", runJobsBenchmark },
+        { "events", runEventsBenchmark },
+        { "camera", runCameraBenchmark },
+        { "rendering", runRenderingBenchmark }
+    };
+}
+
+int main(int argc, char **argv) {
+    std::string jsonPath;
+    std::string filter;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            jsonPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--json path] [--filter suite]" << std::endl;
+
+            return 2;
+        }
+    }
+
+    game_engine_benchmarks::BenchmarkReport report;
+
+    for (const game_engine_benchmarks::BenchmarkSuite &suite :
+         game_engine_benchmarks::s_benchmarkSuites) {
+        if (filter.empty() || filter == suite.name) {
+            suite.run(report);
+        }
+    }
+
+    if (!jsonPath.empty() && !report.writeJson(jsonPath)) {
+        return 1;
+    }
+
+    return report.getFailures().empty() ? 0 : 1;
+}
@@ -0,0 +1,518 @@
+#include "benchmarks.hpp"
+
+#include "game_engine_core/camera.hpp"
+#include "game_engine_core/frustum.hpp"
+#include "game_engine_core/frustum_culling.hpp"
+#include "game_engine_core/rendering/procedural_textures.hpp"
+#include "game_engine_core/rendering/procedural_image.hpp"
+#include "game_engine_core/rendering/texture_compression.hpp"
+#include "game_engine_core/rendering/OpenGL/renderer_OpenGL.hpp"
+#include "game_engine_core/rendering/OpenGL/headless_context_EGL.hpp"
+#include "game_engine_core/rendering/OpenGL/framebuffer.hpp"
+#include "game_engine_core/rendering/OpenGL/shader_program.hpp"
+#include "game_engine_core/rendering/OpenGL/vertex_buffer.hpp"
+#include "game_engine_core/rendering/OpenGL/index_buffer.hpp"
+#include "game_engine_core/rendering/OpenGL/vertex_array.hpp"
+#include "game_engine_core/rendering/OpenGL/texture_2D.hpp"
+#include "game_engine_core/rendering/OpenGL/gpu_culling.hpp"
+
+#include "glm/vec3.hpp"
+#include "glm/mat4x4.hpp"
+#include "glm/geometric.hpp"
+#include "glm/trigonometric.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace game_engine_benchmarks {
+    using game_engine::BufferLayout;
+    using game_engine::ShaderDataType;
+    using game_engine::ShaderProgram;
+    using game_engine::RendererOpenGL;
+    using game_engine::HeadlessContextEGL;
+
+    constexpr size_t s_bufferLayoutsCount = 1000000;
+    constexpr unsigned int s_textureSizes[] = { 256, 1024 };
+    constexpr size_t s_texturesCount = 10;
+    constexpr unsigned int s_cookedTextureSize = 256;
+    constexpr unsigned int s_uploadedTextureSize = 1024;
+
+    struct CookedTextureCheck {
+        game_engine::TextureFormat format;
+        double maxError;
+    };
+
+    constexpr CookedTextureCheck s_cookedTextureChecks[] = {
+        { game_engine::TextureFormat::BC1, 6.0 },
+        { game_engine::TextureFormat::BC3, 6.0 },
+        { game_engine::TextureFormat::BC4, 3.0 },
+        { game_engine::TextureFormat::BC7, 3.0 }
+    };
+    constexpr game_engine::TextureFormat s_uploadedTextureFormats[] = {
+        game_engine::TextureFormat::RGB8,
+        game_engine::TextureFormat::BC1,
+        game_engine::TextureFormat::BC7
+    };
+    constexpr size_t s_uniformUpdatesCount = 1000000;
+    constexpr size_t s_submittedDrawsCount = 20000;
+    constexpr size_t s_submissionFramesCount = 10;
+    constexpr size_t s_gpuCulledObjectsCount = 100000;
+    constexpr size_t s_gpuCullingRunsCount = 20;
+    constexpr float s_gpuCullingWorldExtent = 500.0f;
+    constexpr size_t s_gpuCullingMaxMismatches = 10;
+    constexpr unsigned int s_renderTargetSize = 256;
+
+    const char *benchmarkVertexShader =
+        R"(#version 450
+            layout(location = 0) in vec3 vertex_position;
+
+            uniform mat4 model_matrix;
+            uniform mat4 view_projection_matrix;
+
+            void main() {
+                gl_Position = view_projection_matrix * model_matrix * vec4(vertex_position, 1.0);
+            }
+        )";
+
+    const char *benchmarkFragmentShader =
+        R"(#version 450
+            uniform int current_frame;
+
+            out vec4 frag_color;
+
+            void main() {
+                frag_color = vec4(float(current_frame % 255) / 255.0, 0.5, 0.25, 1.0);
+            }
+        )";
+
+    const float benchmarkCubeVertices[] = {
+        -0.5f, -0.5f, -0.5f,   0.5f, -0.5f, -0.5f,   0.5f,  0.5f, -0.5f,  -0.5f,  0.5f, -0.5f,
+        -0.5f, -0.5f,  0.5f,   0.5f, -0.5f,  0.5f,   0.5f,  0.5f,  0.5f,  -0.5f,  0.5f,  0.5f
+    };
+
+    const uint32_t benchmarkCubeIndices[] = {
+        0, 1, 2, 2, 3, 0,
+        4, 5, 6, 6, 7, 4,
+        0, 1, 5, 5, 4, 0,
+        2, 3, 7, 7, 6, 2,
+        0, 3, 7, 7, 4, 0,
+        1, 2, 6, 6, 5, 1
+    };
+
+    void printRenderingResult(BenchmarkReport &report, const std::string &name,
+                              const double value, const char *unit) {
+        std::cout << std::left << std::setw(36) << name << std::setw(14) << std::fixed
+                  << std::setprecision(2) << value << unit << std::endl;
+
+        report.add("rendering", name, value, unit);
+    }
+
+    std::string getTextureDescription(const game_engine::TextureFormat format,
+                                      const unsigned int size) {
+        return std::string(game_engine::getTextureFormatInfo(format).name) + " " +
+               std::to_string(size) + "x" + std::to_string(size) + " mips";
+    }
+
+    std::vector<unsigned char> generateCookedSource(const unsigned int size) {
+        std::vector<unsigned char> pixels(static_cast<size_t>(size) * size * 4);
+
+        game_engine::ProceduralImage image;
+        image.addNoise(16, 4, 1, game_engine::ImageColor{ 20, 40, 90, 0 },
+                       game_engine::ImageColor{ 230, 200, 120, 255 });
+        image.generate(game_engine::ImageView{ pixels.data(), size, size, 4 });
+
+        return pixels;
+    }
+
+    double calculateCookedTextureError(const std::vector<unsigned char> &sourcePixels,
+                                       const game_engine::TextureContainer &container) {
+        const game_engine::TextureLevel &level = container.getLevel(0);
+        const unsigned int channels =
+            game_engine::getTextureFormatInfo(container.getFormat()).channels;
+
+        std::vector<unsigned char> decodedPixels(sourcePixels.size());
+        if (!game_engine::decodeTextureLevel(level, container.getFormat(),
+                game_engine::ImageView{ decodedPixels.data(), level.width, level.height, 4 })) {
+            return -1.0;
+        }
+
+        double squaredError = 0.0;
+        for (size_t i = 0; i < sourcePixels.size(); ++i) {
+            if (i % 4 < channels) {
+                const double delta = static_cast<double>(sourcePixels[i]) - decodedPixels[i];
+                squaredError += delta * delta;
+            }
+        }
+
+        return std::sqrt(squaredError / (sourcePixels.size() / 4 * channels));
+    }
+
+    void runCpuRenderingBenchmark(BenchmarkReport &report) {
+        size_t strideSum = 0;
+
+        const double layoutNanoseconds = measureNanosecondsPerOperation(
+            s_bufferLayoutsCount, [&strideSum]() {
+                const BufferLayout layout{
+                    ShaderDataType::Float3,
+                    ShaderDataType::Float3,
+                    ShaderDataType::Float2
+                };
+
+                strideSum += layout.getStride();
+            });
+        printRenderingResult(report, "BufferLayout vec3/vec3/vec2", layoutNanoseconds, "ns");
+
+        const double instanceLayoutNanoseconds = measureNanosecondsPerOperation(
+            s_bufferLayoutsCount, [&strideSum]() {
+                const BufferLayout layout{
+                    { ShaderDataType::Mat4, 1 }
+                };
+
+                strideSum += layout.getStride();
+            });
+        printRenderingResult(report, "BufferLayout instanced mat4", instanceLayoutNanoseconds,
+                             "ns");
+
+        for (const unsigned int size : s_textureSizes) {
+            std::vector<unsigned char> pixels(static_cast<size_t>(size) * size * 3);
+
+            const double textureNanoseconds = measureNanosecondsPerOperation(
+                s_texturesCount, [&pixels, size]() {
+                    game_engine::generateSmileTexture(pixels.data(), size, size);
+                });
+            printRenderingResult(report, "generateSmileTexture " + std::to_string(size) + "x" +
+                                 std::to_string(size), textureNanoseconds / 1000000.0, "ms");
+
+            strideSum += pixels[pixels.size() / 2];
+
+            game_engine::ProceduralImage noiseImage;
+            noiseImage.addNoise(32, 4, 1, game_engine::ImageColor{ 0, 0, 0 },
+                                game_engine::ImageColor{ 255, 255, 255 });
+
+            const double noiseNanoseconds = measureNanosecondsPerOperation(
+                s_texturesCount, [&pixels, &noiseImage, size]() {
+                    noiseImage.generate(game_engine::ImageView{ pixels.data(), size, size, 3 });
+                });
+            printRenderingResult(report, "ProceduralImage noise " + std::to_string(size) + "x" +
+                                 std::to_string(size), noiseNanoseconds / 1000000.0, "ms");
+        }
+
+        std::vector<unsigned char> cookedPixels = generateCookedSource(s_cookedTextureSize);
+
+        for (const CookedTextureCheck &check : s_cookedTextureChecks) {
+            game_engine::TextureContainer container;
+
+            const double cookNanoseconds = measureNanosecondsPerOperation(
+                s_texturesCount, [&cookedPixels, &container, &check]() {
+                    game_engine::cookTexture(game_engine::ImageView{ cookedPixels.data(),
+                                                                     s_cookedTextureSize,
+                                                                     s_cookedTextureSize, 4 },
+                                             check.format, true, container);
+                });
+            printRenderingResult(report, "cookTexture " +
+                                 getTextureDescription(check.format, s_cookedTextureSize),
+                                 cookNanoseconds / 1000000.0, "ms");
+
+            const double error = calculateCookedTextureError(cookedPixels, container);
+            printRenderingResult(report, std::string("cookTexture ") +
+                                 game_engine::getTextureFormatInfo(check.format).name +
+                                 " round-trip error", error, "rmse");
+
+            if (error < 0.0 || error > check.maxError) {
+                report.addFailure(getTextureDescription(check.format, s_cookedTextureSize) +
+                                  " round-trip error " + std::to_string(error) +
+                                  " exceeds " + std::to_string(check.maxError));
+            }
+
+            strideSum += container.getDataSize();
+        }
+
+        benchmarkSink = static_cast<float>(strideSum);
+    }
+
+    void runTextureUploadBenchmark(BenchmarkReport &report) {
+        std::vector<unsigned char> sourcePixels = generateCookedSource(s_uploadedTextureSize);
+        const std::string path =
+            (std::filesystem::temp_directory_path() / "game_engine_benchmark.gtex").string();
+
+        for (const game_engine::TextureFormat format : s_uploadedTextureFormats) {
+            const std::string description = getTextureDescription(format, s_uploadedTextureSize);
+
+            if (!game_engine::Texture2D::isFormatSupported(format)) {
+                std::cout << "Texture upload " << description << " skipped: format is unsupported"
+                          << std::endl;
+
+                continue;
+            }
+
+            game_engine::TextureContainer cookedContainer;
+            if (!game_engine::cookTexture(game_engine::ImageView{ sourcePixels.data(),
+                                                                  s_uploadedTextureSize,
+                                                                  s_uploadedTextureSize, 4 },
+                                          format, true, cookedContainer) ||
+                !cookedContainer.save(path)) {
+                report.addFailure("can't cook " + description + " to " + path);
+
+                continue;
+            }
+
+            game_engine::TextureContainer container;
+            bool isLoaded = true;
+
+            const double loadNanoseconds = measureNanosecondsPerOperation(
+                s_texturesCount, [&container, &path, &isLoaded]() {
+                    isLoaded = container.load(path) && isLoaded;
+                });
+
+            if (!isLoaded) {
+                report.addFailure("can't load " + description + " from " + path);
+
+                continue;
+            }
+
+            size_t memorySize = 0;
+
+            const double uploadNanoseconds = measureNanosecondsPerOperation(
+                s_texturesCount, [&container, &memorySize]() {
+                    const game_engine::Texture2D texture(container);
+                    RendererOpenGL::finish();
+
+                    memorySize = texture.getMemorySize();
+                });
+
+            printRenderingResult(report, "texture load " + description,
+                                 loadNanoseconds / 1000000.0, "ms");
+            printRenderingResult(report, "texture upload " + description,
+                                 uploadNanoseconds / 1000000.0, "ms");
+            printRenderingResult(report, "texture memory " + description,
+                                 static_cast<double>(memorySize) / (1024.0 * 1024.0), "MB");
+        }
+
+        std::error_code error;
+        std::filesystem::remove(path, error);
+    }
+
+    void runGpuRenderingBenchmark(BenchmarkReport &report) {
+        const game_engine::Framebuffer framebuffer(s_renderTargetSize, s_renderTargetSize);
+
+        if (!framebuffer.isComplete()) {
+            std::cout << "Draw submission skipped: offscreen framebuffer is incomplete"
+                      << std::endl;
+
+            return;
+        }
+
+        const ShaderProgram shaderProgram(benchmarkVertexShader, benchmarkFragmentShader);
+
+        if (!shaderProgram.isCompiled()) {
+            std::cout << "Draw submission skipped: shader compilation failed" << std::endl;
+
+            return;
+        }
+
+        const int modelMatrixLocation = shaderProgram.getUniformLocation("model_matrix");
+        const int currentFrameLocation = shaderProgram.getUniformLocation("current_frame");
+
+        game_engine::Camera camera(glm::vec3(-50.0f, 0.0f, 0.0f));
+        camera.setViewportSize(static_cast<float>(s_renderTargetSize),
+                               static_cast<float>(s_renderTargetSize));
+
+        glm::mat4 modelMatrix(1.0f);
+        int frame = 0;
+
+        const double matrixByNameNanoseconds = measureNanosecondsPerOperation(
+            s_uniformUpdatesCount, [&shaderProgram, &modelMatrix]() {
+                shaderProgram.setMatrix_4("model_matrix", modelMatrix);
+            });
+        printRenderingResult(report, "setMatrix_4 by name", matrixByNameNanoseconds, "ns");
+
+        const double matrixByLocationNanoseconds = measureNanosecondsPerOperation(
+            s_uniformUpdatesCount, [&shaderProgram, &modelMatrix, modelMatrixLocation]() {
+                shaderProgram.setMatrix_4(modelMatrixLocation, modelMatrix);
+            });
+        printRenderingResult(report, "setMatrix_4 by location", matrixByLocationNanoseconds,
+                             "ns");
+
+        const double intByNameNanoseconds = measureNanosecondsPerOperation(
+            s_uniformUpdatesCount, [&shaderProgram, &frame]() {
+                shaderProgram.setInt("current_frame", ++frame);
+            });
+        printRenderingResult(report, "setInt by name", intByNameNanoseconds, "ns");
+
+        const double intByLocationNanoseconds = measureNanosecondsPerOperation(
+            s_uniformUpdatesCount, [&shaderProgram, &frame, currentFrameLocation]() {
+                shaderProgram.setInt(currentFrameLocation, ++frame);
+            });
+        printRenderingResult(report, "setInt by location", intByLocationNanoseconds, "ns");
+
+        const game_engine::VertexBuffer vertexBuffer(benchmarkCubeVertices,
+                                                     sizeof(benchmarkCubeVertices),
+                                                     BufferLayout{ ShaderDataType::Float3 });
+        const game_engine::IndexBuffer indexBuffer(benchmarkCubeIndices,
+                                                   sizeof(benchmarkCubeIndices) /
+                                                   sizeof(uint32_t));
+
+        game_engine::VertexArray vertexArray;
+        vertexArray.addVertexBuffer(vertexBuffer);
+        vertexArray.setIndexBuffer(indexBuffer);
+
+        std::vector<glm::mat4> modelMatrices;
+        modelMatrices.reserve(s_submittedDrawsCount);
+
+        for (size_t i = 0; i < s_submittedDrawsCount; ++i) {
+            modelMatrices.emplace_back(1, 0, 0, 0,
+                                       0, 1, 0, 0,
+                                       0, 0, 1, 0,
+                                       static_cast<float>(i % 20) * 2.0f,
+                                       static_cast<float>((i / 20) % 40) - 20.0f,
+                                       static_cast<float>(i / 800) - 12.0f, 1);
+        }
+
+        framebuffer.bind();
+        shaderProgram.bind();
+        shaderProgram.setMatrix_4("view_projection_matrix", camera.getViewProjectionMatrix());
+        RendererOpenGL::setClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+
+        double submitMilliseconds = 0.0;
+        double frameMilliseconds = 0.0;
+
+        for (size_t i = 0; i <= s_submissionFramesCount; ++i) {
+            const auto start = std::chrono::steady_clock::now();
+
+            RendererOpenGL::clear();
+            shaderProgram.setInt(currentFrameLocation, static_cast<int>(i));
+
+            for (const glm::mat4 &matrix : modelMatrices) {
+                shaderProgram.setMatrix_4(modelMatrixLocation, matrix);
+                RendererOpenGL::draw(vertexArray);
+            }
+
+            const auto submitted = std::chrono::steady_clock::now();
+            RendererOpenGL::finish();
+            const auto finished = std::chrono::steady_clock::now();
+
+            if (i > 0) {
+                submitMilliseconds +=
+                    std::chrono::duration<double, std::milli>(submitted - start).count();
+                frameMilliseconds +=
+                    std::chrono::duration<double, std::milli>(finished - start).count();
+            }
+        }
+
+        game_engine::Framebuffer::unbind();
+
+        printRenderingResult(report, "draw submission per draw",
+                             submitMilliseconds * 1000000.0 /
+                             (s_submittedDrawsCount * s_submissionFramesCount), "ns");
+        printRenderingResult(report, "draw frame " + std::to_string(s_submittedDrawsCount) +
+                             " draws", frameMilliseconds / s_submissionFramesCount, "ms");
+    }
+
+    void runGpuCullingBenchmark(BenchmarkReport &report) {
+        game_engine::GpuCulling gpuCulling(s_gpuCulledObjectsCount);
+
+        if (!gpuCulling.isValid()) {
+            std::cout << "GPU culling skipped: compute shader is unavailable" << std::endl;
+
+            return;
+        }
+
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<float> position(-s_gpuCullingWorldExtent,
+                                                       s_gpuCullingWorldExtent);
+        std::uniform_real_distribution<float> size(0.5f, 4.0f);
+
+        game_engine::FrustumCuller culler;
+        culler.reserve(s_gpuCulledObjectsCount);
+        std::vector<game_engine::GpuCullingObject> objects(s_gpuCulledObjectsCount);
+
+        for (game_engine::GpuCullingObject &object : objects) {
+            const glm::vec3 center(position(generator), position(generator), position(generator));
+            const glm::vec3 halfExtents(size(generator), size(generator), size(generator));
+            const float radius = glm::length(halfExtents);
+
+            culler.addObject(center, radius, center - halfExtents, center + halfExtents);
+
+            object.boundingSphere = glm::vec4(0.0f, 0.0f, 0.0f, radius);
+            object.modelMatrix = glm::mat4(1, 0, 0, 0,
+                                           0, 1, 0, 0,
+                                           0, 0, 1, 0,
+                                           center.x, center.y, center.z, 1);
+            object.firstIndex = 0;
+            object.indicesCount = 36;
+            object.baseVertex = 0;
+            object.materialIndex = 0;
+        }
+
+        gpuCulling.setObjects(objects);
+
+        const float focalLength = 1.0f / std::tan(glm::radians(30.0f));
+        const float nearPlane = 1.0f;
+        const float farPlane = 2.0f * s_gpuCullingWorldExtent;
+        const float depthScale = (farPlane + nearPlane) / (nearPlane - farPlane);
+        const float depthOffset = 2.0f * farPlane * nearPlane / (nearPlane - farPlane);
+        const glm::mat4 viewProjection(focalLength, 0, 0, 0,
+                                       0, focalLength, 0, 0,
+                                       0, 0, depthScale, -1,
+                                       0, 0, depthOffset, 0);
+        const game_engine::Frustum frustum = game_engine::Frustum::fromMatrix(viewProjection);
+
+        std::vector<uint32_t> visibleIndices;
+        const size_t cpuVisibleCount = culler.cullSpheres(frustum, s_gpuCulledObjectsCount,
+                                                          visibleIndices);
+
+        gpuCulling.cull(frustum, s_gpuCulledObjectsCount);
+        const size_t gpuVisibleCount = gpuCulling.readVisibleCount();
+
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < s_gpuCullingRunsCount; ++i) {
+            gpuCulling.cull(frustum, s_gpuCulledObjectsCount);
+        }
+        RendererOpenGL::finish();
+        const auto finish = std::chrono::steady_clock::now();
+
+        const std::string description = "GPU culling " + std::to_string(s_gpuCulledObjectsCount);
+        printRenderingResult(report, description, std::chrono::duration<double, std::milli>(
+            finish - start).count() / s_gpuCullingRunsCount, "ms");
+        printRenderingResult(report, description + " visible",
+                             static_cast<double>(gpuVisibleCount), "objects");
+
+        const size_t mismatchesCount = gpuVisibleCount > cpuVisibleCount ?
+            gpuVisibleCount - cpuVisibleCount : cpuVisibleCount - gpuVisibleCount;
+
+        if (mismatchesCount > s_gpuCullingMaxMismatches) {
+            report.addFailure(description + " found " + std::to_string(gpuVisibleCount) +
+                              " visible objects, the CPU culler found " +
+                              std::to_string(cpuVisibleCount));
+        }
+    }
+
+    void runRenderingBenchmark(BenchmarkReport &report) {
+        std::cout << std::endl << "Rendering" << std::endl;
+        std::cout << std::left << std::setw(36) << "pass" << std::setw(14) << "time" << std::endl;
+
+        runCpuRenderingBenchmark(report);
+
+        if (!HeadlessContextEGL::create()) {
+            std::cout << "Draw submission skipped: headless context is unavailable" << std::endl;
+
+            return;
+        }
+
+        if (RendererOpenGL::init(HeadlessContextEGL::getProcAddress)) {
+            runGpuRenderingBenchmark(report);
+            runGpuCullingBenchmark(report);
+            runTextureUploadBenchmark(report);
+        }
+
+        HeadlessContextEGL::destroy();
+    }
+}
@@ -2,10 +2,26 @@
 
 #include "game_engine_core/event.hpp"
 #include "game_engine_core/camera.hpp"
+#include "game_engine_core/ecs/world.hpp"
+#include "game_engine_core/frame_timer.hpp"
+#include "game_engine_core/frame_limiter.hpp"
+#include "game_engine_core/window_backend.hpp"
+#include "game_engine_core/input_recording.hpp"
 
 #include <memory>
+#include <string>
+#include <atomic>
+#include <cstdint>
 
 namespace game_engine {
+    enum class BenchmarkRenderMode {
+        PerObject = 0,
+        Instanced,
+        MultiDrawIndirect,
+        GpuCulled,
+        CpuCulled
+    };
+
     class App {
     public:
         App();
@@ -17,10 +33,12 @@ namespace game_engine {
         App &operator=(App&&) = delete;
 
         virtual int start(unsigned int window_width, unsigned int window_height,
-                          const char *title);
+                          const char *title,
+                          const WindowBackend backend = WindowBackend::Glfw);
         void close();
 
-        virtual void onUpdate() {}
+        virtual void onUpdate(const double deltaTime) {}
+        virtual void onFixedUpdate(const double fixedDeltaTime) {}
         virtual void onUIDraw() {}
 
         virtual void onMouseButtonEvent(const MouseButton buttonCode,
@@ -30,6 +48,27 @@ namespace game_engine {
         
         glm::vec2 getCurrentCursorPosition() const;
 
+        const FrameTimer &getFrameTimer() const { return m_frameTimer; }
+        FrameLimiter &getFrameLimiter() { return m_frameLimiter; }
+        float getInterpolationAlpha() const { return m_interpolationAlpha; }
+
+        void setVSyncMode(const VSyncMode mode);
+        VSyncMode getVSyncMode() const;
+
+        void requestRedraw();
+        bool isBenchmarkRenderModeSupported(const BenchmarkRenderMode mode) const;
+        uint64_t getRenderedFramesCount() const { return m_renderedFramesCount; }
+        uint64_t getSkippedFramesCount() const { return m_skippedFramesCount; }
+
+        bool startInputRecording();
+        bool stopInputRecording(const std::string &path);
+        bool startInputReplay(const std::string &path);
+        bool startInputReplay(InputRecording recording);
+        void stopInputReplay();
+        InputRecordingMode getInputRecordingMode() const { return m_inputRecordingMode; }
+        const InputRecording &getInputRecording() const { return m_inputRecording; }
+        size_t getInputReplayFrameIndex() const { return m_inputReplayFrameIndex; }
+
         float cameraPosition[3] = { 0.0f, 0.0f, 1.0f };
         float cameraRotation[3] = { 0.0f, 0.0f, 0.0f };
         float cameraFov = 60.0f;
@@ -38,12 +77,67 @@ namespace game_engine {
         bool perspectiveCamera = true;
         Camera camera{glm::vec3{-5.0f, 0.0f, 0.0f}};
 
+        static constexpr int s_benchmarkMaxObjectsCount = 100000;
+        bool benchmarkScene = false;
+        BenchmarkRenderMode benchmarkRenderMode = BenchmarkRenderMode::Instanced;
+        int benchmarkObjectsCount = s_benchmarkMaxObjectsCount;
+
+        World scene;
+
+        bool useRenderThread = false;
+
+        static constexpr double s_maxFrameDeltaTime = 0.25;
+        double fixedTimeStep = 1.0 / 60.0;
+
+        static constexpr double s_idleWaitTimeout = 0.5;
+        static constexpr int s_idleSettleFramesCount = 3;
+        bool idleRendering = false;
+        double idleAnimationFrameRate = 0.0;
+
+        bool showPerformanceOverlay = false;
+
+        uint64_t maxFramesCount = 0;
+
+        static constexpr int s_inputRecordingListenerPriority = 1000;
+        bool closeOnReplayEnd = false;
+
     private:
         void draw();
+        void runFixedUpdates(const double deltaTime);
+        void processEvents();
+        bool isRedrawNeeded();
+        double getIdleWaitTimeout() const;
+        void beginInputFrame();
+        void endInputFrame();
+        void renderFrame(struct FrameData &frame);
+        void submitMesh(FrameData &frame, const glm::mat4 &modelMatrix,
+                        const struct MeshComponent &mesh);
+        void submitBenchmarkScene(FrameData &frame);
+        void drawBenchmarkSceneIndirect(const FrameData &frame);
+        void drawBenchmarkSceneGpuCulled(const FrameData &frame);
 
         std::unique_ptr<class Window> m_window;
 
         EventDispatcher m_eventDispatcher;
         bool m_isCloseWindow = false;
+
+        FrameTimer m_frameTimer;
+        FrameLimiter m_frameLimiter;
+        double m_fixedTimeAccumulator = 0.0;
+        double m_updateDeltaTime = 0.0;
+        float m_interpolationAlpha = 1.0f;
+
+        std::atomic<bool> m_isRedrawRequested{true};
+        int m_pendingRedrawFramesCount = s_idleSettleFramesCount;
+        uint64_t m_lastSceneVersion = 0;
+        glm::mat4 m_lastViewProjectionMatrix{0.0f};
+        FrameTimer::Clock::time_point m_lastAnimationTickTime;
+        uint64_t m_renderedFramesCount = 0;
+        uint64_t m_skippedFramesCount = 0;
+
+        InputRecording m_inputRecording;
+        InputRecordingMode m_inputRecordingMode = InputRecordingMode::None;
+        size_t m_inputReplayFrameIndex = 0;
+        glm::vec2 m_replayCursorPosition{0.0f};
     };
 }
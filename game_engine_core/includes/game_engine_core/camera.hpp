@@ -26,6 +26,7 @@ namespace game_engine {
 
         const glm::mat4 &getViewMatrix();
         const glm::mat4 &getProjectionMatrix() const { return m_projectionMatrix; }
+        const glm::mat4 &getViewProjectionMatrix();
 
         const float getFarClipPlane() const { return m_farClipPlane; }
         const float getNearClipPlane() const { return m_nearClipPlane; }
@@ -50,6 +51,7 @@ namespace game_engine {
 
         glm::mat4 m_viewMatrix;
         glm::mat4 m_projectionMatrix;
+        glm::mat4 m_viewProjectionMatrix;
 
         bool m_updateViewMatrix = false;
 
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "game_engine_core/ecs/entity.hpp"
+#include "game_engine_core/ecs/component.hpp"
+
+#include <array>
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+
+namespace game_engine {
+    constexpr size_t s_chunkSize = 16 * 1024;
+
+    struct alignas(64) ChunkStorage {
+        std::byte data[s_chunkSize];
+    };
+
+    struct Chunk {
+        std::unique_ptr<ChunkStorage> storage;
+        size_t count = 0;
+    };
+
+    struct EntityLocation {
+        uint32_t chunkIndex = 0;
+        uint32_t row = 0;
+    };
+
+    class Archetype {
+    public:
+        explicit Archetype(const ComponentMask &mask);
+
+        Archetype(const Archetype&) = delete;
+        Archetype &operator=(const Archetype&) = delete;
+
+        const ComponentMask &getMask() const { return m_mask; }
+        const std::vector<ComponentTypeId> &getComponentTypeIds() const { return m_componentTypeIds; }
+        size_t getChunkCapacity() const { return m_chunkCapacity; }
+        size_t getChunksCount() const { return m_chunks.size(); }
+        size_t getEntitiesCount() const { return m_entitiesCount; }
+        bool hasComponent(const ComponentTypeId id) const {
+            return isValidComponentTypeId(id) && m_mask.test(id);
+        }
+
+        Chunk &getChunk(const size_t index) { return m_chunks[index]; }
+
+        Entity *getEntities(Chunk &chunk) const {
+            return reinterpret_cast<Entity*>(chunk.storage->data);
+        }
+
+        void *getComponentData(Chunk &chunk, const ComponentTypeId id) const {
+            return chunk.storage->data + m_offsets[id];
+        }
+
+        void *getComponentData(const EntityLocation &location, const ComponentTypeId id) {
+            return static_cast<std::byte*>(getComponentData(m_chunks[location.chunkIndex], id)) +
+                   location.row * ComponentRegistry::getTypeInfo(id).size;
+        }
+
+        template<typename T>
+        T *getComponents(Chunk &chunk) const {
+            return static_cast<T*>(getComponentData(chunk, getComponentTypeId<T>()));
+        }
+
+        EntityLocation allocate(const Entity entity);
+        Entity remove(const EntityLocation &location);
+        void clear();
+
+    private:
+        ComponentMask m_mask;
+        std::vector<ComponentTypeId> m_componentTypeIds;
+        std::array<size_t, s_maxComponentTypesCount> m_offsets{};
+        size_t m_chunkCapacity = 0;
+        size_t m_entitiesCount = 0;
+        std::vector<Chunk> m_chunks;
+    };
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <bitset>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+namespace game_engine {
+    using ComponentTypeId = uint32_t;
+
+    // A process can register at most s_maxComponentTypesCount component types. Any type past the
+    // limit gets s_invalidComponentTypeId, and World and EntityCommandBuffer reject operations on it.
+    constexpr size_t s_maxComponentTypesCount = 64;
+    constexpr ComponentTypeId s_invalidComponentTypeId = 0xFFFFFFFF;
+
+    using ComponentMask = std::bitset<s_maxComponentTypesCount>;
+
+    struct ComponentTypeInfo {
+        size_t size = 0;
+        size_t alignment = 0;
+    };
+
+    class ComponentRegistry {
+    public:
+        static ComponentTypeId registerType(const size_t size, const size_t alignment);
+        static const ComponentTypeInfo &getTypeInfo(const ComponentTypeId id);
+        static size_t getTypesCount();
+    };
+
+    template<typename T>
+    ComponentTypeId getComponentTypeId() {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "Components are relocated with memcpy and must be trivially copyable");
+
+        static const ComponentTypeId id = ComponentRegistry::registerType(sizeof(T), alignof(T));
+
+        return id;
+    }
+
+    inline bool isValidComponentTypeId(const ComponentTypeId id) {
+        return id < s_maxComponentTypesCount;
+    }
+
+    template<typename... Ts>
+    bool areComponentTypesValid() {
+        return (isValidComponentTypeId(getComponentTypeId<Ts>()) && ...);
+    }
+
+    template<typename... Ts>
+    ComponentMask makeComponentMask() {
+        ComponentMask mask;
+        const auto setComponent = [&mask](const ComponentTypeId id) {
+            if (isValidComponentTypeId(id)) {
+                mask.set(id);
+            }
+        };
+        (setComponent(getComponentTypeId<Ts>()), ...);
+
+        return mask;
+    }
+}
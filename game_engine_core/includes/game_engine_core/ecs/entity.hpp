@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdint>
+
+namespace game_engine {
+    struct Entity {
+        static constexpr uint32_t s_invalidIndex = 0xFFFFFFFF;
+
+        uint32_t index = s_invalidIndex;
+        uint32_t generation = 0;
+
+        bool isValid() const { return index != s_invalidIndex; }
+
+        bool operator==(const Entity &other) const {
+            return index == other.index && generation == other.generation;
+        }
+
+        bool operator!=(const Entity &other) const { return !(*this == other); }
+    };
+}
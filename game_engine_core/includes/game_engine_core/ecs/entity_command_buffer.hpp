@@ -0,0 +1,77 @@
+#pragma once
+
+#include "game_engine_core/ecs/world.hpp"
+
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+namespace game_engine {
+    enum class EntityCommandType : uint8_t {
+        CreateEntity,
+        SetCreatedComponent,
+        DestroyEntity,
+        AddComponent,
+        RemoveComponent
+    };
+
+    struct EntityCommand {
+        EntityCommandType type = EntityCommandType::CreateEntity;
+        ComponentTypeId componentTypeId = s_invalidComponentTypeId;
+        Entity entity;
+        uint32_t payloadOffset = 0;
+    };
+
+    class EntityCommandBuffer {
+    public:
+        template<typename... Ts>
+        void createEntity(const Ts &...components) {
+            if (!areComponentTypesValid<Ts...>()) {
+                return;
+            }
+
+            m_commands.push_back(EntityCommand{ EntityCommandType::CreateEntity,
+                                                s_invalidComponentTypeId, Entity{}, 0 });
+            (recordComponent(EntityCommandType::SetCreatedComponent, Entity{}, components), ...);
+        }
+
+        void destroyEntity(const Entity entity);
+
+        template<typename T>
+        void addComponent(const Entity entity, const T &component = T{}) {
+            if (areComponentTypesValid<T>()) {
+                recordComponent(EntityCommandType::AddComponent, entity, component);
+            }
+        }
+
+        template<typename T>
+        void removeComponent(const Entity entity) {
+            if (areComponentTypesValid<T>()) {
+                m_commands.push_back(EntityCommand{ EntityCommandType::RemoveComponent,
+                                                    getComponentTypeId<T>(), entity, 0 });
+            }
+        }
+
+        void execute(World &world);
+
+        bool isEmpty() const { return m_commands.empty(); }
+        size_t getCommandsCount() const { return m_commands.size(); }
+
+    private:
+        template<typename T>
+        void recordComponent(const EntityCommandType type, const Entity entity, const T &component) {
+            const size_t payloadOffset = m_payload.size();
+            m_payload.resize(payloadOffset + sizeof(T));
+            std::memcpy(m_payload.data() + payloadOffset, &component, sizeof(T));
+
+            m_commands.push_back(EntityCommand{ type, getComponentTypeId<T>(), entity,
+                                                static_cast<uint32_t>(payloadOffset) });
+        }
+
+        void copyPayload(void *data, const EntityCommand &command) const;
+
+        std::vector<EntityCommand> m_commands;
+        std::vector<std::byte> m_payload;
+    };
+}
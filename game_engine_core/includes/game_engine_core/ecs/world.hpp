@@ -0,0 +1,135 @@
+#pragma once
+
+#include "game_engine_core/ecs/entity.hpp"
+#include "game_engine_core/ecs/component.hpp"
+#include "game_engine_core/ecs/archetype.hpp"
+
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <cstdint>
+#include <cstddef>
+
+namespace game_engine {
+    class World {
+    public:
+        World();
+        ~World();
+
+        World(const World&) = delete;
+        World &operator=(const World&) = delete;
+
+        Entity createEntity();
+        Entity createEntity(const ComponentMask &mask);
+
+        template<typename... Ts>
+        Entity createEntity(const Ts &...components) {
+            if (!areComponentTypesValid<Ts...>()) {
+                return Entity{};
+            }
+
+            const Entity entity = createEntity(makeComponentMask<Ts...>());
+
+            if (entity.isValid()) {
+                ((*static_cast<Ts*>(getComponentData(entity, getComponentTypeId<Ts>())) =
+                    components), ...);
+            }
+
+            return entity;
+        }
+
+        bool destroyEntity(const Entity entity);
+        bool isAlive(const Entity entity) const;
+        void clear();
+
+        template<typename T>
+        T *addComponent(const Entity entity, const T &component = T{}) {
+            T *data = static_cast<T*>(addComponentData(entity, getComponentTypeId<T>()));
+
+            if (data != nullptr) {
+                *data = component;
+            }
+
+            return data;
+        }
+
+        template<typename T>
+        bool removeComponent(const Entity entity) {
+            return removeComponentData(entity, getComponentTypeId<T>());
+        }
+
+        template<typename T>
+        bool hasComponent(const Entity entity) const {
+            return isAlive(entity) &&
+                   m_records[entity.index].archetype->hasComponent(getComponentTypeId<T>());
+        }
+
+        template<typename T>
+        T *getComponent(const Entity entity) {
+            return static_cast<T*>(getComponentData(entity, getComponentTypeId<T>()));
+        }
+
+        template<typename... Ts, typename Function>
+        void eachChunk(Function &&function) {
+            if (!areComponentTypesValid<Ts...>()) {
+                return;
+            }
+
+            const ComponentMask mask = makeComponentMask<Ts...>();
+
+            ++m_iterationDepth;
+            for (const std::unique_ptr<Archetype> &archetype : m_archetypes) {
+                if ((archetype->getMask() & mask) != mask) {
+                    continue;
+                }
+
+                for (size_t i = 0; i < archetype->getChunksCount(); ++i) {
+                    Chunk &chunk = archetype->getChunk(i);
+                    function(chunk.count, archetype->getEntities(chunk),
+                             archetype->template getComponents<Ts>(chunk)...);
+                }
+            }
+            --m_iterationDepth;
+        }
+
+        template<typename... Ts, typename Function>
+        void each(Function &&function) {
+            eachChunk<Ts...>([&function](const size_t count, const Entity *entities,
+                                         Ts *...components) {
+                for (size_t i = 0; i < count; ++i) {
+                    function(entities[i], components[i]...);
+                }
+            });
+        }
+
+        size_t getEntitiesCount() const { return m_entitiesCount; }
+        size_t getArchetypesCount() const { return m_archetypes.size(); }
+        uint64_t getStructuralVersion() const { return m_structuralVersion; }
+
+    private:
+        friend class EntityCommandBuffer;
+
+        struct EntityRecord {
+            Archetype *archetype = nullptr;
+            EntityLocation location;
+            uint32_t generation = 0;
+        };
+
+        void *getComponentData(const Entity entity, const ComponentTypeId id);
+        void *addComponentData(const Entity entity, const ComponentTypeId id);
+        bool removeComponentData(const Entity entity, const ComponentTypeId id);
+
+        Archetype *getOrCreateArchetype(const ComponentMask &mask);
+        void moveEntity(const Entity entity, Archetype &targetArchetype);
+        void removeFromArchetype(Archetype &archetype, const EntityLocation &location);
+        bool isStructuralChangeAllowed() const;
+
+        std::vector<EntityRecord> m_records;
+        std::vector<uint32_t> m_freeIndices;
+        std::vector<std::unique_ptr<Archetype>> m_archetypes;
+        std::unordered_map<ComponentMask, Archetype*> m_archetypesByMask;
+        size_t m_entitiesCount = 0;
+        uint64_t m_structuralVersion = 0;
+        int m_iterationDepth = 0;
+    };
+}
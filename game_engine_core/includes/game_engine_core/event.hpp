@@ -3,7 +3,14 @@
 #include "game_engine_core/keys.hpp"
 
 #include <functional>
+#include <algorithm>
+#include <type_traits>
+#include <new>
 #include <array>
+#include <tuple>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
 
 namespace game_engine {
     enum class EventType {
@@ -20,134 +27,292 @@ namespace game_engine {
         EventsCount
     };
 
-    struct BaseEvent {
-        virtual ~BaseEvent() = default;
-        virtual EventType getType() const = 0;
-    };
-
-    class EventDispatcher {
-    public:
-        template<typename EventType>
-        void addEventListener(std::function<void(EventType&)> callback) {
-            auto baseCallback = [function = std::move(callback)](BaseEvent &event) {
-                if (event.getType() == EventType::type) {
-                    function(static_cast<EventType&>(event));
-                }
-            };
-
-            m_eventCallbacks[static_cast<size_t>(EventType::type)] = std::move(baseCallback);
-        }
-
-        void dispatch(BaseEvent &event) {
-            auto &callback = m_eventCallbacks[static_cast<size_t>(event.getType())];
-
-            if (callback) {
-                callback(event);
-            }
-        }
-
-    private:
-        std::array<std::function<void(BaseEvent&)>, static_cast<size_t>(EventType::EventsCount)> m_eventCallbacks;
-    };
-
-    struct EventMouseMoved : public BaseEvent {
+    struct EventMouseMoved {
         double x;
         double y;
 
-        static const EventType type = EventType::MouseMoved;
+        static constexpr EventType type = EventType::MouseMoved;
+        static constexpr bool coalesced = true;
 
         EventMouseMoved(const double newX, const double newY)
             : x{newX}, y{newY} {
 
         }
-
-        virtual EventType getType() const override {
-            return type;
-        }
     };
 
-    struct EventWindowResize : public BaseEvent {
+    struct EventWindowResize {
         int width;
         int height;
 
-        static const EventType type = EventType::WindowResize;
+        static constexpr EventType type = EventType::WindowResize;
+        static constexpr bool coalesced = true;
 
         EventWindowResize(const int newWidth, const int newHeight)
             : width{newWidth}, height{newHeight} {
-            
-        }
 
-        virtual EventType getType() const override {
-            return type;
         }
     };
 
-    struct EventWindowClose : public BaseEvent {
-        static const EventType type = EventType::WindowClose;
-        
-        virtual EventType getType() const override {
-            return type;
-        }
+    struct EventWindowClose {
+        static constexpr EventType type = EventType::WindowClose;
+        static constexpr bool coalesced = true;
     };
 
-    struct EventKeyPressed : public BaseEvent {
+    struct EventKeyPressed {
         KeyCode m_keyCode;
         bool m_repeated;
 
-        static const EventType type = EventType::KeyPressed;
+        static constexpr EventType type = EventType::KeyPressed;
+        static constexpr bool coalesced = false;
 
         EventKeyPressed(const KeyCode keyCode, const bool repeated)
             : m_keyCode{keyCode}, m_repeated{repeated} {}
-        
-        virtual EventType getType() const override {
-            return type;
-        }
     };
 
-    struct EventKeyReleased : public BaseEvent {
+    struct EventKeyReleased {
         KeyCode m_keyCode;
 
-        static const EventType type = EventType::KeyReleased;
+        static constexpr EventType type = EventType::KeyReleased;
+        static constexpr bool coalesced = false;
 
         EventKeyReleased(const KeyCode keyCode)
             : m_keyCode{keyCode} {}
-        
-        virtual EventType getType() const override {
-            return type;
-        }
     };
 
-    struct EventMouseButtonPressed : public BaseEvent {
+    struct EventMouseButtonPressed {
         MouseButton m_mouseButton;
 
         double m_positionX;
         double m_positionY;
 
-        static const EventType type = EventType::MouseButtonPressed;
+        static constexpr EventType type = EventType::MouseButtonPressed;
+        static constexpr bool coalesced = false;
 
         EventMouseButtonPressed(const MouseButton mouseButton,
                                 const double positionX, const double positionY)
             : m_mouseButton{mouseButton}, m_positionX{positionX}, m_positionY{positionY} {}
-
-        virtual EventType getType() const override {
-            return type;
-        }
     };
 
-    struct EventMouseButtonReleased : public BaseEvent {
+    struct EventMouseButtonReleased {
         MouseButton m_mouseButton;
 
         double m_positionX;
         double m_positionY;
 
-        static const EventType type = EventType::MouseButtonReleased;
+        static constexpr EventType type = EventType::MouseButtonReleased;
+        static constexpr bool coalesced = false;
 
         EventMouseButtonReleased(const MouseButton mouseButton,
                                  const double positionX, const double positionY)
             : m_mouseButton{mouseButton}, m_positionX(positionX) , m_positionY(positionY) {}
+    };
+
+    struct EventListenerHandle {
+        EventType type = EventType::EventsCount;
+        uint32_t id = 0;
+
+        bool isValid() const { return id != 0; }
+    };
+
+    template<typename T>
+    struct EventListener {
+        uint32_t id = 0;
+        int priority = 0;
+        std::function<void(T&)> callback;
+    };
+
+    template<typename... Ts>
+    struct EventTypesList {
+        using ListenersTuple = std::tuple<std::vector<EventListener<Ts>>...>;
+    };
+
+    using EngineEvents = EventTypesList<EventWindowResize, EventWindowClose,
+                                        EventKeyPressed, EventKeyReleased,
+                                        EventMouseButtonPressed, EventMouseButtonReleased,
+                                        EventMouseMoved>;
+
+    class EventDispatcher {
+    public:
+        static constexpr size_t s_queueArenaSize = 64 * 1024;
+
+        EventDispatcher();
+
+        EventDispatcher(const EventDispatcher&) = delete;
+        EventDispatcher &operator=(const EventDispatcher&) = delete;
+
+        template<typename T>
+        EventListenerHandle addEventListener(std::function<void(T&)> callback,
+                                             const int priority = 0) {
+            EventListener<T> listener{ ++m_lastListenerId, priority, std::move(callback) };
+
+            if (m_dispatchDepth > 0) {
+                std::get<std::vector<EventListener<T>>>(m_pendingListeners)
+                    .push_back(std::move(listener));
+            } else {
+                insertListener(std::get<std::vector<EventListener<T>>>(m_listeners),
+                               std::move(listener));
+            }
 
-        virtual EventType getType() const override {
-            return type;
+            return EventListenerHandle{ T::type, m_lastListenerId };
         }
+
+        bool removeEventListener(const EventListenerHandle handle) {
+            const bool removed = std::apply([this, &handle](auto &...listeners) {
+                return (removeListener(listeners, handle) || ...);
+            }, m_listeners);
+
+            return removed || std::apply([this, &handle](auto &...listeners) {
+                return (removeListener(listeners, handle) || ...);
+            }, m_pendingListeners);
+        }
+
+        template<typename T>
+        void dispatch(T &event) {
+            std::vector<EventListener<T>> &listeners =
+                std::get<std::vector<EventListener<T>>>(m_listeners);
+
+            ++m_dispatchDepth;
+            for (size_t i = 0; i < listeners.size(); ++i) {
+                if (listeners[i].id != 0) {
+                    listeners[i].callback(event);
+                }
+            }
+            --m_dispatchDepth;
+
+            if (m_dispatchDepth == 0) {
+                applyPendingChanges();
+            }
+        }
+
+        template<typename T>
+        void post(const T &event) {
+            static_assert(std::is_trivially_copyable_v<T>, "Queued events must be trivially copyable");
+
+            const size_t typeIndex = static_cast<size_t>(T::type);
+
+            if constexpr (T::coalesced) {
+                if (m_coalescedOffsets[typeIndex] != s_invalidOffset) {
+                    getQueuedHeader(m_coalescedOffsets[typeIndex]).type = EventType::EventsCount;
+                    --m_queuedEventsCount;
+                    ++m_coalescedEventsCount;
+                }
+            }
+
+            const size_t offset = allocateQueued(sizeof(T));
+            getQueuedHeader(offset).type = T::type;
+            new (getQueuedPayload(offset)) T(event);
+            ++m_queuedEventsCount;
+
+            if constexpr (T::coalesced) {
+                m_coalescedOffsets[typeIndex] = offset;
+            }
+        }
+
+        void dispatchQueued();
+
+        size_t getQueuedEventsCount() const { return m_queuedEventsCount; }
+        size_t getCoalescedEventsCount() const { return m_coalescedEventsCount; }
+
+    private:
+        struct QueuedEventHeader {
+            EventType type;
+            uint32_t size;
+        };
+
+        static constexpr size_t s_invalidOffset = static_cast<size_t>(-1);
+        static constexpr size_t s_queueAlignment = alignof(std::max_align_t);
+
+        template<typename T>
+        static void insertListener(std::vector<EventListener<T>> &listeners,
+                                   EventListener<T> &&listener) {
+            const auto position = std::upper_bound(listeners.begin(), listeners.end(),
+                listener.priority, [](const int priority, const EventListener<T> &other) {
+                    return priority > other.priority;
+                });
+
+            listeners.insert(position, std::move(listener));
+        }
+
+        template<typename T>
+        bool removeListener(std::vector<EventListener<T>> &listeners,
+                            const EventListenerHandle &handle) {
+            if (handle.type != T::type || !handle.isValid()) {
+                return false;
+            }
+
+            for (EventListener<T> &listener : listeners) {
+                if (listener.id == handle.id) {
+                    listener.id = 0;
+                    m_hasRemovedListeners = true;
+
+                    if (m_dispatchDepth == 0) {
+                        applyPendingChanges();
+                    }
+
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        void applyPendingChanges() {
+            if (m_hasRemovedListeners) {
+                std::apply([](auto &...listeners) {
+                    (listeners.erase(std::remove_if(listeners.begin(), listeners.end(),
+                        [](const auto &listener) { return listener.id == 0; }),
+                        listeners.end()), ...);
+                }, m_listeners);
+
+                m_hasRemovedListeners = false;
+            }
+
+            std::apply([this](auto &...pendingListeners) {
+                (mergePendingListeners(pendingListeners), ...);
+            }, m_pendingListeners);
+        }
+
+        template<typename T>
+        void mergePendingListeners(std::vector<EventListener<T>> &pendingListeners) {
+            for (EventListener<T> &listener : pendingListeners) {
+                if (listener.id != 0) {
+                    insertListener(std::get<std::vector<EventListener<T>>>(m_listeners),
+                                   std::move(listener));
+                }
+            }
+
+            pendingListeners.clear();
+        }
+
+        template<typename T, typename... Ts>
+        void dispatchQueuedEvent(const EventType type, void *payload) {
+            if (type == T::type) {
+                T event = *static_cast<const T*>(payload);
+                dispatch(event);
+            } else if constexpr (sizeof...(Ts) > 0) {
+                dispatchQueuedEvent<Ts...>(type, payload);
+            }
+        }
+
+        template<typename... Ts>
+        void dispatchQueuedEvent(EventTypesList<Ts...>, const EventType type, void *payload) {
+            dispatchQueuedEvent<Ts...>(type, payload);
+        }
+
+        size_t allocateQueued(const size_t payloadSize);
+        QueuedEventHeader &getQueuedHeader(const size_t offset);
+        void *getQueuedPayload(const size_t offset);
+
+        EngineEvents::ListenersTuple m_listeners;
+        EngineEvents::ListenersTuple m_pendingListeners;
+        uint32_t m_lastListenerId = 0;
+        int m_dispatchDepth = 0;
+        bool m_hasRemovedListeners = false;
+
+        std::vector<std::byte> m_queueArena;
+        size_t m_queueArenaOffset = 0;
+        size_t m_queuedEventsCount = 0;
+        size_t m_coalescedEventsCount = 0;
+        std::array<size_t, static_cast<size_t>(EventType::EventsCount)> m_coalescedOffsets;
     };
 }
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <chrono>
+
+namespace game_engine {
+    enum class VSyncMode {
+        Off = 0,
+        On,
+        Adaptive
+    };
+
+    class FrameLimiter {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        void setTargetFrameRate(const double framesPerSecond);
+        double getTargetFrameRate() const { return m_targetFrameRate; }
+
+        void setSpinThreshold(const double seconds);
+        double getSpinThreshold() const;
+
+        void wait();
+
+    private:
+        double m_targetFrameRate = 0.0;
+        Clock::duration m_framePeriod{};
+        Clock::duration m_spinThreshold = std::chrono::milliseconds(2);
+        Clock::time_point m_nextFrameTime;
+        bool m_hasDeadline = false;
+    };
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "game_engine_core/profiler.hpp"
+
+#include <array>
+#include <atomic>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace game_engine {
+    enum class FrameCounter : uint8_t {
+        DrawCalls = 0,
+        Triangles,
+        StateChanges,
+        UploadedBytes,
+        Allocations,
+        TextureEvictions,
+
+        CountersCount
+    };
+
+    struct FrameStatsSample {
+        uint64_t frameIndex = 0;
+        double frameTimeMs = 0.0;
+        std::array<uint64_t, static_cast<size_t>(FrameCounter::CountersCount)> counters{};
+        uint64_t textureMemoryBytes = 0;
+        uint64_t residentTextureBytes = 0;
+
+        uint64_t get(const FrameCounter counter) const {
+            return counters[static_cast<size_t>(counter)];
+        }
+    };
+
+    struct FrameStatsSpike {
+        uint64_t frameIndex = 0;
+        double frameTimeMs = 0.0;
+        double budgetMs = 0.0;
+        std::vector<FrameStatsSample> frames;
+        std::vector<ProfileStageStats> stages;
+    };
+
+    class FrameStats {
+    public:
+        static constexpr size_t s_historySize = 256;
+        static constexpr size_t s_spikeFramesCount = 64;
+        static constexpr size_t s_maxSpikesCount = 8;
+
+        static void add(const FrameCounter counter, const uint64_t value = 1) {
+            s_counters[static_cast<size_t>(counter)].fetch_add(value, std::memory_order_relaxed);
+        }
+
+        static void addTextureMemory(const int64_t bytes) {
+            s_textureMemoryBytes.fetch_add(bytes, std::memory_order_relaxed);
+        }
+
+        static void setResidentTextureBytes(const uint64_t bytes) {
+            s_residentTextureBytes.store(bytes, std::memory_order_relaxed);
+        }
+
+        static uint64_t getTextureMemoryBytes();
+
+        static void endFrame(const uint64_t frameIndex, const double frameTimeMs);
+
+        static size_t getHistoryCount();
+        static const FrameStatsSample &getSample(const size_t index);
+        static const FrameStatsSample &getLastSample();
+        static void copyFrameTimes(std::vector<float> &frameTimes);
+
+        static void setFrameBudget(const double budgetMs);
+        static double getFrameBudget();
+        static const std::vector<FrameStatsSpike> &getSpikes();
+        static void clearSpikes();
+
+    private:
+        static std::array<std::atomic<uint64_t>, static_cast<size_t>(FrameCounter::CountersCount)> s_counters;
+        static std::atomic<int64_t> s_textureMemoryBytes;
+        static std::atomic<uint64_t> s_residentTextureBytes;
+    };
+}
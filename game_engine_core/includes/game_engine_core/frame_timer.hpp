@@ -0,0 +1,53 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace game_engine {
+    struct FrameTimeStats {
+        double averageMs = 0.0;
+        double minimumMs = 0.0;
+        double maximumMs = 0.0;
+        double percentile50Ms = 0.0;
+        double percentile95Ms = 0.0;
+        double percentile99Ms = 0.0;
+        size_t samplesCount = 0;
+    };
+
+    class FrameTimer {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        static constexpr size_t s_historySize = 512;
+
+        FrameTimer();
+
+        void reset();
+        double tick();
+        void discardElapsedTime();
+
+        double getDeltaTime() const { return m_deltaTime; }
+        double getTotalTime() const;
+        uint64_t getFrameIndex() const { return m_frameIndex; }
+
+        double getFrameTimePercentile(const double percentile) const;
+        FrameTimeStats getFrameTimeStats() const;
+
+        static FrameTimeStats calculateFrameTimeStats(std::vector<float> &frameTimesMs);
+
+    private:
+        size_t copySortedHistory(std::array<float, s_historySize> &sortedHistory) const;
+
+        Clock::time_point m_startTime;
+        Clock::time_point m_lastTime;
+        double m_deltaTime = 0.0;
+        uint64_t m_frameIndex = 0;
+
+        std::array<float, s_historySize> m_history{};
+        size_t m_historyHead = 0;
+        size_t m_historyCount = 0;
+    };
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "glm/vec3.hpp"
+#include "glm/vec4.hpp"
+#include "glm/ext/matrix_float4x4.hpp"
+
+#include <array>
+
+namespace game_engine {
+    struct Frustum {
+        enum Plane {
+            Left = 0,
+            Right,
+            Bottom,
+            Top,
+            Near,
+            Far,
+
+            PlanesCount
+        };
+
+        std::array<glm::vec4, PlanesCount> planes;
+
+        static Frustum fromMatrix(const glm::mat4 &viewProjectionMatrix);
+
+        bool intersectsSphere(const glm::vec3 &center, const float radius) const;
+        bool intersectsBox(const glm::vec3 &min, const glm::vec3 &max) const;
+    };
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "game_engine_core/frustum.hpp"
+
+#include "glm/vec3.hpp"
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace game_engine {
+    enum class CullingBackend {
+        Scalar = 0,
+        SSE,
+        AVX2
+    };
+
+    class FrustumCuller {
+    public:
+        size_t addObject(const glm::vec3 &center, const float radius,
+                         const glm::vec3 &min, const glm::vec3 &max);
+        void setObject(const size_t index, const glm::vec3 &center, const float radius,
+                       const glm::vec3 &min, const glm::vec3 &max);
+        void reserve(const size_t objectsCount);
+        void clear();
+
+        size_t getObjectsCount() const { return m_radii.size(); }
+
+        size_t cullSpheres(const Frustum &frustum, const size_t objectsCount,
+                           std::vector<uint32_t> &visibleIndices,
+                           const CullingBackend backend = getBestBackend()) const;
+        size_t cullBoxes(const Frustum &frustum, const size_t objectsCount,
+                         std::vector<uint32_t> &visibleIndices,
+                         const CullingBackend backend = getBestBackend()) const;
+
+        static bool isBackendSupported(const CullingBackend backend);
+        static CullingBackend getBestBackend();
+        static const char *getBackendName(const CullingBackend backend);
+
+    private:
+        std::vector<float> m_centersX;
+        std::vector<float> m_centersY;
+        std::vector<float> m_centersZ;
+        std::vector<float> m_radii;
+
+        std::vector<float> m_minX;
+        std::vector<float> m_minY;
+        std::vector<float> m_minZ;
+        std::vector<float> m_maxX;
+        std::vector<float> m_maxY;
+        std::vector<float> m_maxZ;
+    };
+}
@@ -15,6 +15,8 @@ namespace game_engine {
         static void pressMouseButton(const MouseButton mouseButton);
         static void releaseMouseButton(const MouseButton mouseButton);
 
+        static void reset();
+
     private:
         static bool m_keysPressed[];
         static bool m_mouseButtonsPressed[];
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "game_engine_core/event.hpp"
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+#include "glm/vec2.hpp"
+#include "glm/vec3.hpp"
+
+namespace game_engine {
+    enum class InputRecordingMode {
+        None = 0,
+        Recording,
+        Replaying
+    };
+
+    struct InputRecordingEvent {
+        EventType type = EventType::EventsCount;
+        int32_t code = 0;
+        bool repeated = false;
+        float x = 0.0f;
+        float y = 0.0f;
+    };
+
+    struct InputRecordingFrame {
+        glm::vec3 cameraPosition{0.0f};
+        glm::vec3 cameraRotation{0.0f};
+        glm::vec2 cursorPosition{0.0f};
+        uint32_t firstEvent = 0;
+        uint32_t eventsCount = 0;
+    };
+
+    class InputRecording {
+    public:
+        static constexpr uint32_t s_fileMagic = 0x52494547;
+        static constexpr uint32_t s_fileVersion = 1;
+
+        void clear();
+
+        void setTimeStep(const double timeStep) { m_timeStep = timeStep; }
+        double getTimeStep() const { return m_timeStep; }
+
+        void addFrame(const glm::vec3 &cameraPosition, const glm::vec3 &cameraRotation,
+                      const glm::vec2 &cursorPosition);
+
+        void record(const EventKeyPressed &event);
+        void record(const EventKeyReleased &event);
+        void record(const EventMouseButtonPressed &event);
+        void record(const EventMouseButtonReleased &event);
+        void record(const EventMouseMoved &event);
+
+        void postFrameEvents(const size_t frameIndex, EventDispatcher &eventDispatcher) const;
+
+        size_t getFramesCount() const { return m_frames.size(); }
+        size_t getEventsCount() const { return m_events.size(); }
+        const InputRecordingFrame &getFrame(const size_t index) const { return m_frames[index]; }
+
+        bool save(const std::string &path) const;
+        bool load(const std::string &path);
+
+    private:
+        void addEvent(const InputRecordingEvent &event);
+
+        double m_timeStep = 1.0 / 60.0;
+        std::vector<InputRecordingFrame> m_frames;
+        std::vector<InputRecordingEvent> m_events;
+    };
+}
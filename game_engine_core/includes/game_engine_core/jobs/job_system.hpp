@@ -0,0 +1,71 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <algorithm>
+#include <cstddef>
+
+namespace game_engine {
+    class JobCounter {
+    public:
+        bool isDone() const { return m_value.load(std::memory_order_acquire) == 0; }
+
+    private:
+        friend class JobSystem;
+
+        std::atomic<int> m_value{0};
+    };
+
+    struct Job {
+        std::function<void()> function;
+        JobCounter *counter = nullptr;
+        const JobCounter *dependency = nullptr;
+        std::atomic<bool> pending{false};
+    };
+
+    class JobSystem {
+    public:
+        static constexpr size_t s_invalidThreadIndex = static_cast<size_t>(-1);
+
+        static bool initialize(const size_t threadsCount = 0);
+        static void shutdown();
+
+        static bool isInitialized();
+        static size_t getThreadsCount();
+        static size_t getCurrentThreadIndex();
+
+        static void run(std::function<void()> function, JobCounter *counter = nullptr,
+                        const JobCounter *dependency = nullptr);
+        static void wait(const JobCounter &counter);
+        static bool runOneJob();
+
+        template<typename Function>
+        static void parallelFor(const size_t count, const size_t grainSize, Function &&function) {
+            if (count == 0) {
+                return;
+            }
+
+            const size_t batchSize = std::max<size_t>(1, grainSize);
+            if (count <= batchSize || getThreadsCount() <= 1) {
+                function(size_t{0}, count);
+
+                return;
+            }
+
+            JobCounter counter;
+            for (size_t begin = batchSize; begin < count; begin += batchSize) {
+                const size_t end = std::min(begin + batchSize, count);
+
+                run([&function, begin, end]() {
+                    function(begin, end);
+                }, &counter);
+            }
+
+            function(size_t{0}, batchSize);
+            wait(counter);
+        }
+
+    private:
+        static void executeJob(Job &job);
+    };
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <utility>
+#include <cstddef>
+
+namespace game_engine {
+    template<typename T, size_t Capacity>
+    class SpscQueue {
+    public:
+        bool push(T value) {
+            const size_t tail = m_tail.load(std::memory_order_relaxed);
+
+            if (tail - m_head.load(std::memory_order_acquire) == Capacity) {
+                return false;
+            }
+
+            m_items[tail % Capacity] = std::move(value);
+            m_tail.store(tail + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        bool pop(T &value) {
+            const size_t head = m_head.load(std::memory_order_relaxed);
+
+            if (head == m_tail.load(std::memory_order_acquire)) {
+                return false;
+            }
+
+            value = std::move(m_items[head % Capacity]);
+            m_head.store(head + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        bool isEmpty() const {
+            return m_head.load(std::memory_order_acquire) ==
+                   m_tail.load(std::memory_order_acquire);
+        }
+
+        size_t getSize() const {
+            return m_tail.load(std::memory_order_acquire) -
+                   m_head.load(std::memory_order_acquire);
+        }
+
+    private:
+        std::array<T, Capacity> m_items{};
+        alignas(64) std::atomic<size_t> m_head{0};
+        alignas(64) std::atomic<size_t> m_tail{0};
+    };
+}
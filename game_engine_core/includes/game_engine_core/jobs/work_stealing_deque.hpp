@@ -0,0 +1,30 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+
+namespace game_engine {
+    struct Job;
+
+    class WorkStealingDeque {
+    public:
+        explicit WorkStealingDeque(const size_t capacity);
+
+        WorkStealingDeque(const WorkStealingDeque&) = delete;
+        WorkStealingDeque &operator=(const WorkStealingDeque&) = delete;
+
+        bool push(Job *job);
+        Job *pop();
+        Job *steal();
+
+        size_t getCapacity() const { return m_mask + 1; }
+
+    private:
+        std::unique_ptr<std::atomic<Job*>[]> m_jobs;
+        size_t m_mask = 0;
+        alignas(64) std::atomic<int64_t> m_top{0};
+        alignas(64) std::atomic<int64_t> m_bottom{0};
+    };
+}
@@ -2,16 +2,251 @@
 
 #include "spdlog/spdlog.h"
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+
 namespace game_engine {
-    #ifdef NDEBUG
-        #define LOG_INFO(...)
-        #define LOG_WARNING(...)
-        #define LOG_ERROR(...)
-        #define LOG_CRITICAL(...)
-    #else
-        #define LOG_INFO(...) spdlog::info(__VA_ARGS__)
-        #define LOG_WARNING(...) spdlog::warn(__VA_ARGS__)
-        #define LOG_ERROR(...) spdlog::error(__VA_ARGS__)
-        #define LOG_CRITICAL(...) spdlog::critical(__VA_ARGS__)
-    #endif
+    enum class LogLevel : uint8_t {
+        Trace = 0,
+        Info,
+        Warning,
+        Error,
+        Critical,
+        Off
+    };
+
+    enum class LogCategory : uint8_t {
+        Core = 0,
+        Render,
+        Input,
+        Window,
+        UI,
+
+        CategoriesCount
+    };
+
+    struct LogRecord;
+
+    using LogFormatFunction = void (*)(const LogRecord &record, std::string &message);
+
+    struct LogRecord {
+        static constexpr size_t s_payloadSize = 448;
+
+        std::chrono::system_clock::time_point time;
+        LogFormatFunction formatFunction = nullptr;
+        const char *format = nullptr;
+        uint32_t formatLength = 0;
+        uint32_t payloadLength = 0;
+        LogLevel level = LogLevel::Info;
+        LogCategory category = LogCategory::Core;
+
+        alignas(std::max_align_t) std::byte payload[s_payloadSize];
+    };
+
+    struct LogStringRef {
+        uint32_t offset;
+        uint32_t length;
+    };
+
+    template<typename T>
+    constexpr bool isLogStringArg = std::is_convertible_v<const std::decay_t<T>&, std::string_view>;
+
+    template<typename T>
+    constexpr bool isLogDeferrableArg = isLogStringArg<T> ||
+                                        std::is_arithmetic_v<std::decay_t<T>> ||
+                                        std::is_same_v<std::decay_t<T>, const void*> ||
+                                        std::is_same_v<std::decay_t<T>, void*>;
+
+    template<typename T>
+    using LogStoredArg = std::conditional_t<isLogStringArg<T>, LogStringRef, std::decay_t<T>>;
+
+    class Log {
+    public:
+        static constexpr size_t s_queueCapacity = 4096;
+        static constexpr size_t s_rateLimitsCount = 1024;
+        static constexpr uint32_t s_rateLimitMessagesCount = 20;
+        static constexpr int64_t s_rateLimitWindowMs = 1000;
+
+        static void initialize();
+        static void shutdown();
+        static bool isInitialized();
+
+        static void setLevel(const LogCategory category, const LogLevel level);
+        static LogLevel getLevel(const LogCategory category);
+        static const char *getCategoryName(const LogCategory category);
+
+        static bool isEnabled(const LogCategory category, const LogLevel level) {
+            return level >= s_levels[static_cast<size_t>(category)].load(std::memory_order_relaxed);
+        }
+
+        static void setBinaryMode(const bool enabled);
+        static bool isBinaryMode() { return s_isBinaryMode.load(std::memory_order_relaxed); }
+
+        static uint64_t getDroppedMessagesCount();
+        static uint64_t getSuppressedMessagesCount();
+
+        template<typename... Args>
+        static void write(const LogCategory category, const LogLevel level,
+                          spdlog::format_string_t<Args...> format, Args &&...args) {
+            const fmt::string_view formatView = format;
+
+            uint32_t suppressedCount = 0;
+            if (!acquireRateLimit(formatView.data(), suppressedCount)) {
+                return;
+            }
+
+            if (suppressedCount > 0) {
+                writeSuppressedNotice(category, level, suppressedCount);
+            }
+
+            if constexpr ((isLogDeferrableArg<Args> && ...)) {
+                if (isBinaryMode() && writeDeferred(category, level, format,
+                                                    std::forward<Args>(args)...)) {
+                    return;
+                }
+            }
+
+            fmt::basic_memory_buffer<char, LogRecord::s_payloadSize> buffer;
+            fmt::format_to(std::back_inserter(buffer), format, std::forward<Args>(args)...);
+
+            writeText(category, level, std::string_view(buffer.data(), buffer.size()));
+        }
+
+    private:
+        template<typename... Args>
+        static bool writeDeferred(const LogCategory category, const LogLevel level,
+                                  spdlog::format_string_t<Args...> format, Args &&...args) {
+            using StoredArgs = std::tuple<LogStoredArg<Args>...>;
+
+            if (!isInitialized()) {
+                return false;
+            }
+
+            size_t stringsOffset = alignStringsOffset(sizeof(StoredArgs));
+            const size_t payloadLength = stringsOffset + (getLogArgStringLength(args) + ... + 0);
+
+            if (payloadLength > LogRecord::s_payloadSize) {
+                return false;
+            }
+
+            LogRecord *record = acquireRecord();
+            if (record == nullptr) {
+                return true;
+            }
+
+            const fmt::string_view formatView = format;
+
+            record->time = std::chrono::system_clock::now();
+            record->formatFunction = &formatDeferred<StoredArgs>;
+            record->format = formatView.data();
+            record->formatLength = static_cast<uint32_t>(formatView.size());
+            record->payloadLength = static_cast<uint32_t>(payloadLength);
+            record->level = level;
+            record->category = category;
+
+            new (record->payload) StoredArgs{ packLogArg(*record, stringsOffset, args)... };
+
+            publishRecord(record);
+
+            return true;
+        }
+
+        template<typename T>
+        static size_t getLogArgStringLength(const T &arg) {
+            if constexpr (isLogStringArg<T>) {
+                return std::string_view(arg).size();
+            } else {
+                return 0;
+            }
+        }
+
+        template<typename T>
+        static LogStoredArg<T> packLogArg(LogRecord &record, size_t &stringsOffset, const T &arg) {
+            if constexpr (isLogStringArg<T>) {
+                const std::string_view string(arg);
+                const LogStringRef reference{ static_cast<uint32_t>(stringsOffset),
+                                              static_cast<uint32_t>(string.size()) };
+
+                std::memcpy(record.payload + stringsOffset, string.data(), string.size());
+                stringsOffset += string.size();
+
+                return reference;
+            } else {
+                return arg;
+            }
+        }
+
+        template<typename T>
+        static auto unpackLogArg(const LogRecord &record, const T &stored) {
+            if constexpr (std::is_same_v<T, LogStringRef>) {
+                return fmt::string_view(reinterpret_cast<const char*>(record.payload) +
+                                        stored.offset, stored.length);
+            } else {
+                return stored;
+            }
+        }
+
+        template<typename StoredArgs>
+        static void formatDeferred(const LogRecord &record, std::string &message) {
+            const StoredArgs &stored = *std::launder(reinterpret_cast<const StoredArgs*>(record.payload));
+
+            auto unpacked = std::apply([&record](const auto &...values) {
+                return std::make_tuple(unpackLogArg(record, values)...);
+            }, stored);
+
+            std::apply([&record, &message](auto &...values) {
+                message = fmt::vformat(fmt::string_view(record.format, record.formatLength),
+                                       fmt::make_format_args(values...));
+            }, unpacked);
+        }
+
+        static size_t alignStringsOffset(const size_t offset) {
+            return (offset + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+        }
+
+        static bool acquireRateLimit(const void *callSite, uint32_t &suppressedCount);
+        static void writeSuppressedNotice(const LogCategory category, const LogLevel level,
+                                          const uint32_t suppressedCount);
+        static void writeText(const LogCategory category, const LogLevel level,
+                              const std::string_view message);
+        static LogRecord *acquireRecord();
+        static void publishRecord(LogRecord *record);
+
+        static std::array<std::atomic<LogLevel>, static_cast<size_t>(LogCategory::CategoriesCount)> s_levels;
+        static std::atomic<bool> s_isBinaryMode;
+    };
 }
+
+#ifdef GAME_ENGINE_DISABLE_LOGGING
+    #define LOG_CATEGORY(category, level, ...)
+#else
+    #define LOG_CATEGORY(category, level, ...)                                                \
+        do {                                                                                  \
+            if (::game_engine::Log::isEnabled(category, level)) {                             \
+                ::game_engine::Log::write(category, level, __VA_ARGS__);                      \
+            }                                                                                 \
+        } while (false)
+#endif
+
+#define LOG_CATEGORY_INFO(category, ...) \
+    LOG_CATEGORY(::game_engine::LogCategory::category, ::game_engine::LogLevel::Info, __VA_ARGS__)
+#define LOG_CATEGORY_WARNING(category, ...) \
+    LOG_CATEGORY(::game_engine::LogCategory::category, ::game_engine::LogLevel::Warning, __VA_ARGS__)
+#define LOG_CATEGORY_ERROR(category, ...) \
+    LOG_CATEGORY(::game_engine::LogCategory::category, ::game_engine::LogLevel::Error, __VA_ARGS__)
+#define LOG_CATEGORY_CRITICAL(category, ...) \
+    LOG_CATEGORY(::game_engine::LogCategory::category, ::game_engine::LogLevel::Critical, __VA_ARGS__)
+
+#define LOG_INFO(...) LOG_CATEGORY_INFO(Core, __VA_ARGS__)
+#define LOG_WARNING(...) LOG_CATEGORY_WARNING(Core, __VA_ARGS__)
+#define LOG_ERROR(...) LOG_CATEGORY_ERROR(Core, __VA_ARGS__)
+#define LOG_CRITICAL(...) LOG_CATEGORY_CRITICAL(Core, __VA_ARGS__)
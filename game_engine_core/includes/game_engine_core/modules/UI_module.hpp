@@ -1,13 +1,39 @@
 #pragma once
 
+#include <memory>
+
 struct GLFWwindow;
+struct ImDrawData;
 
 namespace game_engine {
+    class UIDrawSnapshot {
+    public:
+        UIDrawSnapshot();
+        ~UIDrawSnapshot();
+
+        UIDrawSnapshot(const UIDrawSnapshot&) = delete;
+        UIDrawSnapshot &operator=(const UIDrawSnapshot&) = delete;
+
+        void capture(const ImDrawData &drawData);
+        void clear();
+
+        ImDrawData *getDrawData() const { return m_drawData.get(); }
+
+    private:
+        std::unique_ptr<ImDrawData> m_drawData;
+    };
+
     class UIModule {
     public:
         static void onWindowCreate(GLFWwindow *window);
+        static void onHeadlessCreate(const unsigned int width, const unsigned int height);
         static void onWindowClose();
+        static void setViewportsEnabled(const bool enabled);
+        static void createDeviceObjects();
+        static bool needsRedraw();
         static void onUIDrawBegin();
         static void onUIDrawEnd();
+        static void onUIDrawEnd(UIDrawSnapshot &snapshot);
+        static void renderSnapshot(const UIDrawSnapshot &snapshot);
     };
 }
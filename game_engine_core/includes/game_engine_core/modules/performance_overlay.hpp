@@ -0,0 +1,8 @@
+#pragma once
+
+namespace game_engine {
+    class PerformanceOverlay {
+    public:
+        static void draw(bool &isOpen);
+    };
+}
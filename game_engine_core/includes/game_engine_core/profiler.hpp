@@ -0,0 +1,82 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace game_engine {
+    struct ProfileEvent {
+        const char *name = nullptr;
+        uint64_t beginNs = 0;
+        uint64_t endNs = 0;
+        bool gpu = false;
+    };
+
+    struct ProfileStageStats {
+        const char *name = nullptr;
+        double cpuTimeMs = 0.0;
+        double gpuTimeMs = 0.0;
+    };
+
+    class Profiler {
+    public:
+        static constexpr size_t s_threadEventsCapacity = 16384;
+        static constexpr size_t s_maxCaptureFramesCount = 1024;
+        static constexpr size_t s_captureTailFramesCount = 8;
+        static constexpr double s_stageStatsSmoothing = 0.1;
+
+        static uint64_t getTimeNs() {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+        static void setThreadName(const std::string &name);
+        static void beginFrame();
+
+        static void recordEvent(const char *name, const uint64_t beginNs, const uint64_t endNs,
+                                const bool gpu = false);
+        static void recordDroppedEvents(const uint64_t count);
+
+        static bool captureFrames(const size_t framesCount);
+        static bool isCapturing();
+        static bool hasCapture();
+        static size_t getCapturedFramesCount();
+        static size_t getCapturedEventsCount();
+        static uint64_t getDroppedEventsCount();
+        static const std::vector<ProfileStageStats> &getStageStats();
+        static bool exportChromeTrace(const std::string &path);
+    };
+
+    class CpuProfileScope {
+    public:
+        explicit CpuProfileScope(const char *name)
+            : m_name{name}, m_beginNs{Profiler::getTimeNs()} {}
+
+        ~CpuProfileScope() {
+            Profiler::recordEvent(m_name, m_beginNs, Profiler::getTimeNs());
+        }
+
+        CpuProfileScope(const CpuProfileScope&) = delete;
+        CpuProfileScope &operator=(const CpuProfileScope&) = delete;
+
+    private:
+        const char *m_name;
+        uint64_t m_beginNs;
+    };
+}
+
+#define PROFILE_CONCAT_IMPL(first, second) first##second
+#define PROFILE_CONCAT(first, second) PROFILE_CONCAT_IMPL(first, second)
+
+#ifdef GAME_ENGINE_DISABLE_PROFILING
+    #define PROFILE_SCOPE(name)
+    #define PROFILE_FRAME()
+    #define PROFILE_THREAD(name)
+#else
+    #define PROFILE_SCOPE(name) \
+        ::game_engine::CpuProfileScope PROFILE_CONCAT(profileScope, __LINE__){name}
+    #define PROFILE_FRAME() ::game_engine::Profiler::beginFrame()
+    #define PROFILE_THREAD(name) ::game_engine::Profiler::setThreadName(name)
+#endif
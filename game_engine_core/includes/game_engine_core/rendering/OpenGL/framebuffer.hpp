@@ -0,0 +1,38 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+namespace game_engine {
+    class Framebuffer {
+    public:
+        Framebuffer(const unsigned int width, const unsigned int height);
+        ~Framebuffer();
+
+        Framebuffer(const Framebuffer&) = delete;
+        Framebuffer(Framebuffer&&) = delete;
+        Framebuffer &operator=(const Framebuffer&) = delete;
+        Framebuffer &operator=(Framebuffer&&) = delete;
+
+        bool isComplete() const { return m_isComplete; }
+
+        void bind() const;
+        static void unbind();
+
+        void readPixels(std::vector<unsigned char> &pixels) const;
+
+        unsigned int getId() const { return m_id; }
+        unsigned int getColorTextureId() const { return m_colorTextureId; }
+        unsigned int getWidth() const { return m_width; }
+        unsigned int getHeight() const { return m_height; }
+
+    private:
+        unsigned int m_id = 0;
+        unsigned int m_colorTextureId = 0;
+        unsigned int m_depthRenderbufferId = 0;
+        unsigned int m_width = 0;
+        unsigned int m_height = 0;
+        size_t m_memorySize = 0;
+        bool m_isComplete = false;
+    };
+}
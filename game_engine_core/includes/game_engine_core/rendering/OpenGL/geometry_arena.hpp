@@ -0,0 +1,64 @@
+#pragma once
+
+#include "game_engine_core/rendering/OpenGL/vertex_buffer.hpp"
+#include "game_engine_core/rendering/OpenGL/index_buffer.hpp"
+#include "game_engine_core/rendering/OpenGL/vertex_array.hpp"
+
+#include <vector>
+#include <cstddef>
+
+namespace game_engine {
+    class RangeAllocator {
+    public:
+        static constexpr size_t s_invalidOffset = ~size_t{0};
+
+        explicit RangeAllocator(const size_t capacity);
+
+        size_t allocate(const size_t size);
+        void free(const size_t offset, const size_t size);
+
+        size_t getCapacity() const { return m_capacity; }
+        size_t getUsed() const { return m_used; }
+
+    private:
+        struct FreeRange {
+            size_t offset;
+            size_t size;
+        };
+
+        std::vector<FreeRange> m_freeRanges;
+        size_t m_capacity = 0;
+        size_t m_used = 0;
+    };
+
+    struct MeshRange {
+        size_t baseVertex = 0;
+        size_t verticesCount = 0;
+        size_t firstIndex = 0;
+        size_t indicesCount = 0;
+    };
+
+    class GeometryArena {
+    public:
+        GeometryArena(BufferLayout bufferLayout, const size_t maxVerticesCount,
+                      const size_t maxIndicesCount);
+
+        GeometryArena(const GeometryArena&) = delete;
+        GeometryArena &operator=(const GeometryArena&) = delete;
+
+        bool addMesh(const void *vertices, const size_t verticesCount,
+                     const unsigned int *indices, const size_t indicesCount,
+                     MeshRange &meshRange);
+        void removeMesh(const MeshRange &meshRange);
+
+        const VertexArray &getVertexArray() const { return m_vertexArray; }
+
+    private:
+        VertexBuffer m_vertexBuffer;
+        IndexBuffer m_indexBuffer;
+        VertexArray m_vertexArray;
+        RangeAllocator m_verticesAllocator;
+        RangeAllocator m_indicesAllocator;
+        size_t m_stride = 0;
+    };
+}
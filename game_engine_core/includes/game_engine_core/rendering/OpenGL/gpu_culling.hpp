@@ -0,0 +1,53 @@
+#pragma once
+
+#include "game_engine_core/rendering/OpenGL/indirect_batch.hpp"
+#include "game_engine_core/rendering/OpenGL/shader_program.hpp"
+#include "game_engine_core/frustum.hpp"
+
+#include "glm/mat4x4.hpp"
+#include "glm/vec4.hpp"
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace game_engine {
+    struct GpuCullingObject {
+        glm::vec4 boundingSphere;
+        glm::mat4 modelMatrix;
+        uint32_t firstIndex;
+        uint32_t indicesCount;
+        int32_t baseVertex;
+        uint32_t materialIndex;
+    };
+
+    class GpuCulling {
+    public:
+        explicit GpuCulling(const size_t maxObjectsCount);
+        ~GpuCulling();
+
+        GpuCulling(const GpuCulling&) = delete;
+        GpuCulling &operator=(const GpuCulling&) = delete;
+
+        bool isValid() const { return m_cullingProgram.isCompiled(); }
+
+        void setObjects(const std::vector<GpuCullingObject> &objects);
+        void cull(const Frustum &frustum, const size_t objectsCount);
+        void draw(const GeometryArena &geometryArena) const;
+        size_t readVisibleCount() const;
+
+    private:
+        ShaderProgram m_cullingProgram;
+        int m_frustumPlanesLocation = -1;
+        int m_objectsCountLocation = -1;
+
+        unsigned int m_objectsBufferId = 0;
+        unsigned int m_commandsBufferId = 0;
+        unsigned int m_drawDataBufferId = 0;
+        unsigned int m_drawCountBufferId = 0;
+
+        size_t m_maxObjectsCount = 0;
+        size_t m_objectsCount = 0;
+        size_t m_culledObjectsCount = 0;
+    };
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "game_engine_core/profiler.hpp"
+
+#include <cstddef>
+
+namespace game_engine {
+    class GpuProfiler {
+    public:
+        static constexpr size_t s_queryFramesCount = 4;
+        static constexpr size_t s_maxScopesPerFrameCount = 64;
+        static constexpr size_t s_maxScopesDepth = 16;
+
+        static void beginFrame();
+        static void beginScope(const char *name);
+        static void endScope();
+        static void release();
+    };
+
+    class GpuProfileScope {
+    public:
+        explicit GpuProfileScope(const char *name) {
+            GpuProfiler::beginScope(name);
+        }
+
+        ~GpuProfileScope() {
+            GpuProfiler::endScope();
+        }
+
+        GpuProfileScope(const GpuProfileScope&) = delete;
+        GpuProfileScope &operator=(const GpuProfileScope&) = delete;
+    };
+}
+
+#ifdef GAME_ENGINE_DISABLE_PROFILING
+    #define PROFILE_GPU_SCOPE(name)
+    #define PROFILE_GPU_FRAME()
+#else
+    #define PROFILE_GPU_SCOPE(name) \
+        ::game_engine::GpuProfileScope PROFILE_CONCAT(gpuProfileScope, __LINE__){name}
+    #define PROFILE_GPU_FRAME() ::game_engine::GpuProfiler::beginFrame()
+#endif
@@ -0,0 +1,19 @@
+#pragma once
+
+namespace game_engine {
+    class HeadlessContextEGL {
+    public:
+        static constexpr int s_contextMajorVersion = 4;
+        static constexpr int s_contextMinorVersion = 5;
+
+        static bool isSupported();
+
+        static bool create();
+        static void destroy();
+
+        static bool makeCurrent();
+        static void releaseCurrent();
+
+        static void *getProcAddress(const char *name);
+    };
+}
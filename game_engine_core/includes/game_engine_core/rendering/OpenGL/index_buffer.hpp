@@ -15,9 +15,11 @@ namespace game_engine {
         IndexBuffer &operator=(IndexBuffer&&) noexcept;
         IndexBuffer(IndexBuffer&&) noexcept;
 
+        void setData(const void *data, const size_t count, const size_t firstIndex = 0) const;
         void bind() const;
         static void unbind();
         size_t getCount() const { return m_count; }
+        unsigned int getId() const { return m_id; }
 
     private:
         unsigned int m_id = 0;
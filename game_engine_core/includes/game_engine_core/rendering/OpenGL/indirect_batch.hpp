@@ -0,0 +1,60 @@
+#pragma once
+
+#include "game_engine_core/rendering/OpenGL/geometry_arena.hpp"
+
+#include "glm/mat4x4.hpp"
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace game_engine {
+    enum class StorageBlockBinding : unsigned int {
+        DrawData = 0,
+        CullObjects,
+        DrawCommands,
+        DrawCount
+    };
+
+    struct DrawElementsIndirectCommand {
+        uint32_t count;
+        uint32_t instanceCount;
+        uint32_t firstIndex;
+        int32_t baseVertex;
+        uint32_t baseInstance;
+    };
+
+    struct IndirectDrawData {
+        glm::mat4 modelMatrix;
+        uint32_t materialIndex;
+        uint32_t padding[3];
+    };
+
+    class IndirectBatch {
+    public:
+        IndirectBatch() = default;
+        ~IndirectBatch();
+
+        IndirectBatch(const IndirectBatch&) = delete;
+        IndirectBatch &operator=(const IndirectBatch&) = delete;
+
+        void add(const MeshRange &meshRange, const glm::mat4 &modelMatrix,
+                 const unsigned int materialIndex = 0);
+        void clear();
+        void submit(const GeometryArena &geometryArena, const size_t drawsCount);
+
+        size_t getDrawsCount() const { return m_commands.size(); }
+
+    private:
+        void upload();
+
+        std::vector<DrawElementsIndirectCommand> m_commands;
+        std::vector<IndirectDrawData> m_drawData;
+        std::vector<size_t> m_indicesTotals;
+
+        unsigned int m_commandsBufferId = 0;
+        unsigned int m_drawDataBufferId = 0;
+        size_t m_capacity = 0;
+        bool m_dirty = false;
+    };
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "glm/mat4x4.hpp"
+#include "glm/vec4.hpp"
+
+#include <array>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <cstddef>
+
+namespace game_engine {
+    class VertexArray;
+    class ShaderProgram;
+    class Texture2D;
+
+    enum class DrawUniformType : uint8_t {
+        Int = 0,
+        Float,
+        Vec4,
+        Mat4
+    };
+
+    struct DrawUniform {
+        int location = -1;
+        DrawUniformType type = DrawUniformType::Int;
+    };
+
+    struct DrawPacket {
+        static constexpr size_t s_maxTexturesCount = 2;
+
+        const VertexArray *vertexArray = nullptr;
+        const ShaderProgram *shaderProgram = nullptr;
+        std::array<const Texture2D*, s_maxTexturesCount> textures{};
+        glm::mat4 modelMatrix{1.0f};
+        uint32_t uniformsOffset = 0;
+        uint32_t uniformsSize = 0;
+        size_t instanceCount = 1;
+        float depth = 0.0f;
+        uint8_t layer = 0;
+        bool transparent = false;
+    };
+
+    class RenderQueue {
+    public:
+        struct Stats {
+            size_t drawCalls = 0;
+            size_t programSwitches = 0;
+            size_t vertexArraySwitches = 0;
+            size_t textureSwitches = 0;
+        };
+
+        void begin(const float maxDepth);
+        void submit(const DrawPacket &packet);
+        void execute();
+
+        void setUniform(DrawPacket &packet, const int location, const int value);
+        void setUniform(DrawPacket &packet, const int location, const float value);
+        void setUniform(DrawPacket &packet, const int location, const glm::vec4 &value);
+        void setUniform(DrawPacket &packet, const int location, const glm::mat4 &value);
+
+        size_t getPacketsCount() const { return m_packets.size(); }
+        const Stats &getStats() const { return m_stats; }
+
+    private:
+        uint64_t makeSortKey(const DrawPacket &packet);
+        uint64_t getSortId(std::unordered_map<uint64_t, uint64_t> &sortIds, const uint64_t id);
+        void appendUniform(DrawPacket &packet, const int location, const DrawUniformType type,
+                           const void *data, const size_t size);
+        void applyUniforms(const ShaderProgram &shaderProgram, const DrawPacket &packet) const;
+        void sort();
+
+        std::vector<DrawPacket> m_packets;
+        std::vector<std::byte> m_uniformArena;
+        std::unordered_map<uint64_t, uint64_t> m_programSortIds;
+        std::unordered_map<uint64_t, uint64_t> m_vertexArraySortIds;
+        std::unordered_map<uint64_t, uint64_t> m_textureSortIds;
+        std::vector<uint64_t> m_keys;
+        std::vector<uint32_t> m_order;
+        std::vector<uint64_t> m_scratchKeys;
+        std::vector<uint32_t> m_scratchOrder;
+
+        float m_maxDepth = 1.0f;
+        bool m_hasSortIdsOverflowed = false;
+        Stats m_stats;
+    };
+}
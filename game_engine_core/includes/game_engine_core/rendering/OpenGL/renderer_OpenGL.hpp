@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+
 struct GLFWwindow;
 
 namespace game_engine {
@@ -7,9 +9,26 @@ namespace game_engine {
 
     class RendererOpenGL {
     public:
+        using ProcAddressLoader = void *(*)(const char *name);
+
         static bool init(GLFWwindow *window);
+        static bool init(const ProcAddressLoader loader);
 
         static void draw(const VertexArray &vertexArray);
+        static void drawInstanced(const VertexArray &vertexArray, const size_t instanceCount);
+        static void drawIndexed(const size_t indicesCount, const size_t instanceCount = 1);
+        static void multiDrawIndirect(const VertexArray &vertexArray, const size_t indirectOffset,
+                                      const size_t drawsCount);
+        static bool multiDrawIndirectCount(const VertexArray &vertexArray,
+                                           const size_t indirectOffset,
+                                           const size_t drawCountOffset,
+                                           const size_t maxDrawsCount);
+        static bool isIndirectCountSupported();
+        static bool isExtensionSupported(const char *name);
+        static void dispatchCompute(const unsigned int groupsCountX,
+                                    const unsigned int groupsCountY = 1,
+                                    const unsigned int groupsCountZ = 1);
+        static void indirectCommandsBarrier();
         static void setClearColor(const float red, const float green,
                                     const float blue, const float alpha);
         static void clear();
@@ -18,6 +37,20 @@ namespace game_engine {
                                 const unsigned int bottom_offset = 0);
         static void enableDepthTest();
         static void disableDepthTest();
+        static void enableBlending();
+        static void disableBlending();
+        static void setDepthWrite(const bool enabled);
+        static void finish();
+
+        static size_t getUniformBufferOffsetAlignment();
+
+        static void releaseBuffer(const unsigned int id);
+        static void releaseTexture(const unsigned int id);
+        static void releaseSampler(const unsigned int id);
+        static void releaseVertexArray(const unsigned int id);
+        static void releaseProgram(const unsigned int id);
+        static void releaseFramebuffer(const unsigned int id);
+        static void releaseRenderbuffer(const unsigned int id);
 
         static const char *getVendorStr();
         static const char *getRendererStr();
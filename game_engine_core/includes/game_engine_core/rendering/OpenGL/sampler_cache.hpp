@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+namespace game_engine {
+    enum class TextureFilter : uint8_t {
+        Nearest = 0,
+        Linear
+    };
+
+    enum class MipmapFilter : uint8_t {
+        None = 0,
+        Nearest,
+        Linear
+    };
+
+    enum class TextureWrap : uint8_t {
+        Repeat = 0,
+        ClampToEdge,
+        MirroredRepeat
+    };
+
+    struct SamplerState {
+        TextureFilter minFilter = TextureFilter::Linear;
+        TextureFilter magFilter = TextureFilter::Linear;
+        MipmapFilter mipmapFilter = MipmapFilter::Linear;
+        TextureWrap wrapS = TextureWrap::Repeat;
+        TextureWrap wrapT = TextureWrap::Repeat;
+
+        uint32_t getKey() const;
+    };
+
+    class SamplerCache {
+    public:
+        static unsigned int getSampler(const SamplerState &state);
+        static void bind(const unsigned int unit, const SamplerState &state);
+        static void release();
+
+        static size_t getSamplersCount();
+    };
+}
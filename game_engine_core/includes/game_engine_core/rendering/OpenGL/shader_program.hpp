@@ -1,11 +1,17 @@
 #pragma once
 
 #include "glm/mat4x4.hpp"
+#include "glm/vec4.hpp"
+
+#include <unordered_map>
+#include <string>
+#include <cstddef>
 
 namespace game_engine {
     class ShaderProgram {
     public:
         ShaderProgram(const char *vertexShaderSrc, const char *fragmentShaderSrc);
+        explicit ShaderProgram(const char *computeShaderSrc);
         ShaderProgram(ShaderProgram&&);
         ShaderProgram &operator=(ShaderProgram&&);
         ~ShaderProgram();
@@ -18,11 +24,41 @@ namespace game_engine {
         static void unbind();
 
         bool isCompiled() const { return m_isCompiled; }
+        unsigned int getId() const { return m_id; }
+        int getUniformLocation(const char *name) const;
+        int getModelMatrixLocation() const { return m_modelMatrixLocation; }
+
         void setMatrix_4(const char *name, const glm::mat4 &matrix) const;
+        void setMatrix_4(const int location, const glm::mat4 &matrix) const;
         void setInt(const char *name, const int value) const;
+        void setInt(const int location, const int value) const;
+        void setFloat(const char *name, const float value) const;
+        void setFloat(const int location, const float value) const;
+        void setVec4Array(const char *name, const glm::vec4 *values, const size_t count) const;
+        void setVec4Array(const int location, const glm::vec4 *values, const size_t count) const;
+
+        static constexpr size_t hashUniformName(const char *name) {
+            size_t hash = 14695981039346656037ull;
+
+            for (; *name != '\0'; ++name) {
+                hash ^= static_cast<unsigned char>(*name);
+                hash *= 1099511628211ull;
+            }
+
+            return hash;
+        }
 
     private:
+        struct UniformLocation {
+            std::string name;
+            int location = -1;
+        };
+
+        void reflect();
+
         bool m_isCompiled = false;
         unsigned int m_id = 0;
+        int m_modelMatrixLocation = -1;
+        std::unordered_multimap<size_t, UniformLocation> m_uniformLocations;
     };
 }
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+
+namespace game_engine {
+    enum class BufferTarget {
+        Array = 0,
+        ElementArray,
+        Uniform,
+        ShaderStorage,
+        DrawIndirect,
+        Parameter,
+        PixelUnpack,
+
+        TargetsCount
+    };
+
+    enum class DepthFunction {
+        Less,
+        LessEqual,
+        Always
+    };
+
+    struct PipelineState {
+        bool depthTest = true;
+        bool depthWrite = true;
+        DepthFunction depthFunction = DepthFunction::Less;
+        bool blending = false;
+        bool cullFace = false;
+    };
+
+    class StateTrackerOpenGL {
+    public:
+        struct Stats {
+            size_t issuedCalls = 0;
+            size_t skippedCalls = 0;
+        };
+
+        static constexpr unsigned int s_maxTextureUnits = 32;
+        static constexpr unsigned int s_maxIndexedBindings = 16;
+
+        static void useProgram(const unsigned int id);
+        static void bindVertexArray(const unsigned int id);
+        static void bindBuffer(const BufferTarget target, const unsigned int id);
+        static void bindBufferBase(const BufferTarget target, const unsigned int index,
+                                   const unsigned int id);
+        static void bindBufferRange(const BufferTarget target, const unsigned int index,
+                                    const unsigned int id, const size_t offset,
+                                    const size_t size);
+        static void bindTextureUnit(const unsigned int unit, const unsigned int id);
+        static void bindSampler(const unsigned int unit, const unsigned int id);
+
+        static void setDepthTest(const bool enabled);
+        static void setDepthWrite(const bool enabled);
+        static void setDepthFunction(const DepthFunction function);
+        static void setBlending(const bool enabled);
+        static void setCullFace(const bool enabled);
+        static void setClearColor(const float red, const float green,
+                                  const float blue, const float alpha);
+        static void applyPipelineState(const PipelineState &state);
+
+        static void onProgramDeleted(const unsigned int id);
+        static void onVertexArrayDeleted(const unsigned int id);
+        static void onBufferDeleted(const unsigned int id);
+        static void onTextureDeleted(const unsigned int id);
+        static void onSamplerDeleted(const unsigned int id);
+
+        static void invalidate();
+        static void beginFrame();
+        static const Stats &getLastFrameStats();
+    };
+}
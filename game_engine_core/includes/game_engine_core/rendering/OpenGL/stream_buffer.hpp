@@ -0,0 +1,44 @@
+#pragma once
+
+#include "game_engine_core/rendering/OpenGL/state_tracker_OpenGL.hpp"
+
+#include <vector>
+#include <cstddef>
+
+namespace game_engine {
+    class StreamBuffer {
+    public:
+        StreamBuffer(const size_t regionSize, const unsigned int regionsCount = 3);
+        ~StreamBuffer();
+
+        StreamBuffer(const StreamBuffer&) = delete;
+        StreamBuffer &operator=(const StreamBuffer&) = delete;
+
+        StreamBuffer &operator=(StreamBuffer &&streamBuffer) noexcept;
+        StreamBuffer(StreamBuffer &&streamBuffer) noexcept;
+
+        void beginFrame();
+        void endFrame();
+
+        void *allocate(const size_t size, const size_t alignment, size_t &offset);
+        void bind(const BufferTarget target) const;
+        void bindRange(const BufferTarget target, const unsigned int index,
+                       const size_t offset, const size_t size) const;
+
+        unsigned int getId() const { return m_id; }
+        size_t getRegionSize() const { return m_regionSize; }
+        size_t getStallsCount() const { return m_stallsCount; }
+
+    private:
+        void release();
+
+        unsigned int m_id = 0;
+        unsigned char *m_mappedData = nullptr;
+        size_t m_regionSize = 0;
+        unsigned int m_regionsCount = 0;
+        unsigned int m_currentRegion = 0;
+        size_t m_regionUsed = 0;
+        size_t m_stallsCount = 0;
+        std::vector<void*> m_fences;
+    };
+}
@@ -1,10 +1,21 @@
 #pragma once
 
+#include "game_engine_core/rendering/texture_format.hpp"
+
+#include <cstddef>
+
 namespace game_engine {
+    class TextureContainer;
+
     class Texture2D {
     public:
+        Texture2D() = default;
         Texture2D(const unsigned char *data,
                   const unsigned int width, const unsigned int height);
+        Texture2D(const unsigned int width, const unsigned int height,
+                  const TextureFormat format = TextureFormat::RGB8,
+                  const unsigned int levelsCount = 0);
+        explicit Texture2D(const TextureContainer &container, const unsigned int firstLevel = 0);
         ~Texture2D();
 
         Texture2D(const Texture2D&) = delete;
@@ -13,11 +24,31 @@ namespace game_engine {
         Texture2D &operator=(Texture2D &&texture) noexcept;
         Texture2D(Texture2D &&texture) noexcept;
 
+        void uploadRows(const unsigned int firstRow, const unsigned int rowsCount,
+                        const unsigned int pixelUnpackBuffer, const size_t offset);
+        void uploadLevel(const unsigned int level, const void *data, const size_t size);
+        void reallocateLevels(const TextureContainer &container, const unsigned int firstLevel);
+        void generateMipmaps();
+
         void bind(const unsigned int unit) const;
+        unsigned int getId() const { return m_id; }
+        unsigned int getWidth() const { return m_width; }
+        unsigned int getHeight() const { return m_height; }
+        TextureFormat getFormat() const { return m_format; }
+        unsigned int getLevelsCount() const { return m_levelsCount; }
+        unsigned int getFirstLevel() const { return m_firstLevel; }
+        size_t getMemorySize() const { return m_memorySize; }
+
+        static size_t getRowPitch(const unsigned int width);
+        static bool isFormatSupported(const TextureFormat format);
 
     private:
         unsigned int m_id = 0;
         unsigned int m_width = 0;
         unsigned int m_height = 0;
+        TextureFormat m_format = TextureFormat::RGB8;
+        unsigned int m_levelsCount = 0;
+        unsigned int m_firstLevel = 0;
+        size_t m_memorySize = 0;
     };
 }
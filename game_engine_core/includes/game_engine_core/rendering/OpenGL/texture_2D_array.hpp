@@ -0,0 +1,52 @@
+#pragma once
+
+#include "game_engine_core/rendering/texture_format.hpp"
+
+#include "glm/vec4.hpp"
+
+#include <cstddef>
+
+namespace game_engine {
+    class Texture2D;
+    class TextureContainer;
+
+    class Texture2DArray {
+    public:
+        Texture2DArray(const unsigned int width, const unsigned int height,
+                       const unsigned int layersCount,
+                       const TextureFormat format = TextureFormat::RGB8,
+                       const unsigned int levelsCount = 0);
+        ~Texture2DArray();
+
+        Texture2DArray(const Texture2DArray&) = delete;
+        Texture2DArray &operator=(const Texture2DArray&) = delete;
+
+        Texture2DArray &operator=(Texture2DArray &&textureArray) noexcept;
+        Texture2DArray(Texture2DArray &&textureArray) noexcept;
+
+        bool uploadLayer(const unsigned int layer, const unsigned int level,
+                         const void *data, const size_t size);
+        bool uploadLayer(const unsigned int layer, const TextureContainer &container);
+        bool copyLayer(const unsigned int layer, const Texture2D &texture);
+        bool clear(const glm::vec4 &color);
+        void generateMipmaps();
+
+        void bind(const unsigned int unit) const;
+        unsigned int getId() const { return m_id; }
+        unsigned int getWidth() const { return m_width; }
+        unsigned int getHeight() const { return m_height; }
+        unsigned int getLayersCount() const { return m_layersCount; }
+        TextureFormat getFormat() const { return m_format; }
+        unsigned int getLevelsCount() const { return m_levelsCount; }
+        size_t getMemorySize() const { return m_memorySize; }
+
+    private:
+        unsigned int m_id = 0;
+        unsigned int m_width = 0;
+        unsigned int m_height = 0;
+        unsigned int m_layersCount = 0;
+        TextureFormat m_format = TextureFormat::RGB8;
+        unsigned int m_levelsCount = 0;
+        size_t m_memorySize = 0;
+    };
+}
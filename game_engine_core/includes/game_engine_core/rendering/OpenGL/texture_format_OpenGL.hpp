@@ -0,0 +1,13 @@
+#pragma once
+
+#include "game_engine_core/rendering/texture_format.hpp"
+
+namespace game_engine {
+    struct TextureFormatOpenGL {
+        unsigned int internalFormat;
+        unsigned int uploadFormat;
+        unsigned int uploadType;
+    };
+
+    const TextureFormatOpenGL &getTextureFormatOpenGL(const TextureFormat format);
+}
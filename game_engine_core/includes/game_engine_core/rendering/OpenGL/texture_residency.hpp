@@ -0,0 +1,46 @@
+#pragma once
+
+#include "game_engine_core/rendering/OpenGL/texture_2D.hpp"
+#include "game_engine_core/rendering/texture_container.hpp"
+
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace game_engine {
+    struct TextureResidencyRequest {
+        const Texture2D *texture = nullptr;
+        float screenSize = 0.0f;
+    };
+
+    class TextureResidency {
+    public:
+        static constexpr size_t s_defaultBudget = 256 * 1024 * 1024;
+        static constexpr size_t s_defaultUploadBudget = 4 * 1024 * 1024;
+        static constexpr unsigned int s_minResidentSize = 32;
+        static constexpr uint64_t s_releaseDelayFrames = 120;
+
+        static void initialize(const size_t budgetBytes = s_defaultBudget);
+        static void shutdown();
+        static bool isActive();
+
+        static const Texture2D *add(std::shared_ptr<const TextureContainer> container);
+        static void remove(const Texture2D *texture);
+        static void update(const std::vector<TextureResidencyRequest> &requests);
+
+        static void setBudget(const size_t budgetBytes);
+        static size_t getBudget();
+        static void setUploadBudget(const size_t bytesPerFrame);
+        static size_t getUploadBudget();
+        static size_t getResidentBytes();
+        static size_t getTexturesCount();
+
+        static float calculateScreenSize(const float worldSize, const float distance,
+                                         const float projectionScale, const float viewportHeight);
+        static unsigned int calculateRequiredLevel(const unsigned int width,
+                                                   const unsigned int height,
+                                                   const unsigned int levelsCount,
+                                                   const float screenSize);
+    };
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "game_engine_core/rendering/OpenGL/texture_2D.hpp"
+#include "game_engine_core/rendering/procedural_image.hpp"
+
+#include <atomic>
+#include <memory>
+#include <functional>
+#include <cstddef>
+
+namespace game_engine {
+    enum class TextureStreamState {
+        Queued = 0,
+        Decoding,
+        Uploading,
+        Ready,
+        Failed
+    };
+
+    struct TextureStreamRequest;
+
+    using TextureDecoder = std::function<bool(const ImageView &image)>;
+
+    class StreamedTexture {
+    public:
+        StreamedTexture(const unsigned int width, const unsigned int height,
+                        const Texture2D *placeholder);
+
+        StreamedTexture(const StreamedTexture&) = delete;
+        StreamedTexture &operator=(const StreamedTexture&) = delete;
+
+        TextureStreamState getState() const { return m_state.load(std::memory_order_acquire); }
+        bool isReady() const { return getState() == TextureStreamState::Ready; }
+        bool isDone() const;
+
+        const Texture2D *getTexture() const;
+        unsigned int getWidth() const { return m_width; }
+        unsigned int getHeight() const { return m_height; }
+
+    private:
+        friend class TextureStreamer;
+
+        std::unique_ptr<Texture2D> m_texture;
+        const Texture2D *m_placeholder = nullptr;
+        unsigned int m_width = 0;
+        unsigned int m_height = 0;
+        std::atomic<TextureStreamState> m_state{TextureStreamState::Queued};
+    };
+
+    using StreamedTextureHandle = std::shared_ptr<StreamedTexture>;
+
+    class TextureStreamer {
+    public:
+        static constexpr size_t s_defaultStagingSize = 16 * 1024 * 1024;
+        static constexpr size_t s_defaultUploadBudget = 4 * 1024 * 1024;
+        static constexpr size_t s_defaultDecodeThreadsCount = 2;
+
+        static bool initialize(const size_t stagingSize = s_defaultStagingSize,
+                               const size_t decodeThreadsCount = s_defaultDecodeThreadsCount);
+        static void shutdown();
+        static bool isInitialized();
+
+        static StreamedTextureHandle load(const unsigned int width, const unsigned int height,
+                                          TextureDecoder decoder);
+        static void update();
+
+        static void setUploadBudget(const size_t bytesPerFrame);
+        static size_t getUploadBudget();
+        static size_t getPendingCount();
+        static const Texture2D *getPlaceholder();
+
+    private:
+        static void startStreams();
+        static void uploadStreams();
+        static void finishStream(TextureStreamRequest &request, const TextureStreamState state);
+    };
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "glm/mat4x4.hpp"
+#include "glm/vec4.hpp"
+
+#include <cstddef>
+
+namespace game_engine {
+    enum class UniformBlockBinding : unsigned int {
+        Camera = 0
+    };
+
+    struct CameraUniformBlock {
+        glm::mat4 viewMatrix;
+        glm::mat4 projectionMatrix;
+        glm::mat4 viewProjectionMatrix;
+        glm::vec4 position;
+    };
+
+    class UniformBuffer {
+    public:
+        UniformBuffer(const size_t size, const UniformBlockBinding binding);
+        ~UniformBuffer();
+
+        UniformBuffer(const UniformBuffer&) = delete;
+        UniformBuffer &operator=(const UniformBuffer&) = delete;
+
+        UniformBuffer &operator=(UniformBuffer &&uniformBuffer) noexcept;
+        UniformBuffer(UniformBuffer &&uniformBuffer) noexcept;
+
+        void setData(const void *data, const size_t size, const size_t offset = 0) const;
+        void bind() const;
+
+        size_t getSize() const { return m_size; }
+
+    private:
+        unsigned int m_id = 0;
+        size_t m_size = 0;
+        UniformBlockBinding m_binding;
+    };
+}
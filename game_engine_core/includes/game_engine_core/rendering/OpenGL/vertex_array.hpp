@@ -20,10 +20,12 @@ namespace game_engine {
         void bind() const;
         static void unbind();
         size_t getIndicesCount() const { return m_indicesCount; }
+        unsigned int getId() const { return m_id; }
 
     private:
         unsigned int m_id = 0;
         unsigned int m_elementsCount = 0;
+        unsigned int m_bindingsCount = 0;
         size_t m_indicesCount = 0;
     };
 }
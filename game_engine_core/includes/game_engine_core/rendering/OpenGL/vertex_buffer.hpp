@@ -1,6 +1,8 @@
 #pragma once
 
 #include <vector>
+#include <cstdint>
+#include <cstddef>
 
 namespace game_engine {
     enum class ShaderDataType {
@@ -12,16 +14,19 @@ namespace game_engine {
         Int2,
         Int3,
         Int4,
+        Mat4,
     };
 
     struct BufferElement {
         ShaderDataType m_type;
         uint32_t m_componentType;
         size_t m_componentsCount;
+        size_t m_slotsCount;
         size_t m_size;
         size_t m_offset;
+        unsigned int m_divisor;
 
-        BufferElement(const ShaderDataType type);
+        BufferElement(const ShaderDataType type, const unsigned int divisor = 0);
     };
 
     class BufferLayout {
@@ -64,13 +69,17 @@ namespace game_engine {
         VertexBuffer &operator=(VertexBuffer &&vertexBuffer) noexcept;
         VertexBuffer(VertexBuffer &&vertexBuffer) noexcept;
 
+        void setData(const void *data, const size_t size, const size_t offset = 0) const;
         void bind() const;
         static void unbind();
 
         const BufferLayout &getLayout() const { return m_bufferLayout; }
+        unsigned int getId() const { return m_id; }
+        size_t getSize() const { return m_size; }
 
     private:
         unsigned int m_id = 0;
+        size_t m_size = 0;
         BufferLayout m_bufferLayout;
     };
 }
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace game_engine {
+    struct ImageColor {
+        unsigned char red = 0;
+        unsigned char green = 0;
+        unsigned char blue = 0;
+        unsigned char alpha = 255;
+    };
+
+    struct ImageView {
+        unsigned char *data = nullptr;
+        unsigned int width = 0;
+        unsigned int height = 0;
+        unsigned int channels = 3;
+        size_t rowPitch = 0;
+
+        size_t getRowPitch() const {
+            return rowPitch > 0 ? rowPitch : static_cast<size_t>(width) * channels;
+        }
+    };
+
+    enum class ProceduralLayerType {
+        Fill = 0,
+        Rectangle,
+        Circle,
+        Checker,
+        Noise
+    };
+
+    struct ProceduralLayer {
+        ProceduralLayerType type = ProceduralLayerType::Fill;
+        int x = 0;
+        int y = 0;
+        unsigned int width = 0;
+        unsigned int height = 0;
+        unsigned int octaves = 0;
+        uint32_t seed = 0;
+        ImageColor colors[2];
+    };
+
+    class ProceduralImage {
+    public:
+        static constexpr unsigned int s_defaultTileRows = 32;
+
+        void addFill(const ImageColor &color);
+        void addRectangle(const int x, const int y,
+                          const unsigned int width, const unsigned int height,
+                          const ImageColor &color);
+        void addCircle(const int centerX, const int centerY, const unsigned int radius,
+                       const ImageColor &color);
+        void addChecker(const unsigned int cellWidth, const unsigned int cellHeight,
+                        const ImageColor &evenColor, const ImageColor &oddColor);
+        void addNoise(const unsigned int cellSize, const unsigned int octaves,
+                      const uint32_t seed, const ImageColor &lowColor,
+                      const ImageColor &highColor);
+        void clear();
+
+        size_t getLayersCount() const { return m_layers.size(); }
+
+        bool generate(const ImageView &image,
+                      const unsigned int tileRows = s_defaultTileRows) const;
+        void generateRows(const ImageView &image,
+                          const unsigned int beginRow, const unsigned int endRow) const;
+
+        static void fillSpan(unsigned char *row, const unsigned int begin, const unsigned int end,
+                             const unsigned int channels, const ImageColor &color);
+
+    private:
+        std::vector<ProceduralLayer> m_layers;
+    };
+}
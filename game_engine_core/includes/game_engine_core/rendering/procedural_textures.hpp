@@ -0,0 +1,26 @@
+#pragma once
+
+#include "game_engine_core/rendering/procedural_image.hpp"
+
+namespace game_engine {
+    void generateCircle(unsigned char *data,
+                        const unsigned int width,
+                        const unsigned int height,
+                        const unsigned int centerX,
+                        const unsigned int centerY,
+                        const unsigned int radius,
+                        const unsigned char colorRed,
+                        const unsigned char colorGreen,
+                        const unsigned char colorBlue);
+
+    void generateSmileTexture(unsigned char *data,
+                              const unsigned int width,
+                              const unsigned int height);
+
+    void generateQuadsTexture(unsigned char *data,
+                              const unsigned int width,
+                              const unsigned int height);
+
+    bool generateSmileTexture(const ImageView &image);
+    bool generateQuadsTexture(const ImageView &image);
+}
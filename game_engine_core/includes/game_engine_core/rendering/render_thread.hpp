@@ -0,0 +1,25 @@
+#pragma once
+
+#include <functional>
+#include <cstddef>
+
+namespace game_engine {
+    class Window;
+
+    class RenderThread {
+    public:
+        static constexpr size_t s_framesInFlightCount = 2;
+
+        static bool start(Window &window);
+        static void stop();
+
+        static bool isRunning();
+        static bool isRenderThread();
+        static void setContextThread();
+
+        static void enqueue(std::function<void()> command);
+        static void releaseResource(std::function<void()> release);
+        static void endFrame();
+        static void flush();
+    };
+}
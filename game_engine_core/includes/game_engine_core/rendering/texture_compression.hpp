@@ -0,0 +1,18 @@
+#pragma once
+
+#include "game_engine_core/rendering/texture_format.hpp"
+#include "game_engine_core/rendering/texture_container.hpp"
+#include "game_engine_core/rendering/procedural_image.hpp"
+
+#include <vector>
+
+namespace game_engine {
+    bool downsampleTextureLevel(const ImageView &source, const ImageView &destination,
+                                const bool isSRGB);
+    bool encodeTextureLevel(const ImageView &source, const TextureFormat format,
+                            std::vector<unsigned char> &output);
+    bool decodeTextureLevel(const TextureLevel &level, const TextureFormat format,
+                            const ImageView &destination);
+    bool cookTexture(const ImageView &source, const TextureFormat format,
+                     const bool generateMipmaps, TextureContainer &container);
+}
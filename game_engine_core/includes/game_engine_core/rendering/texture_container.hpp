@@ -0,0 +1,43 @@
+#pragma once
+
+#include "game_engine_core/rendering/texture_format.hpp"
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace game_engine {
+    struct TextureLevel {
+        unsigned int width = 0;
+        unsigned int height = 0;
+        std::vector<unsigned char> data;
+    };
+
+    class TextureContainer {
+    public:
+        static constexpr uint32_t s_fileMagic = 0x58544547;
+        static constexpr uint32_t s_fileVersion = 1;
+        static constexpr size_t s_levelAlignment = 16;
+
+        void reset(const TextureFormat format, const unsigned int width, const unsigned int height);
+        bool addLevel(std::vector<unsigned char> data);
+
+        TextureFormat getFormat() const { return m_format; }
+        unsigned int getWidth() const { return m_width; }
+        unsigned int getHeight() const { return m_height; }
+        size_t getLevelsCount() const { return m_levels.size(); }
+        const TextureLevel &getLevel(const size_t index) const { return m_levels[index]; }
+        size_t getDataSize() const;
+        bool isEmpty() const { return m_levels.empty(); }
+
+        bool save(const std::string &path) const;
+        bool load(const std::string &path);
+
+    private:
+        TextureFormat m_format = TextureFormat::RGBA8;
+        unsigned int m_width = 0;
+        unsigned int m_height = 0;
+        std::vector<TextureLevel> m_levels;
+    };
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+namespace game_engine {
+    enum class TextureFormat : uint32_t {
+        R8 = 0,
+        RG8,
+        RGB8,
+        RGBA8,
+        SRGB8_ALPHA8,
+        RGBA16F,
+        BC1,
+        BC1_SRGB,
+        BC3,
+        BC3_SRGB,
+        BC4,
+        BC5,
+        BC7,
+        BC7_SRGB,
+
+        FormatsCount
+    };
+
+    struct TextureFormatInfo {
+        const char *name;
+        unsigned int blockSize;
+        unsigned int bytesPerBlock;
+        unsigned int channels;
+        bool isCompressed;
+        bool isSRGB;
+    };
+
+    const TextureFormatInfo &getTextureFormatInfo(const TextureFormat format);
+    bool findTextureFormat(const char *name, TextureFormat &format);
+
+    unsigned int calculateMipLevelsCount(const unsigned int width, const unsigned int height);
+    size_t calculateTextureLevelSize(const TextureFormat format,
+                                     const unsigned int width, const unsigned int height);
+    size_t calculateTextureMemorySize(const TextureFormat format,
+                                      const unsigned int width, const unsigned int height,
+                                      const unsigned int levelsCount);
+}
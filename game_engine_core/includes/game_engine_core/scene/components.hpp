@@ -0,0 +1,36 @@
+#pragma once
+
+#include "glm/vec3.hpp"
+#include "glm/mat4x4.hpp"
+
+#include <array>
+
+namespace game_engine {
+    class VertexArray;
+    class ShaderProgram;
+    class Texture2D;
+
+    struct TransformComponent {
+        glm::vec3 position{0.0f};
+        glm::vec3 rotation{0.0f};
+        glm::vec3 scale{1.0f};
+
+        glm::mat4 getModelMatrix() const;
+    };
+
+    struct PreviousTransformComponent {
+        TransformComponent transform;
+    };
+
+    TransformComponent interpolateTransform(const TransformComponent &previous,
+                                            const TransformComponent &current,
+                                            const float alpha);
+
+    struct MeshComponent {
+        static constexpr size_t s_maxTexturesCount = 2;
+
+        const VertexArray *vertexArray = nullptr;
+        const ShaderProgram *shaderProgram = nullptr;
+        std::array<const Texture2D*, s_maxTexturesCount> textures{};
+    };
+}
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "game_engine_core/event.hpp"
+#include "game_engine_core/frame_limiter.hpp"
+#include "game_engine_core/window_backend.hpp"
 
 #include <string>
 #include <functional>
@@ -12,9 +14,8 @@ struct GLFWwindow;
 namespace game_engine {
     class Window {
     public:
-        using EventCallbackFunction = std::function<void(BaseEvent&)>;
-
-        Window(std::string title, const unsigned int width, const unsigned int height);
+        Window(std::string title, const unsigned int width, const unsigned int height,
+               const WindowBackend backend = WindowBackend::Glfw);
         ~Window();
 
         Window(const Window&) = delete;
@@ -22,14 +23,27 @@ namespace game_engine {
         Window &operator=(const Window&) = delete;
         Window &operator=(Window&&) = delete;
 
+        bool isInitialized() const { return m_isInitialized; }
+        WindowBackend getBackend() const { return m_backend; }
+        bool isHeadless() const { return m_backend != WindowBackend::Glfw; }
+
         void onUpdate();
+        void swapBuffers();
+        void pollEvents();
+        void waitEvents(const double timeout);
+        void postEmptyEvent();
+        void makeContextCurrent();
+        void releaseContext();
+        void setVSyncMode(const VSyncMode mode);
+        VSyncMode getVSyncMode() const { return m_vSyncMode; }
+        bool isAdaptiveVSyncSupported() const { return m_isAdaptiveVSyncSupported; }
         unsigned int getWidth() const { return m_data.width; }
         unsigned int getHeight() const { return m_data.height; }
 
         glm::vec2 getCurrentCursorPosition() const;
 
-        void setEventCallback(const EventCallbackFunction &callback) {
-            m_data.eventCallbackFunction = callback;
+        void setEventDispatcher(EventDispatcher &eventDispatcher) {
+            m_data.eventDispatcher = &eventDispatcher;
         }
 
     private:
@@ -38,13 +52,18 @@ namespace game_engine {
             unsigned int width;
             unsigned int height;
 
-            EventCallbackFunction eventCallbackFunction;
+            EventDispatcher *eventDispatcher = nullptr;
         };
 
         int init();
+        int initHeadless();
         void shutdown();
 
         GLFWwindow *m_window = nullptr;
         WindowData m_data;
+        WindowBackend m_backend = WindowBackend::Glfw;
+        bool m_isInitialized = false;
+        VSyncMode m_vSyncMode = VSyncMode::On;
+        bool m_isAdaptiveVSyncSupported = false;
     };
 }
@@ -0,0 +1,8 @@
+#pragma once
+
+namespace game_engine {
+    enum class WindowBackend {
+        Glfw = 0,
+        HeadlessEGL
+    };
+}
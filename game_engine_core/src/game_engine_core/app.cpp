@@ -3,15 +3,38 @@
 #include "game_engine_core/window.hpp"
 #include "game_engine_core/event.hpp"
 #include "game_engine_core/input.hpp"
+#include "game_engine_core/profiler.hpp"
+#include "game_engine_core/frame_stats.hpp"
 
 #include "game_engine_core/rendering/OpenGL/shader_program.hpp"
 #include "game_engine_core/rendering/OpenGL/vertex_buffer.hpp"
 #include "game_engine_core/rendering/OpenGL/vertex_array.hpp"
 #include "game_engine_core/rendering/OpenGL/index_buffer.hpp"
 #include "game_engine_core/rendering/OpenGL/texture_2D.hpp"
+#include "game_engine_core/rendering/OpenGL/texture_2D_array.hpp"
+#include "game_engine_core/rendering/OpenGL/sampler_cache.hpp"
+#include "game_engine_core/rendering/OpenGL/uniform_buffer.hpp"
+#include "game_engine_core/rendering/OpenGL/render_queue.hpp"
+#include "game_engine_core/rendering/OpenGL/state_tracker_OpenGL.hpp"
+#include "game_engine_core/rendering/OpenGL/stream_buffer.hpp"
+#include "game_engine_core/rendering/OpenGL/geometry_arena.hpp"
+#include "game_engine_core/rendering/OpenGL/indirect_batch.hpp"
+#include "game_engine_core/rendering/OpenGL/gpu_culling.hpp"
+#include "game_engine_core/rendering/OpenGL/gpu_profiler.hpp"
+#include "game_engine_core/rendering/OpenGL/framebuffer.hpp"
+#include "game_engine_core/rendering/OpenGL/texture_streamer.hpp"
+#include "game_engine_core/rendering/OpenGL/texture_residency.hpp"
+#include "game_engine_core/rendering/procedural_textures.hpp"
+#include "game_engine_core/rendering/texture_compression.hpp"
+#include "game_engine_core/frustum.hpp"
+#include "game_engine_core/frustum_culling.hpp"
+#include "game_engine_core/scene/components.hpp"
+#include "game_engine_core/jobs/job_system.hpp"
 #include "game_engine_core/camera.hpp"
 #include "game_engine_core/rendering/OpenGL/renderer_OpenGL.hpp"
+#include "game_engine_core/rendering/render_thread.hpp"
 #include "game_engine_core/modules/UI_module.hpp"
+#include "game_engine_core/modules/performance_overlay.hpp"
 
 #include "imgui/imgui.h"
 #include "glm/mat3x3.hpp"
@@ -20,6 +43,12 @@
 #include "GLFW/glfw3.h"
 
 #include <iostream>
+#include <algorithm>
+#include <array>
+#include <vector>
+#include <new>
+#include <cmath>
+#include <cstring>
 
 namespace game_engine {
     GLfloat positionsCoords[] = {
@@ -43,78 +72,18 @@ namespace game_engine {
         1, 5, 0, 5, 0, 4
     };
 
-    void generateCircle(unsigned char *data,
-                        const unsigned int width,
-                        const unsigned int height,
-                        const unsigned int centerX,
-                        const unsigned int centerY,
-                        const unsigned int radius,
-                        const unsigned char colorRed,
-                        const unsigned char colorGreen,
-                        const unsigned char colorBlue) {
-        for (unsigned int x = 0; x < width; ++x) {
-            for (unsigned int y = 0; y < height; ++y) {
-                if ((x - centerX) * (x - centerY) + (y - centerY) * (y - centerY) <
-                     radius * radius) {
-                    data[3 * (x + width * y) + 0] = colorRed;
-                    data[3 * (x + width * y) + 1] = colorGreen;
-                    data[3 * (x + width * y) + 2] = colorBlue;
-                }
-            }
-        }
-    }
-
-    void generateSmileTexture(unsigned char *data,
-                              const unsigned int width,
-                              const unsigned int height) {
-        for (unsigned int x = 0; x < width; ++x) {
-            for (unsigned int y = 0; y < height; ++y) {
-                data[3 * (x + width * y) + 0] = 200;
-                data[3 * (x + width * y) + 1] = 191;
-                data[3 * (x + width * y) + 2] = 231;
-            }
-        }
-
-        generateCircle(data, width, height, width * 0.5, height * 0.5, width * 0.4,
-                       255, 255, 0);
-
-        generateCircle(data, width, height, width * 0.5, height * 0.4, width * 0.2,
-                       0, 0, 0);
-        generateCircle(data, width, height, width * 0.5, height * 0.45, width * 0.2,
-                       255, 255, 0);
-
-        generateCircle(data, width, height, width * 0.35, height * 0.6, width * 0.07,
-                       255, 0, 255);
-        generateCircle(data, width, height, width * 0.65, height * 0.6, width * 0.07,
-                       0, 0, 255);
-    }
-
-        void generateQuadsTexture(unsigned char *data,
-                                    const unsigned int width,
-                                    const unsigned int height) {
-        for (unsigned int x = 0; x < width; ++x) {
-            for (unsigned int y = 0; y < height; ++y) {
-                if ((x < width / 2 && y < height / 2) || x >= width / 2 &&
-                     y >= height / 2) {
-                    data[3 * (x + width * y) + 0] = 0;
-                    data[3 * (x + width * y) + 1] = 0;
-                    data[3 * (x + width * y) + 2] = 0;
-                } else {
-                    data[3 * (x + width * y) + 0] = 255;
-                    data[3 * (x + width * y) + 1] = 255;
-                    data[3 * (x + width * y) + 2] = 255;
-                }
-            }
-        }
-    }
-
     const char *vertexShader =
-        R"(#version 460
+        R"(#version 450
             layout(location = 0) in vec3 vertex_position;
             layout(location = 1) in vec2 texture_coord;
 
             uniform mat4 model_matrix;
-            uniform mat4 view_projection_matrix;
+            layout(std140) uniform CameraData {
+                mat4 view_matrix;
+                mat4 projection_matrix;
+                mat4 view_projection_matrix;
+                vec4 camera_position;
+            };
             uniform int current_frame;
 
             out vec2 texture_coord_smile;
@@ -130,7 +99,7 @@ namespace game_engine {
         )";
 
     const char *fragmentShader =
-        R"(#version 460
+        R"(#version 450
             in vec2 texture_coord_smile;
             in vec2 texture_coord_quads;
 
@@ -145,19 +114,151 @@ namespace game_engine {
             }
         )";
 
+    const char *instancedVertexShader =
+        R"(#version 450
+            layout(location = 0) in vec3 vertex_position;
+            layout(location = 1) in vec2 texture_coord;
+            layout(location = 2) in mat4 instance_model_matrix;
+
+            layout(std140) uniform CameraData {
+                mat4 view_matrix;
+                mat4 projection_matrix;
+                mat4 view_projection_matrix;
+                vec4 camera_position;
+            };
+            uniform int current_frame;
+
+            out vec2 texture_coord_smile;
+            out vec2 texture_coord_quads;
+
+            void main() {
+                texture_coord_smile = texture_coord;
+                texture_coord_quads = texture_coord +
+                    vec2(current_frame / 1000.0f, current_frame / 1000.0f);
+                gl_Position = view_projection_matrix * instance_model_matrix *
+                    vec4(vertex_position, 1.0);
+            }
+        )";
+
+    const char *indirectVertexShader =
+        R"(#version 450
+            #extension GL_ARB_shader_draw_parameters : require
+            layout(location = 0) in vec3 vertex_position;
+            layout(location = 1) in vec2 texture_coord;
+
+            layout(std140) uniform CameraData {
+                mat4 view_matrix;
+                mat4 projection_matrix;
+                mat4 view_projection_matrix;
+                vec4 camera_position;
+            };
+
+            struct DrawData {
+                mat4 model_matrix;
+                uint material_index;
+            };
+
+            layout(std430, binding = 0) readonly buffer DrawDataBuffer {
+                DrawData draws[];
+            };
+
+            uniform int current_frame;
+
+            out vec2 texture_coord_smile;
+            out vec2 texture_coord_quads;
+            flat out uvec2 material_layers;
+
+            const uint material_layers_count = 2u;
+
+            void main() {
+                const DrawData draw = draws[gl_BaseInstanceARB + gl_InstanceID];
+
+                material_layers = uvec2(draw.material_index, draw.material_index + 1u) %
+                    material_layers_count;
+                texture_coord_smile = texture_coord;
+                texture_coord_quads = texture_coord +
+                    vec2(current_frame / 1000.0f, current_frame / 1000.0f);
+                gl_Position = view_projection_matrix * draw.model_matrix *
+                    vec4(vertex_position, 1.0);
+            }
+        )";
+
+    const char *indirectFragmentShader =
+        R"(#version 450
+            in vec2 texture_coord_smile;
+            in vec2 texture_coord_quads;
+            flat in uvec2 material_layers;
+
+            layout (binding = 0) uniform sampler2DArray InMaterialTextures;
+
+            out vec4 fragment_color;
+
+            void main() {
+                fragment_color =
+                    texture(InMaterialTextures, vec3(texture_coord_smile, material_layers.x)) *
+                    texture(InMaterialTextures, vec3(texture_coord_quads, material_layers.y));
+            }
+        )";
+
     std::unique_ptr<ShaderProgram> shaderProgram;
     std::unique_ptr<VertexBuffer> cubePositionsVBO;
     std::unique_ptr<IndexBuffer> cubeIndexBuffer;
-    std::unique_ptr<Texture2D> textureSmile;
-    std::unique_ptr<Texture2D> textureQuads;
+    StreamedTextureHandle textureSmile;
+    StreamedTextureHandle textureQuads;
+    std::array<std::shared_ptr<TextureContainer>, MeshComponent::s_maxTexturesCount>
+        cookedMeshTextures;
+    JobCounter meshTexturesCookCounter;
+    bool areMeshTexturesApplied = false;
     std::unique_ptr<VertexArray> vao;
+    std::unique_ptr<StreamBuffer> frameStreamBuffer;
+    int modelMatrixLocation = -1;
+    int currentFrameLocation = -1;
+
+    std::unique_ptr<ShaderProgram> instancedShaderProgram;
+    std::unique_ptr<VertexBuffer> benchmarkInstancesVBO;
+    std::unique_ptr<VertexArray> benchmarkVAO;
+    std::vector<glm::mat4> benchmarkModelMatrices;
+    int instancedCurrentFrameLocation = -1;
+
+    std::unique_ptr<ShaderProgram> indirectShaderProgram;
+    std::unique_ptr<GeometryArena> geometryArena;
+    std::unique_ptr<IndirectBatch> benchmarkIndirectBatch;
+    int indirectCurrentFrameLocation = -1;
+    std::unique_ptr<Texture2DArray> materialTextureArray;
+    bool areMaterialLayersCopied = false;
+
+    std::unique_ptr<GpuCulling> benchmarkGpuCulling;
+
+    std::unique_ptr<VertexBuffer> culledInstancesVBO;
+    std::unique_ptr<VertexArray> culledBenchmarkVAO;
+
+    std::unique_ptr<Framebuffer> offscreenFramebuffer;
+    FrustumCuller benchmarkCuller;
+    std::vector<uint32_t> benchmarkVisibleIndices;
 
-    float scale[3] = { 1.0f, 1.0f, 1.0f };
-    float rotate = 0.0f;
-    float translate[3] = { 0.0f, 0.0f, 0.0f };
     float backgroundColor[4] = { 0.33f, 0.33f, 0.33f, 0.0f };
 
-    std::array<glm::vec3, 5> positions = {
+    struct FrameData {
+        RenderQueue renderQueue;
+        CameraUniformBlock cameraBlock;
+        Frustum frustum;
+        std::array<float, 4> clearColor{};
+        int currentFrame = 0;
+        bool benchmarkScene = false;
+        BenchmarkRenderMode benchmarkRenderMode = BenchmarkRenderMode::Instanced;
+        size_t benchmarkObjectsCount = 0;
+        std::vector<glm::mat4> visibleModelMatrices;
+        std::vector<TextureResidencyRequest> residencyRequests;
+        UIDrawSnapshot uiSnapshot;
+    };
+
+    std::array<FrameData, RenderThread::s_framesInFlightCount + 1> frames;
+    size_t recordingFrameIndex = 0;
+    int currentFrame = 0;
+
+    MeshComponent cubeMesh;
+
+    std::array<glm::vec3, 5> initialCubePositions = {
         glm::vec3(-2.f, -2.f, -4.f),
         glm::vec3(-5.f,  0.f,  3.f),
         glm::vec3(2.f,  1.f, -2.f),
@@ -165,94 +266,489 @@ namespace game_engine {
         glm::vec3(1.f, -7.f,  1.f)
     };
 
+    constexpr size_t s_frameStreamBufferRegionSize = 64 * 1024;
+    constexpr size_t s_geometryArenaMaxVerticesCount = 64 * 1024;
+    constexpr size_t s_geometryArenaMaxIndicesCount = 256 * 1024;
+    constexpr size_t s_gatherBatchSize = 4096;
+    constexpr float s_meshTextureWorldSize = 2.0f;
+
+    std::vector<glm::mat4> generateBenchmarkModelMatrices(const size_t count) {
+        const size_t rowsCount = 100;
+        const size_t columnsCount = 100;
+        const float spacing = 3.0f;
+
+        std::vector<glm::mat4> modelMatrices;
+        modelMatrices.reserve(count);
+
+        for (size_t i = 0; i < count; ++i) {
+            const size_t column = i % columnsCount;
+            const size_t row = (i / columnsCount) % rowsCount;
+            const size_t layer = i / (columnsCount * rowsCount);
+
+            modelMatrices.emplace_back(1, 0, 0, 0,
+                                       0, 1, 0, 0,
+                                       0, 0, 1, 0,
+                                       5.0f + spacing * layer,
+                                       spacing * (static_cast<float>(column) - columnsCount * 0.5f),
+                                       spacing * (static_cast<float>(row) - rowsCount * 0.5f), 1);
+        }
+
+        return modelMatrices;
+    }
+
+    void cookMeshTexture(std::shared_ptr<TextureContainer> container,
+                         const unsigned int width, const unsigned int height,
+                         const TextureFormat format, TextureDecoder generator) {
+        JobSystem::run([container, width, height, format, generator = std::move(generator)]() {
+            std::vector<unsigned char> pixels(static_cast<size_t>(width) * height * 4);
+            const ImageView image{ pixels.data(), width, height, 4 };
+
+            if (!generator(image) || !cookTexture(image, format, true, *container)) {
+                LOG_CATEGORY_ERROR(Render, "Failed to cook a {0}x{1} mesh texture", width, height);
+
+                *container = TextureContainer{};
+            }
+        }, &meshTexturesCookCounter);
+    }
+
+    void applyMeshTextures(World &world) {
+        const std::array<const Texture2D*, MeshComponent::s_maxTexturesCount> placeholders =
+            cubeMesh.textures;
+
+        for (size_t i = 0; i < cookedMeshTextures.size(); ++i) {
+            if (cookedMeshTextures[i] && !cookedMeshTextures[i]->isEmpty()) {
+                const Texture2D *texture = TextureResidency::add(cookedMeshTextures[i]);
+
+                if (texture != nullptr) {
+                    cubeMesh.textures[i] = texture;
+                }
+            }
+
+            cookedMeshTextures[i] = nullptr;
+        }
+
+        world.each<MeshComponent>([&placeholders](const Entity, MeshComponent &mesh) {
+            if (mesh.textures == placeholders) {
+                mesh.textures = cubeMesh.textures;
+            }
+        });
+    }
+
+    template<typename T>
+    void addInputRecordingListener(EventDispatcher &eventDispatcher, InputRecording &recording,
+                                   const InputRecordingMode &mode) {
+        eventDispatcher.addEventListener<T>([&recording, &mode](T &event) {
+            if (mode == InputRecordingMode::Recording) {
+                recording.record(event);
+            }
+        }, App::s_inputRecordingListenerPriority);
+    }
+
     App::App() {
+        Log::initialize();
+
         LOG_INFO("Starting application");
     }
 
     App::~App() {
         LOG_INFO("Closing application");
+
+        JobSystem::shutdown();
+
+        Log::shutdown();
     }
 
     void App::draw() {
-        RendererOpenGL::setClearColor(backgroundColor[0], backgroundColor[1],
-                                      backgroundColor[2], backgroundColor[3]);
+        PROFILE_SCOPE("App::draw");
+
+        if (benchmarkScene && !isBenchmarkRenderModeSupported(benchmarkRenderMode)) {
+            LOG_WARNING("Benchmark render mode {0} is unavailable, falling back to per object "
+                        "rendering", static_cast<int>(benchmarkRenderMode));
+            benchmarkRenderMode = BenchmarkRenderMode::PerObject;
+        }
+
+        FrameData &frame = frames[recordingFrameIndex];
+        recordingFrameIndex = (recordingFrameIndex + 1) % frames.size();
+
+        frame.cameraBlock = CameraUniformBlock{
+            camera.getViewMatrix(),
+            camera.getProjectionMatrix(),
+            camera.getViewProjectionMatrix(),
+            glm::vec4(camera.getPosition(), 1.0f)
+        };
+        frame.frustum = Frustum::fromMatrix(camera.getViewProjectionMatrix());
+        frame.clearColor = { backgroundColor[0], backgroundColor[1],
+                             backgroundColor[2], backgroundColor[3] };
+        frame.currentFrame = currentFrame++;
+        frame.benchmarkScene = benchmarkScene;
+        frame.benchmarkRenderMode = benchmarkRenderMode;
+        frame.benchmarkObjectsCount = std::min(static_cast<size_t>(benchmarkObjectsCount),
+                                               benchmarkModelMatrices.size());
+        frame.visibleModelMatrices.clear();
+        frame.residencyRequests.clear();
+
+        if (!areMeshTexturesApplied && meshTexturesCookCounter.isDone()) {
+            applyMeshTextures(scene);
+            areMeshTexturesApplied = true;
+        }
+
+        {
+            PROFILE_SCOPE("Submit scene");
+
+            frame.renderQueue.begin(camera.getFarClipPlane());
+            scene.each<TransformComponent, PreviousTransformComponent, MeshComponent>(
+                [this, &frame](const Entity,
+                               const TransformComponent &transform,
+                               const PreviousTransformComponent &previousTransform,
+                               const MeshComponent &mesh) {
+                const TransformComponent interpolatedTransform =
+                    interpolateTransform(previousTransform.transform, transform,
+                                         m_interpolationAlpha);
+
+                submitMesh(frame, interpolatedTransform.getModelMatrix(), mesh);
+            });
+
+            if (benchmarkScene) {
+                submitBenchmarkScene(frame);
+            }
+        }
+
+        RenderThread::enqueue([this, &frame]() {
+            renderFrame(frame);
+        });
+
+        {
+            PROFILE_SCOPE("UI build");
+
+            UIModule::onUIDrawBegin();
+            onUIDraw();
+
+            if (showPerformanceOverlay) {
+                PerformanceOverlay::draw(showPerformanceOverlay);
+            }
+        }
+
+        if (RenderThread::isRunning()) {
+            UIModule::onUIDrawEnd(frame.uiSnapshot);
+
+            RenderThread::enqueue([&frame]() {
+                UIModule::renderSnapshot(frame.uiSnapshot);
+            });
+            RenderThread::enqueue([window = m_window.get()]() {
+                window->swapBuffers();
+            });
+            RenderThread::endFrame();
+
+            m_window->pollEvents();
+        } else {
+            UIModule::onUIDrawEnd();
+
+            m_window->onUpdate();
+            RenderThread::endFrame();
+        }
+
+        processEvents();
+
+        PROFILE_SCOPE("App::onUpdate");
+        onUpdate(m_updateDeltaTime);
+    }
+
+    void App::runFixedUpdates(const double deltaTime) {
+        PROFILE_SCOPE("App::runFixedUpdates");
+
+        m_fixedTimeAccumulator += std::min(deltaTime, s_maxFrameDeltaTime);
+
+        while (m_fixedTimeAccumulator >= fixedTimeStep) {
+            scene.eachChunk<TransformComponent, PreviousTransformComponent>(
+                [](const size_t count, const Entity*, const TransformComponent *transforms,
+                   PreviousTransformComponent *previousTransforms) {
+                for (size_t i = 0; i < count; ++i) {
+                    previousTransforms[i].transform = transforms[i];
+                }
+            });
+
+            onFixedUpdate(fixedTimeStep);
+
+            m_fixedTimeAccumulator -= fixedTimeStep;
+        }
+
+        m_interpolationAlpha = static_cast<float>(m_fixedTimeAccumulator / fixedTimeStep);
+    }
+
+    void App::processEvents() {
+        PROFILE_SCOPE("App::processEvents");
+
+        if (m_eventDispatcher.getQueuedEventsCount() > 0) {
+            m_isRedrawRequested = true;
+        }
+
+        m_eventDispatcher.dispatchQueued();
+    }
+
+    bool App::isRedrawNeeded() {
+        if (m_isRedrawRequested.exchange(false) || UIModule::needsRedraw()) {
+            m_pendingRedrawFramesCount = s_idleSettleFramesCount;
+        }
+
+        if (scene.getStructuralVersion() != m_lastSceneVersion) {
+            m_lastSceneVersion = scene.getStructuralVersion();
+            m_pendingRedrawFramesCount = s_idleSettleFramesCount;
+        }
+
+        const glm::mat4 &viewProjectionMatrix = camera.getViewProjectionMatrix();
+        if (std::memcmp(&viewProjectionMatrix, &m_lastViewProjectionMatrix,
+                        sizeof(glm::mat4)) != 0) {
+            m_lastViewProjectionMatrix = viewProjectionMatrix;
+            m_pendingRedrawFramesCount = s_idleSettleFramesCount;
+        }
+
+        if (idleAnimationFrameRate > 0.0) {
+            const FrameTimer::Clock::time_point now = FrameTimer::Clock::now();
+
+            if (std::chrono::duration<double>(now - m_lastAnimationTickTime).count() >=
+                1.0 / idleAnimationFrameRate) {
+                m_lastAnimationTickTime = now;
+
+                return true;
+            }
+        }
+
+        if (m_pendingRedrawFramesCount > 0) {
+            --m_pendingRedrawFramesCount;
+
+            return true;
+        }
+
+        return false;
+    }
+
+    double App::getIdleWaitTimeout() const {
+        if (idleAnimationFrameRate <= 0.0) {
+            return s_idleWaitTimeout;
+        }
+
+        const double sinceAnimationTick = std::chrono::duration<double>(
+            FrameTimer::Clock::now() - m_lastAnimationTickTime).count();
+
+        return std::clamp(1.0 / idleAnimationFrameRate - sinceAnimationTick, 0.0,
+                          s_idleWaitTimeout);
+    }
+
+    void App::renderFrame(FrameData &frame) {
+        PROFILE_SCOPE("App::renderFrame");
+        PROFILE_GPU_FRAME();
+        PROFILE_GPU_SCOPE("Scene");
+
+        if (offscreenFramebuffer) {
+            offscreenFramebuffer->bind();
+        }
+
+        StateTrackerOpenGL::beginFrame();
+        TextureStreamer::update();
+        TextureResidency::update(frame.residencyRequests);
+
+        if (!areMaterialLayersCopied && textureSmile->isReady() && textureQuads->isReady()) {
+            const std::array<const Texture2D*, 2> materialLayers = { textureSmile->getTexture(),
+                                                                     textureQuads->getTexture() };
+            areMaterialLayersCopied = true;
+
+            for (unsigned int layer = 0; layer < materialLayers.size(); ++layer) {
+                if (!materialTextureArray->copyLayer(layer, *materialLayers[layer])) {
+                    LOG_CATEGORY_WARNING(Render, "Failed to copy material layer {0}, retrying "
+                                         "next frame", layer);
+                    areMaterialLayersCopied = false;
+                }
+            }
+        }
+
+        RendererOpenGL::setClearColor(frame.clearColor[0], frame.clearColor[1],
+                                      frame.clearColor[2], frame.clearColor[3]);
         RendererOpenGL::clear();
 
-        shaderProgram->bind();
+        frameStreamBuffer->beginFrame();
 
-        glm::mat4 scaleMatrix(scale[0], 0, 0, 0,
-                              0, scale[1], 0, 0,
-                              0, 0, scale[2], 0,
-                              0, 0, 0, 1);
+        size_t cameraBlockOffset = 0;
+        if (void *cameraBlockData = frameStreamBuffer->allocate(sizeof(CameraUniformBlock),
+                RendererOpenGL::getUniformBufferOffsetAlignment(), cameraBlockOffset)) {
+            new (cameraBlockData) CameraUniformBlock{frame.cameraBlock};
 
-        float rotateInRadians = glm::radians(rotate);
-        glm::mat4 rotateMatrix(cos(rotateInRadians), sin(rotateInRadians), 0, 0,
-                               -sin(rotateInRadians), cos(rotateInRadians), 0, 0,
-                               0, 0, 1, 0,
-                               0, 0, 0, 1);
+            frameStreamBuffer->bindRange(BufferTarget::Uniform,
+                                         static_cast<unsigned int>(UniformBlockBinding::Camera),
+                                         cameraBlockOffset, sizeof(CameraUniformBlock));
+        }
 
-        glm::mat4 translateMatrix(1, 0, 0, 0,
-                                  0, 1, 0, 0,
-                                  0, 0, 1, 0,
-                                  translate[0], translate[1], translate[2], 1);
+        shaderProgram->setInt(currentFrameLocation, frame.currentFrame);
 
-        glm::mat4 modelMatrix = translateMatrix * rotateMatrix * scaleMatrix;
-        shaderProgram->setMatrix_4("model_matrix", modelMatrix);
-        static int currentFrame = 0;
-        shaderProgram->setInt("current_frame", currentFrame++);
+        if (instancedShaderProgram) {
+            instancedShaderProgram->setInt(instancedCurrentFrameLocation, frame.currentFrame);
+        }
 
-        shaderProgram->setMatrix_4("view_projection_matrix",
-                                    camera.getProjectionMatrix() * camera.getViewMatrix());
-        RendererOpenGL::draw(*vao);
+        if (indirectShaderProgram) {
+            indirectShaderProgram->setInt(indirectCurrentFrameLocation, frame.currentFrame);
+        }
 
-        for (const glm::vec3 &currentPosition : positions) {
-            glm::mat4 translateMatrix(1, 0, 0, 0,
-                                      0, 1, 0, 0,
-                                      0, 0, 1, 0,
-                                      currentPosition[0], currentPosition[1],
-                                          currentPosition[2], 1);
+        if (!frame.visibleModelMatrices.empty()) {
+            culledInstancesVBO->setData(frame.visibleModelMatrices.data(),
+                frame.visibleModelMatrices.size() * sizeof(glm::mat4));
+        }
 
-            shaderProgram->setMatrix_4("model_matrix", translateMatrix);
-            RendererOpenGL::draw(*vao);
+        frame.renderQueue.execute();
+
+        if (frame.benchmarkScene &&
+            frame.benchmarkRenderMode == BenchmarkRenderMode::MultiDrawIndirect) {
+            drawBenchmarkSceneIndirect(frame);
         }
 
-        UIModule::onUIDrawBegin();
-        onUIDraw();
-        UIModule::onUIDrawEnd();
+        if (frame.benchmarkScene && frame.benchmarkRenderMode == BenchmarkRenderMode::GpuCulled) {
+            drawBenchmarkSceneGpuCulled(frame);
+        }
 
-        m_window->onUpdate();
-        onUpdate();
+        frameStreamBuffer->endFrame();
+    }
+
+    void App::submitMesh(FrameData &frame, const glm::mat4 &modelMatrix,
+                         const MeshComponent &mesh) {
+        DrawPacket packet;
+        packet.vertexArray = mesh.vertexArray;
+        packet.shaderProgram = mesh.shaderProgram;
+        packet.textures = mesh.textures;
+        packet.modelMatrix = modelMatrix;
+        packet.depth = glm::length(glm::vec3(modelMatrix[3]) - camera.getPosition());
+
+        frame.renderQueue.submit(packet);
+
+        if (TextureResidency::isActive()) {
+            const float scale = std::max({ glm::length(glm::vec3(modelMatrix[0])),
+                                           glm::length(glm::vec3(modelMatrix[1])),
+                                           glm::length(glm::vec3(modelMatrix[2])) });
+            const float screenSize = TextureResidency::calculateScreenSize(
+                s_meshTextureWorldSize * scale, packet.depth, camera.getProjectionMatrix()[1][1],
+                static_cast<float>(m_window->getHeight()));
+
+            for (const Texture2D *texture : mesh.textures) {
+                if (texture != nullptr) {
+                    frame.residencyRequests.push_back(TextureResidencyRequest{ texture, screenSize });
+                }
+            }
+        }
+    }
+
+    void App::submitBenchmarkScene(FrameData &frame) {
+        const size_t objectsCount = frame.benchmarkObjectsCount;
+
+        if (frame.benchmarkRenderMode == BenchmarkRenderMode::Instanced) {
+            DrawPacket packet;
+            packet.vertexArray = benchmarkVAO.get();
+            packet.shaderProgram = instancedShaderProgram.get();
+            packet.textures = { textureSmile->getTexture(), textureQuads->getTexture() };
+            packet.instanceCount = objectsCount;
+
+            frame.renderQueue.submit(packet);
+
+            return;
+        }
+
+        if (frame.benchmarkRenderMode == BenchmarkRenderMode::CpuCulled) {
+            benchmarkCuller.cullSpheres(frame.frustum, objectsCount, benchmarkVisibleIndices);
+
+            if (benchmarkVisibleIndices.empty()) {
+                return;
+            }
+
+            std::vector<glm::mat4> &visibleModelMatrices = frame.visibleModelMatrices;
+            visibleModelMatrices.resize(benchmarkVisibleIndices.size());
+            JobSystem::parallelFor(benchmarkVisibleIndices.size(), s_gatherBatchSize,
+                                   [&visibleModelMatrices](const size_t begin, const size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    visibleModelMatrices[i] = benchmarkModelMatrices[benchmarkVisibleIndices[i]];
+                }
+            });
+
+            DrawPacket packet;
+            packet.vertexArray = culledBenchmarkVAO.get();
+            packet.shaderProgram = instancedShaderProgram.get();
+            packet.textures = { textureSmile->getTexture(), textureQuads->getTexture() };
+            packet.instanceCount = visibleModelMatrices.size();
+
+            frame.renderQueue.submit(packet);
+
+            return;
+        }
+
+        if (frame.benchmarkRenderMode == BenchmarkRenderMode::PerObject) {
+            for (size_t i = 0; i < objectsCount; ++i) {
+                submitMesh(frame, benchmarkModelMatrices[i], cubeMesh);
+            }
+        }
+    }
+
+    void App::drawBenchmarkSceneIndirect(const FrameData &frame) {
+        indirectShaderProgram->bind();
+        materialTextureArray->bind(0);
+        SamplerCache::bind(0, SamplerState{});
+        benchmarkIndirectBatch->submit(*geometryArena, frame.benchmarkObjectsCount);
+    }
+
+    void App::drawBenchmarkSceneGpuCulled(const FrameData &frame) {
+        {
+            PROFILE_GPU_SCOPE("GPU culling");
+
+            benchmarkGpuCulling->cull(frame.frustum, frame.benchmarkObjectsCount);
+        }
+
+        indirectShaderProgram->bind();
+        materialTextureArray->bind(0);
+        SamplerCache::bind(0, SamplerState{});
+        benchmarkGpuCulling->draw(*geometryArena);
     }
 
     int App::start(unsigned int windowWidth, unsigned int windowHeight,
-                   const char *title) {
-        m_window = std::make_unique<Window>(title, windowWidth, windowHeight);
+                   const char *title, const WindowBackend backend) {
+        m_window = std::make_unique<Window>(title, windowWidth, windowHeight, backend);
+
+        if (!m_window->isInitialized()) {
+            LOG_CRITICAL("Failed to create window {0}", title);
+            m_window = nullptr;
+
+            return -1;
+        }
+
+        if (m_window->isHeadless()) {
+            offscreenFramebuffer = std::make_unique<Framebuffer>(windowWidth, windowHeight);
+
+            if (!offscreenFramebuffer->isComplete()) {
+                offscreenFramebuffer = nullptr;
+                m_window = nullptr;
+
+                return -1;
+            }
+        }
+
         camera.setViewportSize(static_cast<float>(windowWidth),
                                static_cast<float>(windowHeight));
 
         m_eventDispatcher.addEventListener<EventMouseMoved>(
             [](EventMouseMoved &event) {
-                LOG_INFO("[MouseMoved] Mouse moved to {0}x{1}", event.x, event.y);
+                LOG_CATEGORY_INFO(Input, "[MouseMoved] Mouse moved to {0}x{1}", event.x, event.y);
             });
 
         m_eventDispatcher.addEventListener<EventWindowResize>(
             [&](EventWindowResize &event) {
-                LOG_INFO("[Resized] Changed size to {0}x{1}", event.width, event.height);
+                LOG_CATEGORY_INFO(Window, "[Resized] Changed size to {0}x{1}", event.width, event.height);
 
                 camera.setViewportSize(event.width, event.height);
-                draw();
             });
 
         m_eventDispatcher.addEventListener<EventWindowClose>(
             [&](EventWindowClose &event) {
-                LOG_INFO("[WindowClose]");
+                LOG_CATEGORY_INFO(Window, "[WindowClose]");
 
                 close();
             });
         
         m_eventDispatcher.addEventListener<EventMouseButtonPressed>(
             [&](EventMouseButtonPressed &event) {
-                LOG_INFO("[Mouse button pressed: {0}, at ({1}, {2})",
+                LOG_CATEGORY_INFO(Input, "[Mouse button pressed: {0}, at ({1}, {2})",
                           static_cast<size_t>(event.m_mouseButton),
                           event.m_positionX, event.m_positionY);
 
@@ -264,7 +760,7 @@ namespace game_engine {
 
         m_eventDispatcher.addEventListener<EventMouseButtonReleased>(
             [&](EventMouseButtonReleased &event) {
-                LOG_INFO("[Mouse button released: {0}, at ({1}, {2})",
+                LOG_CATEGORY_INFO(Input, "[Mouse button released: {0}, at ({1}, {2})",
                           static_cast<size_t>(event.m_mouseButton),
                           event.m_positionX, event.m_positionY);
 
@@ -278,9 +774,9 @@ namespace game_engine {
             [&](EventKeyPressed &event) {
                 if (event.m_keyCode <= KeyCode::KEY_Z) {
                     if (event.m_repeated) {
-                        LOG_INFO("[Key pressed: {0}, repeated", static_cast<char>(event.m_keyCode));
+                        LOG_CATEGORY_INFO(Input, "[Key pressed: {0}, repeated", static_cast<char>(event.m_keyCode));
                     } else {
-                        LOG_INFO("[Key pressed: {0}", static_cast<char>(event.m_keyCode));
+                        LOG_CATEGORY_INFO(Input, "[Key pressed: {0}", static_cast<char>(event.m_keyCode));
                     }
                 }
 
@@ -290,41 +786,73 @@ namespace game_engine {
         m_eventDispatcher.addEventListener<EventKeyReleased>(
             [&](EventKeyReleased &event) {
                 if (event.m_keyCode <= KeyCode::KEY_Z) {
-                    LOG_INFO("[Key released: {0}", static_cast<char>(event.m_keyCode));
+                    LOG_CATEGORY_INFO(Input, "[Key released: {0}", static_cast<char>(event.m_keyCode));
                 }
 
                 Input::releaseKey(event.m_keyCode);
             });
 
-        m_window->setEventCallback(
-            [&](BaseEvent &event) {
-                m_eventDispatcher.dispatch(event);
-            });
+        addInputRecordingListener<EventKeyPressed>(m_eventDispatcher, m_inputRecording,
+                                                   m_inputRecordingMode);
+        addInputRecordingListener<EventKeyReleased>(m_eventDispatcher, m_inputRecording,
+                                                    m_inputRecordingMode);
+        addInputRecordingListener<EventMouseButtonPressed>(m_eventDispatcher, m_inputRecording,
+                                                           m_inputRecordingMode);
+        addInputRecordingListener<EventMouseButtonReleased>(m_eventDispatcher, m_inputRecording,
+                                                            m_inputRecordingMode);
+        addInputRecordingListener<EventMouseMoved>(m_eventDispatcher, m_inputRecording,
+                                                   m_inputRecordingMode);
+
+        m_window->setEventDispatcher(m_eventDispatcher);
 
         const unsigned int width = 1000;
         const unsigned int height = 1000;
-        const unsigned int channels = 3;
 
-        auto *data = new unsigned char[width * height * channels];
+        JobSystem::initialize();
 
-        generateSmileTexture(data, width, height);
+        if (!TextureStreamer::initialize()) {
+            return -1;
+        }
 
-        textureSmile = std::make_unique<Texture2D>(data, width, height);
-        textureSmile->bind(0);
+        TextureResidency::initialize();
 
-        generateQuadsTexture(data, width, height);
+        textureSmile = TextureStreamer::load(width, height, [](const ImageView &image) {
+            return generateSmileTexture(image);
+        });
+        textureQuads = TextureStreamer::load(width, height, [](const ImageView &image) {
+            return generateQuadsTexture(image);
+        });
 
-        textureQuads = std::make_unique<Texture2D>(data, width, height);
-        textureQuads->bind(1);
+        const TextureFormat meshTexturesFormat = Texture2D::isFormatSupported(TextureFormat::BC1) ?
+                                                 TextureFormat::BC1 : TextureFormat::RGBA8;
 
-        delete[] data;
+        for (std::shared_ptr<TextureContainer> &container : cookedMeshTextures) {
+            container = std::make_shared<TextureContainer>();
+        }
+
+        cookMeshTexture(cookedMeshTextures[0], width, height, meshTexturesFormat,
+                        [](const ImageView &image) {
+            return generateSmileTexture(image);
+        });
+        cookMeshTexture(cookedMeshTextures[1], width, height, meshTexturesFormat,
+                        [](const ImageView &image) {
+            return generateQuadsTexture(image);
+        });
+        areMeshTexturesApplied = false;
 
         shaderProgram = std::make_unique<ShaderProgram>(vertexShader, fragmentShader);
 
         if (!shaderProgram->isCompiled()) {
-            return false;
+            LOG_CRITICAL("Failed to compile the scene shader");
+
+            return -1;
         }
 
+        modelMatrixLocation = shaderProgram->getUniformLocation("model_matrix");
+        currentFrameLocation = shaderProgram->getUniformLocation("current_frame");
+
+        frameStreamBuffer = std::make_unique<StreamBuffer>(s_frameStreamBufferRegionSize);
+
         BufferLayout bufferLayout_1_vec_3 {
             ShaderDataType::Float3
         };
@@ -342,21 +870,330 @@ namespace game_engine {
         vao->addVertexBuffer(*cubePositionsVBO);
         vao->setIndexBuffer(*cubeIndexBuffer);
 
+        cubeMesh.vertexArray = vao.get();
+        cubeMesh.shaderProgram = shaderProgram.get();
+        cubeMesh.textures = { TextureStreamer::getPlaceholder(), TextureStreamer::getPlaceholder() };
+
+        scene.clear();
+        scene.createEntity(TransformComponent{}, PreviousTransformComponent{}, cubeMesh);
+        for (const glm::vec3 &position : initialCubePositions) {
+            TransformComponent transform;
+            transform.position = position;
+
+            scene.createEntity(transform, PreviousTransformComponent{transform}, cubeMesh);
+        }
+
+        instancedShaderProgram = std::make_unique<ShaderProgram>(instancedVertexShader,
+                                                                 fragmentShader);
+
+        if (instancedShaderProgram->isCompiled()) {
+            instancedCurrentFrameLocation =
+                instancedShaderProgram->getUniformLocation("current_frame");
+        } else {
+            LOG_WARNING("Instanced shader is unavailable, instanced and CPU culled benchmark "
+                        "modes are disabled");
+            instancedShaderProgram = nullptr;
+        }
+
+        BufferLayout bufferLayoutInstanceMat4 {
+            { ShaderDataType::Mat4, 1 }
+        };
+
+        benchmarkModelMatrices = generateBenchmarkModelMatrices(s_benchmarkMaxObjectsCount);
+        benchmarkInstancesVBO = std::make_unique<VertexBuffer>(benchmarkModelMatrices.data(),
+            benchmarkModelMatrices.size() * sizeof(glm::mat4), bufferLayoutInstanceMat4);
+
+        benchmarkVAO = std::make_unique<VertexArray>();
+        benchmarkVAO->addVertexBuffer(*cubePositionsVBO);
+        benchmarkVAO->addVertexBuffer(*benchmarkInstancesVBO);
+        benchmarkVAO->setIndexBuffer(*cubeIndexBuffer);
+
+        culledInstancesVBO = std::make_unique<VertexBuffer>(nullptr,
+            benchmarkModelMatrices.size() * sizeof(glm::mat4), bufferLayoutInstanceMat4,
+            VertexBuffer::TypeDrawUsage::Dynamic);
+
+        culledBenchmarkVAO = std::make_unique<VertexArray>();
+        culledBenchmarkVAO->addVertexBuffer(*cubePositionsVBO);
+        culledBenchmarkVAO->addVertexBuffer(*culledInstancesVBO);
+        culledBenchmarkVAO->setIndexBuffer(*cubeIndexBuffer);
+
+        benchmarkCuller.clear();
+        benchmarkCuller.reserve(benchmarkModelMatrices.size());
+        for (const glm::mat4 &modelMatrix : benchmarkModelMatrices) {
+            const glm::vec3 center(modelMatrix[3]);
+            benchmarkCuller.addObject(center, std::sqrt(3.0f), center - glm::vec3(1.0f),
+                                      center + glm::vec3(1.0f));
+        }
+
+        indirectShaderProgram = std::make_unique<ShaderProgram>(indirectVertexShader,
+                                                                indirectFragmentShader);
+
+        if (indirectShaderProgram->isCompiled()) {
+            indirectCurrentFrameLocation =
+                indirectShaderProgram->getUniformLocation("current_frame");
+        } else {
+            LOG_WARNING("Indirect shader is unavailable, multi-draw indirect and GPU culled "
+                        "benchmark modes are disabled");
+            indirectShaderProgram = nullptr;
+        }
+
+        materialTextureArray = std::make_unique<Texture2DArray>(width, height, 2);
+        materialTextureArray->clear(glm::vec4(1.0f));
+        areMaterialLayersCopied = false;
+
+        geometryArena = std::make_unique<GeometryArena>(bufferLayoutVec3_Vec3_Vec2,
+                                                        s_geometryArenaMaxVerticesCount,
+                                                        s_geometryArenaMaxIndicesCount);
+
+        MeshRange cubeMeshRange;
+        geometryArena->addMesh(positionsCoords, sizeof(positionsCoords) / (5 * sizeof(GLfloat)),
+                               indices, sizeof(indices) / sizeof(GLuint), cubeMeshRange);
+
+        benchmarkIndirectBatch = nullptr;
+        benchmarkGpuCulling = nullptr;
+
+        if (indirectShaderProgram) {
+            benchmarkIndirectBatch = std::make_unique<IndirectBatch>();
+            for (size_t i = 0; i < benchmarkModelMatrices.size(); ++i) {
+                benchmarkIndirectBatch->add(cubeMeshRange, benchmarkModelMatrices[i],
+                                            static_cast<unsigned int>(i % 2));
+            }
+
+            benchmarkGpuCulling = std::make_unique<GpuCulling>(benchmarkModelMatrices.size());
+
+            if (!benchmarkGpuCulling->isValid()) {
+                LOG_WARNING("GPU culling is unavailable, the GPU culled benchmark mode is "
+                            "disabled");
+                benchmarkGpuCulling = nullptr;
+            }
+        }
+
+        std::vector<GpuCullingObject> cullingObjects;
+        cullingObjects.reserve(benchmarkModelMatrices.size());
+        for (size_t i = 0; i < benchmarkModelMatrices.size(); ++i) {
+            const glm::mat4 &modelMatrix = benchmarkModelMatrices[i];
+
+            GpuCullingObject object;
+            object.boundingSphere = glm::vec4(0.0f, 0.0f, 0.0f, std::sqrt(3.0f));
+            object.modelMatrix = modelMatrix;
+            object.firstIndex = static_cast<uint32_t>(cubeMeshRange.firstIndex);
+            object.indicesCount = static_cast<uint32_t>(cubeMeshRange.indicesCount);
+            object.baseVertex = static_cast<int32_t>(cubeMeshRange.baseVertex);
+            object.materialIndex = static_cast<uint32_t>(i % 2);
+
+            cullingObjects.push_back(object);
+        }
+
+        if (benchmarkGpuCulling) {
+            benchmarkGpuCulling->setObjects(cullingObjects);
+        }
+
         RendererOpenGL::enableDepthTest();
 
+        if (useRenderThread) {
+            UIModule::setViewportsEnabled(false);
+            UIModule::createDeviceObjects();
+            RenderThread::start(*m_window);
+        }
+
+        PROFILE_THREAD("Main thread");
+
+        m_frameTimer.reset();
+        m_fixedTimeAccumulator = 0.0;
+
+        bool isIdle = false;
+
         while (!m_isCloseWindow) {
+            if (idleRendering && !m_window->isHeadless() &&
+                m_inputRecordingMode != InputRecordingMode::Replaying && !isRedrawNeeded()) {
+                m_window->waitEvents(getIdleWaitTimeout());
+                processEvents();
+
+                ++m_skippedFramesCount;
+                isIdle = true;
+
+                continue;
+            }
+
+            if (isIdle) {
+                m_frameTimer.discardElapsedTime();
+                isIdle = false;
+            }
+
+            PROFILE_FRAME();
+
+            const double deltaTime = m_frameTimer.tick();
+            FrameStats::endFrame(m_frameTimer.getFrameIndex(), deltaTime * 1000.0);
+
+            beginInputFrame();
+            m_updateDeltaTime = m_inputRecordingMode == InputRecordingMode::Replaying ?
+                                m_inputRecording.getTimeStep() : deltaTime;
+
+            runFixedUpdates(m_updateDeltaTime);
             draw();
+            ++m_renderedFramesCount;
+
+            endInputFrame();
+
+            if (maxFramesCount > 0 && m_renderedFramesCount >= maxFramesCount) {
+                close();
+            }
+
+            PROFILE_SCOPE("Frame limiter");
+            m_frameLimiter.wait();
+        }
+
+        RenderThread::stop();
+        GpuProfiler::release();
+        TextureStreamer::shutdown();
+        TextureResidency::shutdown();
+        SamplerCache::release();
+        offscreenFramebuffer = nullptr;
+
+        for (FrameData &frame : frames) {
+            frame.uiSnapshot.clear();
         }
 
         m_window = nullptr;
 
+        JobSystem::shutdown();
+
         return 0;
     }
 
+    void App::setVSyncMode(const VSyncMode mode) {
+        m_window->setVSyncMode(mode);
+    }
+
+    VSyncMode App::getVSyncMode() const {
+        return m_window->getVSyncMode();
+    }
+
+    void App::requestRedraw() {
+        m_isRedrawRequested = true;
+
+        if (m_window) {
+            m_window->postEmptyEvent();
+        }
+    }
+
     glm::vec2 App::getCurrentCursorPosition() const {
+        if (m_inputRecordingMode == InputRecordingMode::Replaying) {
+            return m_replayCursorPosition;
+        }
+
         return m_window->getCurrentCursorPosition();
     }
 
+    bool App::isBenchmarkRenderModeSupported(const BenchmarkRenderMode mode) const {
+        switch (mode) {
+            case BenchmarkRenderMode::PerObject:
+                return true;
+            case BenchmarkRenderMode::Instanced:
+            case BenchmarkRenderMode::CpuCulled:
+                return instancedShaderProgram != nullptr;
+            case BenchmarkRenderMode::MultiDrawIndirect:
+                return benchmarkIndirectBatch != nullptr;
+            case BenchmarkRenderMode::GpuCulled:
+                return benchmarkGpuCulling != nullptr;
+        }
+
+        return false;
+    }
+
+    bool App::startInputRecording() {
+        if (m_inputRecordingMode != InputRecordingMode::None) {
+            LOG_CATEGORY_WARNING(Input, "Can't start input recording while recording or replaying");
+
+            return false;
+        }
+
+        m_inputRecording.clear();
+        m_inputRecording.setTimeStep(fixedTimeStep);
+        m_inputRecordingMode = InputRecordingMode::Recording;
+
+        return true;
+    }
+
+    bool App::stopInputRecording(const std::string &path) {
+        if (m_inputRecordingMode != InputRecordingMode::Recording) {
+            return false;
+        }
+
+        m_inputRecordingMode = InputRecordingMode::None;
+
+        return m_inputRecording.save(path);
+    }
+
+    bool App::startInputReplay(const std::string &path) {
+        InputRecording recording;
+
+        if (!recording.load(path)) {
+            return false;
+        }
+
+        return startInputReplay(std::move(recording));
+    }
+
+    bool App::startInputReplay(InputRecording recording) {
+        if (m_inputRecordingMode == InputRecordingMode::Recording) {
+            LOG_CATEGORY_WARNING(Input, "Can't start input replay while recording");
+
+            return false;
+        }
+
+        if (recording.getFramesCount() == 0) {
+            LOG_CATEGORY_WARNING(Input, "Input recording is empty");
+
+            return false;
+        }
+
+        m_inputRecording = std::move(recording);
+        m_inputRecordingMode = InputRecordingMode::Replaying;
+        m_inputReplayFrameIndex = 0;
+        Input::reset();
+
+        return true;
+    }
+
+    void App::stopInputReplay() {
+        if (m_inputRecordingMode != InputRecordingMode::Replaying) {
+            return;
+        }
+
+        m_inputRecordingMode = InputRecordingMode::None;
+        Input::reset();
+    }
+
+    void App::beginInputFrame() {
+        if (m_inputRecordingMode == InputRecordingMode::Recording) {
+            m_inputRecording.addFrame(camera.getPosition(), camera.getRotation(),
+                                      m_window->getCurrentCursorPosition());
+        } else if (m_inputRecordingMode == InputRecordingMode::Replaying) {
+            const InputRecordingFrame &frame = m_inputRecording.getFrame(m_inputReplayFrameIndex);
+
+            camera.setPositionRotation(frame.cameraPosition, frame.cameraRotation);
+            m_replayCursorPosition = frame.cursorPosition;
+            m_inputRecording.postFrameEvents(m_inputReplayFrameIndex, m_eventDispatcher);
+        }
+    }
+
+    void App::endInputFrame() {
+        if (m_inputRecordingMode != InputRecordingMode::Replaying) {
+            return;
+        }
+
+        if (++m_inputReplayFrameIndex < m_inputRecording.getFramesCount()) {
+            return;
+        }
+
+        stopInputReplay();
+
+        if (closeOnReplayEnd) {
+            close();
+        }
+    }
+
     void App::close() {
         m_isCloseWindow = true;
     }
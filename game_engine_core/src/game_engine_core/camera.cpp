@@ -20,6 +20,12 @@ namespace game_engine {
         return m_viewMatrix;
     }
 
+    const glm::mat4 &Camera::getViewProjectionMatrix() {
+        getViewMatrix();
+
+        return m_viewProjectionMatrix;
+    }
+
     void Camera::updateViewMatrix() {
         const float rollInRadians = glm::radians(m_rotation.x);
         const float pitchInRadians = glm::radians(m_rotation.y);
@@ -43,6 +49,7 @@ namespace game_engine {
         m_up = glm::cross(m_right, m_direction);
 
         m_viewMatrix = glm::lookAt(m_position, m_position + m_direction, m_up);
+        m_viewProjectionMatrix = m_projectionMatrix * m_viewMatrix;
     }
 
     void Camera::updateProjectionMatrix() {
@@ -60,6 +67,8 @@ namespace game_engine {
                                            0, 0, -2 / (f - n), 0,
                                            0, 0, (-f - n) / (f - n), 1);
         }
+
+        m_viewProjectionMatrix = m_projectionMatrix * m_viewMatrix;
     }
 
     void Camera::setPosition(const glm::vec3 &position) {
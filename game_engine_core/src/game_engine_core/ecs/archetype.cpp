@@ -0,0 +1,101 @@
+#include "game_engine_core/ecs/archetype.hpp"
+
+#include "game_engine_core/log.hpp"
+
+#include <cstring>
+
+namespace game_engine {
+    size_t alignChunkOffset(const size_t offset, const size_t alignment) {
+        return (offset + alignment - 1) / alignment * alignment;
+    }
+
+    Archetype::Archetype(const ComponentMask &mask) : m_mask{mask} {
+        size_t entitySize = sizeof(Entity);
+
+        for (ComponentTypeId id = 0; id < s_maxComponentTypesCount; ++id) {
+            if (m_mask.test(id)) {
+                m_componentTypeIds.push_back(id);
+                entitySize += ComponentRegistry::getTypeInfo(id).size;
+            }
+        }
+
+        for (size_t capacity = s_chunkSize / entitySize; capacity > 0; --capacity) {
+            size_t offset = sizeof(Entity) * capacity;
+
+            for (const ComponentTypeId id : m_componentTypeIds) {
+                const ComponentTypeInfo &info = ComponentRegistry::getTypeInfo(id);
+
+                offset = alignChunkOffset(offset, info.alignment);
+                m_offsets[id] = offset;
+                offset += info.size * capacity;
+            }
+
+            if (offset <= s_chunkSize) {
+                m_chunkCapacity = capacity;
+                break;
+            }
+        }
+
+        if (m_chunkCapacity == 0) {
+            LOG_CRITICAL("Archetype: components of {0} bytes do not fit into a {1} byte chunk",
+                         entitySize, s_chunkSize);
+        }
+    }
+
+    EntityLocation Archetype::allocate(const Entity entity) {
+        if (m_chunks.empty() || m_chunks.back().count == m_chunkCapacity) {
+            Chunk chunk;
+            chunk.storage = std::make_unique<ChunkStorage>();
+            m_chunks.push_back(std::move(chunk));
+        }
+
+        Chunk &chunk = m_chunks.back();
+        const EntityLocation location{ static_cast<uint32_t>(m_chunks.size() - 1),
+                                       static_cast<uint32_t>(chunk.count) };
+
+        getEntities(chunk)[chunk.count] = entity;
+        for (const ComponentTypeId id : m_componentTypeIds) {
+            const size_t size = ComponentRegistry::getTypeInfo(id).size;
+            std::memset(static_cast<std::byte*>(getComponentData(chunk, id)) + chunk.count * size,
+                        0, size);
+        }
+
+        ++chunk.count;
+        ++m_entitiesCount;
+
+        return location;
+    }
+
+    Entity Archetype::remove(const EntityLocation &location) {
+        Chunk &lastChunk = m_chunks.back();
+        const EntityLocation lastLocation{ static_cast<uint32_t>(m_chunks.size() - 1),
+                                           static_cast<uint32_t>(lastChunk.count - 1) };
+
+        Entity movedEntity;
+        if (location.chunkIndex != lastLocation.chunkIndex || location.row != lastLocation.row) {
+            Chunk &chunk = m_chunks[location.chunkIndex];
+
+            movedEntity = getEntities(lastChunk)[lastLocation.row];
+            getEntities(chunk)[location.row] = movedEntity;
+
+            for (const ComponentTypeId id : m_componentTypeIds) {
+                std::memcpy(getComponentData(location, id), getComponentData(lastLocation, id),
+                            ComponentRegistry::getTypeInfo(id).size);
+            }
+        }
+
+        --lastChunk.count;
+        --m_entitiesCount;
+
+        if (lastChunk.count == 0) {
+            m_chunks.pop_back();
+        }
+
+        return movedEntity;
+    }
+
+    void Archetype::clear() {
+        m_chunks.clear();
+        m_entitiesCount = 0;
+    }
+}
@@ -0,0 +1,38 @@
+#include "game_engine_core/ecs/component.hpp"
+
+#include "game_engine_core/log.hpp"
+
+#include <array>
+#include <atomic>
+#include <mutex>
+
+namespace game_engine {
+    std::array<ComponentTypeInfo, s_maxComponentTypesCount> componentTypes;
+    std::atomic<size_t> componentTypesCount{0};
+    std::mutex componentTypesMutex;
+
+    ComponentTypeId ComponentRegistry::registerType(const size_t size, const size_t alignment) {
+        std::lock_guard<std::mutex> lock(componentTypesMutex);
+
+        const size_t id = componentTypesCount.load();
+        if (id >= s_maxComponentTypesCount) {
+            LOG_CRITICAL("ComponentRegistry: the limit of {0} component types is reached, "
+                         "the type of {1} bytes is rejected", s_maxComponentTypesCount, size);
+
+            return s_invalidComponentTypeId;
+        }
+
+        componentTypes[id] = ComponentTypeInfo{ size, alignment };
+        componentTypesCount.store(id + 1);
+
+        return static_cast<ComponentTypeId>(id);
+    }
+
+    const ComponentTypeInfo &ComponentRegistry::getTypeInfo(const ComponentTypeId id) {
+        return componentTypes[id];
+    }
+
+    size_t ComponentRegistry::getTypesCount() {
+        return componentTypesCount.load();
+    }
+}
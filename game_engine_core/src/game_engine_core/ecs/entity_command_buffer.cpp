@@ -0,0 +1,59 @@
+#include "game_engine_core/ecs/entity_command_buffer.hpp"
+
+namespace game_engine {
+    void EntityCommandBuffer::destroyEntity(const Entity entity) {
+        m_commands.push_back(EntityCommand{ EntityCommandType::DestroyEntity,
+                                            s_invalidComponentTypeId, entity, 0 });
+    }
+
+    void EntityCommandBuffer::execute(World &world) {
+        for (size_t i = 0; i < m_commands.size(); ++i) {
+            const EntityCommand &command = m_commands[i];
+
+            switch (command.type) {
+            case EntityCommandType::CreateEntity: {
+                size_t componentsEnd = i + 1;
+                ComponentMask mask;
+                for (; componentsEnd < m_commands.size() &&
+                       m_commands[componentsEnd].type == EntityCommandType::SetCreatedComponent;
+                     ++componentsEnd) {
+                    mask.set(m_commands[componentsEnd].componentTypeId);
+                }
+
+                const Entity entity = world.createEntity(mask);
+                if (entity.isValid()) {
+                    for (size_t j = i + 1; j < componentsEnd; ++j) {
+                        copyPayload(world.getComponentData(entity, m_commands[j].componentTypeId),
+                                    m_commands[j]);
+                    }
+                }
+
+                i = componentsEnd - 1;
+                break;
+            }
+            case EntityCommandType::SetCreatedComponent:
+                break;
+            case EntityCommandType::DestroyEntity:
+                world.destroyEntity(command.entity);
+                break;
+            case EntityCommandType::AddComponent:
+                copyPayload(world.addComponentData(command.entity, command.componentTypeId),
+                            command);
+                break;
+            case EntityCommandType::RemoveComponent:
+                world.removeComponentData(command.entity, command.componentTypeId);
+                break;
+            }
+        }
+
+        m_commands.clear();
+        m_payload.clear();
+    }
+
+    void EntityCommandBuffer::copyPayload(void *data, const EntityCommand &command) const {
+        if (data != nullptr) {
+            std::memcpy(data, m_payload.data() + command.payloadOffset,
+                        ComponentRegistry::getTypeInfo(command.componentTypeId).size);
+        }
+    }
+}
@@ -0,0 +1,211 @@
+#include "game_engine_core/ecs/world.hpp"
+
+#include "game_engine_core/log.hpp"
+
+#include <cstring>
+
+namespace game_engine {
+    World::World() {
+        getOrCreateArchetype(ComponentMask{});
+    }
+
+    World::~World() = default;
+
+    Entity World::createEntity() {
+        return createEntity(ComponentMask{});
+    }
+
+    Entity World::createEntity(const ComponentMask &mask) {
+        if (!isStructuralChangeAllowed()) {
+            return Entity{};
+        }
+
+        Archetype *archetype = getOrCreateArchetype(mask);
+        if (archetype == nullptr) {
+            return Entity{};
+        }
+
+        uint32_t index = 0;
+        if (!m_freeIndices.empty()) {
+            index = m_freeIndices.back();
+            m_freeIndices.pop_back();
+        } else {
+            index = static_cast<uint32_t>(m_records.size());
+            m_records.emplace_back();
+        }
+
+        EntityRecord &record = m_records[index];
+        const Entity entity{ index, record.generation };
+
+        record.archetype = archetype;
+        record.location = archetype->allocate(entity);
+        ++m_entitiesCount;
+        ++m_structuralVersion;
+
+        return entity;
+    }
+
+    bool World::destroyEntity(const Entity entity) {
+        if (!isAlive(entity) || !isStructuralChangeAllowed()) {
+            return false;
+        }
+
+        EntityRecord &record = m_records[entity.index];
+        removeFromArchetype(*record.archetype, record.location);
+
+        record.archetype = nullptr;
+        ++record.generation;
+        m_freeIndices.push_back(entity.index);
+        --m_entitiesCount;
+        ++m_structuralVersion;
+
+        return true;
+    }
+
+    bool World::isAlive(const Entity entity) const {
+        return entity.index < m_records.size() &&
+               m_records[entity.index].archetype != nullptr &&
+               m_records[entity.index].generation == entity.generation;
+    }
+
+    void World::clear() {
+        if (!isStructuralChangeAllowed()) {
+            return;
+        }
+
+        for (uint32_t index = 0; index < m_records.size(); ++index) {
+            EntityRecord &record = m_records[index];
+
+            if (record.archetype != nullptr) {
+                record.archetype = nullptr;
+                ++record.generation;
+                m_freeIndices.push_back(index);
+            }
+        }
+
+        for (const std::unique_ptr<Archetype> &archetype : m_archetypes) {
+            archetype->clear();
+        }
+
+        m_entitiesCount = 0;
+        ++m_structuralVersion;
+    }
+
+    void *World::getComponentData(const Entity entity, const ComponentTypeId id) {
+        if (!isAlive(entity)) {
+            return nullptr;
+        }
+
+        EntityRecord &record = m_records[entity.index];
+        if (!record.archetype->hasComponent(id)) {
+            return nullptr;
+        }
+
+        return record.archetype->getComponentData(record.location, id);
+    }
+
+    void *World::addComponentData(const Entity entity, const ComponentTypeId id) {
+        if (!isAlive(entity) || !isValidComponentTypeId(id)) {
+            return nullptr;
+        }
+
+        EntityRecord &record = m_records[entity.index];
+        if (record.archetype->hasComponent(id)) {
+            return record.archetype->getComponentData(record.location, id);
+        }
+
+        if (!isStructuralChangeAllowed()) {
+            return nullptr;
+        }
+
+        Archetype *targetArchetype = getOrCreateArchetype(ComponentMask{
+            record.archetype->getMask()}.set(id));
+        if (targetArchetype == nullptr) {
+            return nullptr;
+        }
+
+        moveEntity(entity, *targetArchetype);
+
+        return record.archetype->getComponentData(record.location, id);
+    }
+
+    bool World::removeComponentData(const Entity entity, const ComponentTypeId id) {
+        if (!isAlive(entity) || !m_records[entity.index].archetype->hasComponent(id) ||
+            !isStructuralChangeAllowed()) {
+            return false;
+        }
+
+        EntityRecord &record = m_records[entity.index];
+        Archetype *targetArchetype = getOrCreateArchetype(ComponentMask{
+            record.archetype->getMask()}.reset(id));
+        if (targetArchetype == nullptr) {
+            return false;
+        }
+
+        moveEntity(entity, *targetArchetype);
+
+        return true;
+    }
+
+    Archetype *World::getOrCreateArchetype(const ComponentMask &mask) {
+        const auto it = m_archetypesByMask.find(mask);
+        if (it != m_archetypesByMask.end()) {
+            return it->second;
+        }
+
+        std::unique_ptr<Archetype> archetype = std::make_unique<Archetype>(mask);
+        if (archetype->getChunkCapacity() == 0) {
+            LOG_ERROR("World: unable to create an archetype for component mask {0}",
+                      mask.to_string());
+
+            return nullptr;
+        }
+
+        Archetype *archetypePointer = archetype.get();
+        m_archetypes.push_back(std::move(archetype));
+        m_archetypesByMask.emplace(mask, archetypePointer);
+
+        return archetypePointer;
+    }
+
+    void World::moveEntity(const Entity entity, Archetype &targetArchetype) {
+        EntityRecord &record = m_records[entity.index];
+        Archetype &sourceArchetype = *record.archetype;
+        const EntityLocation sourceLocation = record.location;
+        const EntityLocation targetLocation = targetArchetype.allocate(entity);
+
+        for (const ComponentTypeId id : sourceArchetype.getComponentTypeIds()) {
+            if (targetArchetype.hasComponent(id)) {
+                std::memcpy(targetArchetype.getComponentData(targetLocation, id),
+                            sourceArchetype.getComponentData(sourceLocation, id),
+                            ComponentRegistry::getTypeInfo(id).size);
+            }
+        }
+
+        removeFromArchetype(sourceArchetype, sourceLocation);
+
+        record.archetype = &targetArchetype;
+        record.location = targetLocation;
+
+        ++m_structuralVersion;
+    }
+
+    void World::removeFromArchetype(Archetype &archetype, const EntityLocation &location) {
+        const Entity movedEntity = archetype.remove(location);
+
+        if (movedEntity.isValid()) {
+            m_records[movedEntity.index].location = location;
+        }
+    }
+
+    bool World::isStructuralChangeAllowed() const {
+        if (m_iterationDepth > 0) {
+            LOG_ERROR("World: structural changes during iteration must go through "
+                      "EntityCommandBuffer");
+
+            return false;
+        }
+
+        return true;
+    }
+}
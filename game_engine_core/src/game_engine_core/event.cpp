@@ -1 +1,62 @@
+#include "game_engine_core/event.hpp"
+#include "game_engine_core/log.hpp"
 
+#include <algorithm>
+
+namespace game_engine {
+    size_t alignQueuedEventSize(const size_t size, const size_t alignment) {
+        return (size + alignment - 1) & ~(alignment - 1);
+    }
+
+    EventDispatcher::EventDispatcher() : m_queueArena(s_queueArenaSize) {
+        m_coalescedOffsets.fill(s_invalidOffset);
+    }
+
+    size_t EventDispatcher::allocateQueued(const size_t payloadSize) {
+        const size_t recordSize = alignQueuedEventSize(sizeof(QueuedEventHeader), s_queueAlignment) +
+                                  alignQueuedEventSize(payloadSize, s_queueAlignment);
+
+        if (m_queueArenaOffset + recordSize > m_queueArena.size()) {
+            const size_t arenaSize = std::max(m_queueArena.size() * 2,
+                                              m_queueArenaOffset + recordSize);
+
+            LOG_WARNING("EventDispatcher: event queue is full, growing it to {0} bytes", arenaSize);
+            m_queueArena.resize(arenaSize);
+        }
+
+        const size_t offset = m_queueArenaOffset;
+        m_queueArenaOffset += recordSize;
+
+        getQueuedHeader(offset).size = static_cast<uint32_t>(recordSize);
+
+        return offset;
+    }
+
+    EventDispatcher::QueuedEventHeader &EventDispatcher::getQueuedHeader(const size_t offset) {
+        return *reinterpret_cast<QueuedEventHeader*>(m_queueArena.data() + offset);
+    }
+
+    void *EventDispatcher::getQueuedPayload(const size_t offset) {
+        return m_queueArena.data() + offset +
+               alignQueuedEventSize(sizeof(QueuedEventHeader), s_queueAlignment);
+    }
+
+    void EventDispatcher::dispatchQueued() {
+        m_coalescedOffsets.fill(s_invalidOffset);
+        m_queuedEventsCount = 0;
+
+        for (size_t offset = 0; offset < m_queueArenaOffset; ) {
+            const QueuedEventHeader header = getQueuedHeader(offset);
+
+            if (header.type != EventType::EventsCount) {
+                dispatchQueuedEvent(EngineEvents{}, header.type, getQueuedPayload(offset));
+            }
+
+            offset += header.size;
+        }
+
+        m_queueArenaOffset = 0;
+        m_queuedEventsCount = 0;
+        m_coalescedOffsets.fill(s_invalidOffset);
+    }
+}
@@ -0,0 +1,52 @@
+#include "game_engine_core/frame_limiter.hpp"
+
+#include <thread>
+
+namespace game_engine {
+    void FrameLimiter::setTargetFrameRate(const double framesPerSecond) {
+        m_targetFrameRate = framesPerSecond > 0.0 ? framesPerSecond : 0.0;
+        m_hasDeadline = false;
+
+        if (m_targetFrameRate > 0.0) {
+            m_framePeriod = std::chrono::duration_cast<Clock::duration>(
+                std::chrono::duration<double>(1.0 / m_targetFrameRate));
+        }
+    }
+
+    void FrameLimiter::setSpinThreshold(const double seconds) {
+        m_spinThreshold = std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double>(seconds > 0.0 ? seconds : 0.0));
+    }
+
+    double FrameLimiter::getSpinThreshold() const {
+        return std::chrono::duration<double>(m_spinThreshold).count();
+    }
+
+    void FrameLimiter::wait() {
+        if (m_targetFrameRate <= 0.0) {
+            m_hasDeadline = false;
+
+            return;
+        }
+
+        const Clock::time_point now = Clock::now();
+
+        if (!m_hasDeadline || now - m_nextFrameTime > m_framePeriod) {
+            m_nextFrameTime = now + m_framePeriod;
+            m_hasDeadline = true;
+
+            return;
+        }
+
+        const Clock::duration remaining = m_nextFrameTime - now;
+        if (remaining > m_spinThreshold) {
+            std::this_thread::sleep_for(remaining - m_spinThreshold);
+        }
+
+        while (Clock::now() < m_nextFrameTime) {
+            std::this_thread::yield();
+        }
+
+        m_nextFrameTime += m_framePeriod;
+    }
+}
@@ -0,0 +1,106 @@
+#include "game_engine_core/frame_stats.hpp"
+
+#include <algorithm>
+
+namespace game_engine {
+    std::array<std::atomic<uint64_t>, static_cast<size_t>(FrameCounter::CountersCount)> FrameStats::s_counters{};
+    std::atomic<int64_t> FrameStats::s_textureMemoryBytes{0};
+    std::atomic<uint64_t> FrameStats::s_residentTextureBytes{0};
+
+    std::array<FrameStatsSample, FrameStats::s_historySize> frameStatsHistory;
+    size_t frameStatsHistoryHead = 0;
+    size_t frameStatsHistoryCount = 0;
+
+    double frameBudgetMs = 0.0;
+    uint64_t lastSpikeFrameIndex = 0;
+    bool hasFrameStatsSpike = false;
+    std::vector<FrameStatsSpike> frameStatsSpikes;
+
+    void captureFrameStatsSpike(const FrameStatsSample &sample) {
+        if (hasFrameStatsSpike &&
+            sample.frameIndex - lastSpikeFrameIndex < FrameStats::s_spikeFramesCount) {
+            return;
+        }
+
+        if (frameStatsSpikes.size() == FrameStats::s_maxSpikesCount) {
+            frameStatsSpikes.erase(frameStatsSpikes.begin());
+        }
+
+        FrameStatsSpike &spike = frameStatsSpikes.emplace_back();
+        spike.frameIndex = sample.frameIndex;
+        spike.frameTimeMs = sample.frameTimeMs;
+        spike.budgetMs = frameBudgetMs;
+        spike.stages = Profiler::getStageStats();
+
+        const size_t framesCount = std::min(frameStatsHistoryCount, FrameStats::s_spikeFramesCount);
+        spike.frames.reserve(framesCount);
+        for (size_t i = frameStatsHistoryCount - framesCount; i < frameStatsHistoryCount; ++i) {
+            spike.frames.push_back(FrameStats::getSample(i));
+        }
+
+        lastSpikeFrameIndex = sample.frameIndex;
+        hasFrameStatsSpike = true;
+    }
+
+    uint64_t FrameStats::getTextureMemoryBytes() {
+        return static_cast<uint64_t>(std::max<int64_t>(
+            s_textureMemoryBytes.load(std::memory_order_relaxed), 0));
+    }
+
+    void FrameStats::endFrame(const uint64_t frameIndex, const double frameTimeMs) {
+        FrameStatsSample &sample = frameStatsHistory[frameStatsHistoryHead];
+        sample.frameIndex = frameIndex;
+        sample.frameTimeMs = frameTimeMs;
+        sample.textureMemoryBytes = getTextureMemoryBytes();
+        sample.residentTextureBytes = s_residentTextureBytes.load(std::memory_order_relaxed);
+
+        for (size_t i = 0; i < s_counters.size(); ++i) {
+            sample.counters[i] = s_counters[i].exchange(0, std::memory_order_relaxed);
+        }
+
+        frameStatsHistoryHead = (frameStatsHistoryHead + 1) % s_historySize;
+        frameStatsHistoryCount = std::min(frameStatsHistoryCount + 1, s_historySize);
+
+        if (frameBudgetMs > 0.0 && frameTimeMs > frameBudgetMs) {
+            captureFrameStatsSpike(sample);
+        }
+    }
+
+    size_t FrameStats::getHistoryCount() {
+        return frameStatsHistoryCount;
+    }
+
+    const FrameStatsSample &FrameStats::getSample(const size_t index) {
+        return frameStatsHistory[(frameStatsHistoryHead + s_historySize - frameStatsHistoryCount +
+                                  index) % s_historySize];
+    }
+
+    const FrameStatsSample &FrameStats::getLastSample() {
+        return frameStatsHistory[(frameStatsHistoryHead + s_historySize - 1) % s_historySize];
+    }
+
+    void FrameStats::copyFrameTimes(std::vector<float> &frameTimes) {
+        frameTimes.resize(frameStatsHistoryCount);
+
+        for (size_t i = 0; i < frameStatsHistoryCount; ++i) {
+            frameTimes[i] = static_cast<float>(getSample(i).frameTimeMs);
+        }
+    }
+
+    void FrameStats::setFrameBudget(const double budgetMs) {
+        frameBudgetMs = budgetMs;
+    }
+
+    double FrameStats::getFrameBudget() {
+        return frameBudgetMs;
+    }
+
+    const std::vector<FrameStatsSpike> &FrameStats::getSpikes() {
+        return frameStatsSpikes;
+    }
+
+    void FrameStats::clearSpikes() {
+        frameStatsSpikes.clear();
+        hasFrameStatsSpike = false;
+    }
+}
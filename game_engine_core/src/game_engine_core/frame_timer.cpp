@@ -0,0 +1,102 @@
+#include "game_engine_core/frame_timer.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace game_engine {
+    double percentileOfSorted(const float *sortedValues, const size_t count,
+                              const double percentile) {
+        if (count == 0) {
+            return 0.0;
+        }
+
+        const double clampedPercentile = std::clamp(percentile, 0.0, 100.0);
+        const size_t rank = static_cast<size_t>(std::ceil(clampedPercentile / 100.0 * count));
+
+        return sortedValues[std::clamp<size_t>(rank, 1, count) - 1];
+    }
+
+    FrameTimer::FrameTimer() {
+        reset();
+    }
+
+    void FrameTimer::reset() {
+        m_startTime = Clock::now();
+        m_lastTime = m_startTime;
+        m_deltaTime = 0.0;
+        m_frameIndex = 0;
+        m_historyHead = 0;
+        m_historyCount = 0;
+    }
+
+    double FrameTimer::tick() {
+        const Clock::time_point now = Clock::now();
+        m_deltaTime = std::chrono::duration<double>(now - m_lastTime).count();
+        m_lastTime = now;
+        ++m_frameIndex;
+
+        m_history[m_historyHead] = static_cast<float>(m_deltaTime * 1000.0);
+        m_historyHead = (m_historyHead + 1) % s_historySize;
+        m_historyCount = std::min(m_historyCount + 1, s_historySize);
+
+        return m_deltaTime;
+    }
+
+    void FrameTimer::discardElapsedTime() {
+        m_lastTime = Clock::now();
+    }
+
+    double FrameTimer::getTotalTime() const {
+        return std::chrono::duration<double>(m_lastTime - m_startTime).count();
+    }
+
+    size_t FrameTimer::copySortedHistory(std::array<float, s_historySize> &sortedHistory) const {
+        std::copy_n(m_history.begin(), m_historyCount, sortedHistory.begin());
+        std::sort(sortedHistory.begin(), sortedHistory.begin() + m_historyCount);
+
+        return m_historyCount;
+    }
+
+    double FrameTimer::getFrameTimePercentile(const double percentile) const {
+        std::array<float, s_historySize> sortedHistory;
+        const size_t count = copySortedHistory(sortedHistory);
+
+        return percentileOfSorted(sortedHistory.data(), count, percentile);
+    }
+
+    FrameTimeStats calculateSortedFrameTimeStats(const float *sortedValues, const size_t count) {
+        FrameTimeStats stats;
+        stats.samplesCount = count;
+
+        if (count == 0) {
+            return stats;
+        }
+
+        double sum = 0.0;
+        for (size_t i = 0; i < count; ++i) {
+            sum += sortedValues[i];
+        }
+
+        stats.averageMs = sum / count;
+        stats.minimumMs = sortedValues[0];
+        stats.maximumMs = sortedValues[count - 1];
+        stats.percentile50Ms = percentileOfSorted(sortedValues, count, 50.0);
+        stats.percentile95Ms = percentileOfSorted(sortedValues, count, 95.0);
+        stats.percentile99Ms = percentileOfSorted(sortedValues, count, 99.0);
+
+        return stats;
+    }
+
+    FrameTimeStats FrameTimer::getFrameTimeStats() const {
+        std::array<float, s_historySize> sortedHistory;
+        const size_t count = copySortedHistory(sortedHistory);
+
+        return calculateSortedFrameTimeStats(sortedHistory.data(), count);
+    }
+
+    FrameTimeStats FrameTimer::calculateFrameTimeStats(std::vector<float> &frameTimesMs) {
+        std::sort(frameTimesMs.begin(), frameTimesMs.end());
+
+        return calculateSortedFrameTimeStats(frameTimesMs.data(), frameTimesMs.size());
+    }
+}
@@ -0,0 +1,56 @@
+#include "game_engine_core/frustum.hpp"
+
+#include "glm/geometric.hpp"
+
+namespace game_engine {
+    Frustum Frustum::fromMatrix(const glm::mat4 &viewProjectionMatrix) {
+        const glm::mat4 &m = viewProjectionMatrix;
+
+        const glm::vec4 row0(m[0][0], m[1][0], m[2][0], m[3][0]);
+        const glm::vec4 row1(m[0][1], m[1][1], m[2][1], m[3][1]);
+        const glm::vec4 row2(m[0][2], m[1][2], m[2][2], m[3][2]);
+        const glm::vec4 row3(m[0][3], m[1][3], m[2][3], m[3][3]);
+
+        Frustum frustum;
+        frustum.planes[Left] = row3 + row0;
+        frustum.planes[Right] = row3 - row0;
+        frustum.planes[Bottom] = row3 + row1;
+        frustum.planes[Top] = row3 - row1;
+        frustum.planes[Near] = row3 + row2;
+        frustum.planes[Far] = row3 - row2;
+
+        for (glm::vec4 &plane : frustum.planes) {
+            const float length = glm::length(glm::vec3(plane));
+
+            if (length > 0.0f) {
+                plane = plane / length;
+            }
+        }
+
+        return frustum;
+    }
+
+    bool Frustum::intersectsSphere(const glm::vec3 &center, const float radius) const {
+        for (const glm::vec4 &plane : planes) {
+            if (glm::dot(glm::vec3(plane), center) + plane.w < -radius) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool Frustum::intersectsBox(const glm::vec3 &min, const glm::vec3 &max) const {
+        for (const glm::vec4 &plane : planes) {
+            const glm::vec3 positiveVertex(plane.x >= 0.0f ? max.x : min.x,
+                                           plane.y >= 0.0f ? max.y : min.y,
+                                           plane.z >= 0.0f ? max.z : min.z);
+
+            if (glm::dot(glm::vec3(plane), positiveVertex) + plane.w < 0.0f) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
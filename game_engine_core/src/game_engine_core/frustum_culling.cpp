@@ -0,0 +1,405 @@
+#include "game_engine_core/frustum_culling.hpp"
+
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define GAME_ENGINE_CULLING_X86_64
+    #include <immintrin.h>
+
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #endif
+
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #define GAME_ENGINE_TARGET_AVX2
+    #else
+        #define GAME_ENGINE_TARGET_AVX2 __attribute__((target("avx2")))
+    #endif
+#endif
+
+namespace game_engine {
+    namespace {
+        struct SphereArrays {
+            const float *centersX;
+            const float *centersY;
+            const float *centersZ;
+            const float *radii;
+        };
+
+        struct BoxArrays {
+            const float *minX;
+            const float *minY;
+            const float *minZ;
+            const float *maxX;
+            const float *maxY;
+            const float *maxZ;
+        };
+
+        size_t compactVisible(uint32_t *visibleIndices, const uint32_t firstIndex,
+                              const int visibleMask, const int lanesCount) {
+            size_t visibleCount = 0;
+
+            for (int lane = 0; lane < lanesCount; ++lane) {
+                visibleIndices[visibleCount] = firstIndex + static_cast<uint32_t>(lane);
+                visibleCount += static_cast<size_t>((visibleMask >> lane) & 1);
+            }
+
+            return visibleCount;
+        }
+
+        bool isSphereVisible(const Frustum &frustum, const SphereArrays &spheres,
+                             const size_t index) {
+            for (const glm::vec4 &plane : frustum.planes) {
+                const float distance = plane.x * spheres.centersX[index] +
+                                       plane.y * spheres.centersY[index] +
+                                       plane.z * spheres.centersZ[index] + plane.w;
+
+                if (distance < -spheres.radii[index]) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        bool isBoxVisible(const Frustum &frustum, const BoxArrays &boxes, const size_t index) {
+            for (const glm::vec4 &plane : frustum.planes) {
+                const float x = plane.x >= 0.0f ? boxes.maxX[index] : boxes.minX[index];
+                const float y = plane.y >= 0.0f ? boxes.maxY[index] : boxes.minY[index];
+                const float z = plane.z >= 0.0f ? boxes.maxZ[index] : boxes.minZ[index];
+
+                if (plane.x * x + plane.y * y + plane.z * z + plane.w < 0.0f) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        size_t cullSpheresScalar(const Frustum &frustum, const SphereArrays &spheres,
+                                 const size_t first, const size_t count,
+                                 uint32_t *visibleIndices) {
+            size_t visibleCount = 0;
+
+            for (size_t i = first; i < count; ++i) {
+                visibleIndices[visibleCount] = static_cast<uint32_t>(i);
+                visibleCount += isSphereVisible(frustum, spheres, i) ? 1 : 0;
+            }
+
+            return visibleCount;
+        }
+
+        size_t cullBoxesScalar(const Frustum &frustum, const BoxArrays &boxes,
+                               const size_t first, const size_t count,
+                               uint32_t *visibleIndices) {
+            size_t visibleCount = 0;
+
+            for (size_t i = first; i < count; ++i) {
+                visibleIndices[visibleCount] = static_cast<uint32_t>(i);
+                visibleCount += isBoxVisible(frustum, boxes, i) ? 1 : 0;
+            }
+
+            return visibleCount;
+        }
+
+#if defined(GAME_ENGINE_CULLING_X86_64)
+        size_t cullSpheresSSE(const Frustum &frustum, const SphereArrays &spheres,
+                              const size_t count, uint32_t *visibleIndices) {
+            size_t visibleCount = 0;
+            size_t i = 0;
+
+            for (; i + 4 <= count; i += 4) {
+                const __m128 centersX = _mm_loadu_ps(spheres.centersX + i);
+                const __m128 centersY = _mm_loadu_ps(spheres.centersY + i);
+                const __m128 centersZ = _mm_loadu_ps(spheres.centersZ + i);
+                const __m128 negativeRadii = _mm_sub_ps(_mm_setzero_ps(),
+                                                        _mm_loadu_ps(spheres.radii + i));
+
+                __m128 visible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+                for (const glm::vec4 &plane : frustum.planes) {
+                    __m128 distance = _mm_mul_ps(_mm_set1_ps(plane.x), centersX);
+                    distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(plane.y), centersY));
+                    distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(plane.z), centersZ));
+                    distance = _mm_add_ps(distance, _mm_set1_ps(plane.w));
+
+                    visible = _mm_and_ps(visible, _mm_cmpge_ps(distance, negativeRadii));
+                }
+
+                visibleCount += compactVisible(visibleIndices + visibleCount,
+                                               static_cast<uint32_t>(i),
+                                               _mm_movemask_ps(visible), 4);
+            }
+
+            return visibleCount + cullSpheresScalar(frustum, spheres, i, count,
+                                                    visibleIndices + visibleCount);
+        }
+
+        size_t cullBoxesSSE(const Frustum &frustum, const BoxArrays &boxes,
+                            const size_t count, uint32_t *visibleIndices) {
+            size_t visibleCount = 0;
+            size_t i = 0;
+
+            for (; i + 4 <= count; i += 4) {
+                __m128 visible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+                for (const glm::vec4 &plane : frustum.planes) {
+                    const __m128 x = _mm_loadu_ps((plane.x >= 0.0f ? boxes.maxX : boxes.minX) + i);
+                    const __m128 y = _mm_loadu_ps((plane.y >= 0.0f ? boxes.maxY : boxes.minY) + i);
+                    const __m128 z = _mm_loadu_ps((plane.z >= 0.0f ? boxes.maxZ : boxes.minZ) + i);
+
+                    __m128 distance = _mm_mul_ps(_mm_set1_ps(plane.x), x);
+                    distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(plane.y), y));
+                    distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(plane.z), z));
+                    distance = _mm_add_ps(distance, _mm_set1_ps(plane.w));
+
+                    visible = _mm_and_ps(visible, _mm_cmpge_ps(distance, _mm_setzero_ps()));
+                }
+
+                visibleCount += compactVisible(visibleIndices + visibleCount,
+                                               static_cast<uint32_t>(i),
+                                               _mm_movemask_ps(visible), 4);
+            }
+
+            return visibleCount + cullBoxesScalar(frustum, boxes, i, count,
+                                                  visibleIndices + visibleCount);
+        }
+
+        GAME_ENGINE_TARGET_AVX2
+        size_t cullSpheresAVX2(const Frustum &frustum, const SphereArrays &spheres,
+                               const size_t count, uint32_t *visibleIndices) {
+            size_t visibleCount = 0;
+            size_t i = 0;
+
+            for (; i + 8 <= count; i += 8) {
+                const __m256 centersX = _mm256_loadu_ps(spheres.centersX + i);
+                const __m256 centersY = _mm256_loadu_ps(spheres.centersY + i);
+                const __m256 centersZ = _mm256_loadu_ps(spheres.centersZ + i);
+                const __m256 negativeRadii = _mm256_sub_ps(_mm256_setzero_ps(),
+                                                           _mm256_loadu_ps(spheres.radii + i));
+
+                __m256 visible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+                for (const glm::vec4 &plane : frustum.planes) {
+                    __m256 distance = _mm256_mul_ps(_mm256_set1_ps(plane.x), centersX);
+                    distance = _mm256_add_ps(distance,
+                                             _mm256_mul_ps(_mm256_set1_ps(plane.y), centersY));
+                    distance = _mm256_add_ps(distance,
+                                             _mm256_mul_ps(_mm256_set1_ps(plane.z), centersZ));
+                    distance = _mm256_add_ps(distance, _mm256_set1_ps(plane.w));
+
+                    visible = _mm256_and_ps(visible,
+                                            _mm256_cmp_ps(distance, negativeRadii, _CMP_GE_OQ));
+                }
+
+                visibleCount += compactVisible(visibleIndices + visibleCount,
+                                               static_cast<uint32_t>(i),
+                                               _mm256_movemask_ps(visible), 8);
+            }
+
+            return visibleCount + cullSpheresScalar(frustum, spheres, i, count,
+                                                    visibleIndices + visibleCount);
+        }
+
+        GAME_ENGINE_TARGET_AVX2
+        size_t cullBoxesAVX2(const Frustum &frustum, const BoxArrays &boxes,
+                             const size_t count, uint32_t *visibleIndices) {
+            size_t visibleCount = 0;
+            size_t i = 0;
+
+            for (; i + 8 <= count; i += 8) {
+                __m256 visible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+                for (const glm::vec4 &plane : frustum.planes) {
+                    const __m256 x = _mm256_loadu_ps((plane.x >= 0.0f ? boxes.maxX : boxes.minX) + i);
+                    const __m256 y = _mm256_loadu_ps((plane.y >= 0.0f ? boxes.maxY : boxes.minY) + i);
+                    const __m256 z = _mm256_loadu_ps((plane.z >= 0.0f ? boxes.maxZ : boxes.minZ) + i);
+
+                    __m256 distance = _mm256_mul_ps(_mm256_set1_ps(plane.x), x);
+                    distance = _mm256_add_ps(distance, _mm256_mul_ps(_mm256_set1_ps(plane.y), y));
+                    distance = _mm256_add_ps(distance, _mm256_mul_ps(_mm256_set1_ps(plane.z), z));
+                    distance = _mm256_add_ps(distance, _mm256_set1_ps(plane.w));
+
+                    visible = _mm256_and_ps(visible,
+                                            _mm256_cmp_ps(distance, _mm256_setzero_ps(), _CMP_GE_OQ));
+                }
+
+                visibleCount += compactVisible(visibleIndices + visibleCount,
+                                               static_cast<uint32_t>(i),
+                                               _mm256_movemask_ps(visible), 8);
+            }
+
+            return visibleCount + cullBoxesScalar(frustum, boxes, i, count,
+                                                  visibleIndices + visibleCount);
+        }
+
+        bool detectAVX2() {
+#if defined(_MSC_VER) && !defined(__clang__)
+            int cpuInfo[4] = {};
+            __cpuid(cpuInfo, 1);
+
+            const bool osSavesYmm = (cpuInfo[2] & (1 << 27)) != 0 &&
+                                    (_xgetbv(0) & 0x6) == 0x6;
+            if (!osSavesYmm) {
+                return false;
+            }
+
+            __cpuidex(cpuInfo, 7, 0);
+
+            return (cpuInfo[1] & (1 << 5)) != 0;
+#else
+            __builtin_cpu_init();
+
+            return __builtin_cpu_supports("avx2");
+#endif
+        }
+#endif
+    }
+
+    size_t FrustumCuller::addObject(const glm::vec3 &center, const float radius,
+                                    const glm::vec3 &min, const glm::vec3 &max) {
+        const size_t index = m_radii.size();
+
+        m_centersX.push_back(center.x);
+        m_centersY.push_back(center.y);
+        m_centersZ.push_back(center.z);
+        m_radii.push_back(radius);
+
+        m_minX.push_back(min.x);
+        m_minY.push_back(min.y);
+        m_minZ.push_back(min.z);
+        m_maxX.push_back(max.x);
+        m_maxY.push_back(max.y);
+        m_maxZ.push_back(max.z);
+
+        return index;
+    }
+
+    void FrustumCuller::setObject(const size_t index, const glm::vec3 &center,
+                                  const float radius, const glm::vec3 &min,
+                                  const glm::vec3 &max) {
+        m_centersX[index] = center.x;
+        m_centersY[index] = center.y;
+        m_centersZ[index] = center.z;
+        m_radii[index] = radius;
+
+        m_minX[index] = min.x;
+        m_minY[index] = min.y;
+        m_minZ[index] = min.z;
+        m_maxX[index] = max.x;
+        m_maxY[index] = max.y;
+        m_maxZ[index] = max.z;
+    }
+
+    void FrustumCuller::reserve(const size_t objectsCount) {
+        for (std::vector<float> *values : { &m_centersX, &m_centersY, &m_centersZ, &m_radii,
+                                            &m_minX, &m_minY, &m_minZ,
+                                            &m_maxX, &m_maxY, &m_maxZ }) {
+            values->reserve(objectsCount);
+        }
+    }
+
+    void FrustumCuller::clear() {
+        for (std::vector<float> *values : { &m_centersX, &m_centersY, &m_centersZ, &m_radii,
+                                            &m_minX, &m_minY, &m_minZ,
+                                            &m_maxX, &m_maxY, &m_maxZ }) {
+            values->clear();
+        }
+    }
+
+    size_t FrustumCuller::cullSpheres(const Frustum &frustum, const size_t objectsCount,
+                                      std::vector<uint32_t> &visibleIndices,
+                                      const CullingBackend backend) const {
+        const size_t count = std::min(objectsCount, getObjectsCount());
+        const SphereArrays spheres{ m_centersX.data(), m_centersY.data(),
+                                    m_centersZ.data(), m_radii.data() };
+
+        visibleIndices.resize(count);
+
+        size_t visibleCount = 0;
+        switch (isBackendSupported(backend) ? backend : CullingBackend::Scalar) {
+#if defined(GAME_ENGINE_CULLING_X86_64)
+            case CullingBackend::AVX2:
+                visibleCount = cullSpheresAVX2(frustum, spheres, count, visibleIndices.data());
+                break;
+            case CullingBackend::SSE:
+                visibleCount = cullSpheresSSE(frustum, spheres, count, visibleIndices.data());
+                break;
+#endif
+            default:
+                visibleCount = cullSpheresScalar(frustum, spheres, 0, count,
+                                                 visibleIndices.data());
+                break;
+        }
+
+        visibleIndices.resize(visibleCount);
+
+        return visibleCount;
+    }
+
+    size_t FrustumCuller::cullBoxes(const Frustum &frustum, const size_t objectsCount,
+                                    std::vector<uint32_t> &visibleIndices,
+                                    const CullingBackend backend) const {
+        const size_t count = std::min(objectsCount, getObjectsCount());
+        const BoxArrays boxes{ m_minX.data(), m_minY.data(), m_minZ.data(),
+                               m_maxX.data(), m_maxY.data(), m_maxZ.data() };
+
+        visibleIndices.resize(count);
+
+        size_t visibleCount = 0;
+        switch (isBackendSupported(backend) ? backend : CullingBackend::Scalar) {
+#if defined(GAME_ENGINE_CULLING_X86_64)
+            case CullingBackend::AVX2:
+                visibleCount = cullBoxesAVX2(frustum, boxes, count, visibleIndices.data());
+                break;
+            case CullingBackend::SSE:
+                visibleCount = cullBoxesSSE(frustum, boxes, count, visibleIndices.data());
+                break;
+#endif
+            default:
+                visibleCount = cullBoxesScalar(frustum, boxes, 0, count, visibleIndices.data());
+                break;
+        }
+
+        visibleIndices.resize(visibleCount);
+
+        return visibleCount;
+    }
+
+    bool FrustumCuller::isBackendSupported(const CullingBackend backend) {
+        switch (backend) {
+            case CullingBackend::Scalar:
+                return true;
+#if defined(GAME_ENGINE_CULLING_X86_64)
+            case CullingBackend::SSE:
+                return true;
+            case CullingBackend::AVX2: {
+                static const bool supported = detectAVX2();
+                return supported;
+            }
+#endif
+            default:
+                return false;
+        }
+    }
+
+    CullingBackend FrustumCuller::getBestBackend() {
+        if (isBackendSupported(CullingBackend::AVX2)) {
+            return CullingBackend::AVX2;
+        }
+
+        if (isBackendSupported(CullingBackend::SSE)) {
+            return CullingBackend::SSE;
+        }
+
+        return CullingBackend::Scalar;
+    }
+
+    const char *FrustumCuller::getBackendName(const CullingBackend backend) {
+        switch (backend) {
+            case CullingBackend::Scalar: return "Scalar";
+            case CullingBackend::SSE: return "SSE";
+            case CullingBackend::AVX2: return "AVX2";
+        }
+
+        return "Unknown";
+    }
+}
@@ -1,5 +1,8 @@
 #include "game_engine_core/input.hpp"
 
+#include <algorithm>
+#include <iterator>
+
 namespace game_engine {
     bool Input::m_keysPressed[static_cast<size_t>(KeyCode::KEY_LAST) + 1] = {};
     bool Input::m_mouseButtonsPressed[static_cast<size_t>(MouseButton::MOUSE_BUTTON_LAST) + 1] = {};
@@ -27,4 +30,9 @@ namespace game_engine {
     void Input::releaseMouseButton(const MouseButton mouseButton) {
         m_mouseButtonsPressed[static_cast<size_t>(mouseButton)] = false;
     }
+
+    void Input::reset() {
+        std::fill(std::begin(m_keysPressed), std::end(m_keysPressed), false);
+        std::fill(std::begin(m_mouseButtonsPressed), std::end(m_mouseButtonsPressed), false);
+    }
 }
@@ -0,0 +1,237 @@
+#include "game_engine_core/input_recording.hpp"
+#include "game_engine_core/log.hpp"
+
+#include <fstream>
+
+namespace game_engine {
+    struct InputRecordingFileHeader {
+        uint32_t magic = 0;
+        uint32_t version = 0;
+        double timeStep = 0.0;
+        uint32_t framesCount = 0;
+        uint32_t eventsCount = 0;
+    };
+
+    constexpr uint64_t s_recordedFrameSize = 2 * sizeof(glm::vec3) + sizeof(glm::vec2) +
+                                             sizeof(uint32_t);
+    constexpr uint64_t s_recordedEventSize = 2 * sizeof(uint8_t) + sizeof(int16_t) +
+                                             2 * sizeof(float);
+
+    template<typename T>
+    void writeInputRecordingValue(std::ofstream &file, const T &value) {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template<typename T>
+    bool readInputRecordingValue(std::ifstream &file, T &value) {
+        return static_cast<bool>(file.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+
+    void InputRecording::clear() {
+        m_frames.clear();
+        m_events.clear();
+    }
+
+    void InputRecording::addFrame(const glm::vec3 &cameraPosition,
+                                  const glm::vec3 &cameraRotation,
+                                  const glm::vec2 &cursorPosition) {
+        InputRecordingFrame &frame = m_frames.emplace_back();
+        frame.cameraPosition = cameraPosition;
+        frame.cameraRotation = cameraRotation;
+        frame.cursorPosition = cursorPosition;
+        frame.firstEvent = static_cast<uint32_t>(m_events.size());
+    }
+
+    void InputRecording::addEvent(const InputRecordingEvent &event) {
+        if (m_frames.empty()) {
+            return;
+        }
+
+        m_events.push_back(event);
+        ++m_frames.back().eventsCount;
+    }
+
+    void InputRecording::record(const EventKeyPressed &event) {
+        addEvent({ EventType::KeyPressed, static_cast<int32_t>(event.m_keyCode), event.m_repeated });
+    }
+
+    void InputRecording::record(const EventKeyReleased &event) {
+        addEvent({ EventType::KeyReleased, static_cast<int32_t>(event.m_keyCode) });
+    }
+
+    void InputRecording::record(const EventMouseButtonPressed &event) {
+        addEvent({ EventType::MouseButtonPressed, static_cast<int32_t>(event.m_mouseButton), false,
+                   static_cast<float>(event.m_positionX), static_cast<float>(event.m_positionY) });
+    }
+
+    void InputRecording::record(const EventMouseButtonReleased &event) {
+        addEvent({ EventType::MouseButtonReleased, static_cast<int32_t>(event.m_mouseButton), false,
+                   static_cast<float>(event.m_positionX), static_cast<float>(event.m_positionY) });
+    }
+
+    void InputRecording::record(const EventMouseMoved &event) {
+        addEvent({ EventType::MouseMoved, 0, false,
+                   static_cast<float>(event.x), static_cast<float>(event.y) });
+    }
+
+    void InputRecording::postFrameEvents(const size_t frameIndex,
+                                         EventDispatcher &eventDispatcher) const {
+        const InputRecordingFrame &frame = m_frames[frameIndex];
+
+        for (uint32_t i = frame.firstEvent; i < frame.firstEvent + frame.eventsCount; ++i) {
+            const InputRecordingEvent &event = m_events[i];
+
+            switch (event.type) {
+                case EventType::KeyPressed:
+                    eventDispatcher.post(EventKeyPressed{static_cast<KeyCode>(event.code),
+                                                         event.repeated});
+                    break;
+
+                case EventType::KeyReleased:
+                    eventDispatcher.post(EventKeyReleased{static_cast<KeyCode>(event.code)});
+                    break;
+
+                case EventType::MouseButtonPressed:
+                    eventDispatcher.post(EventMouseButtonPressed{
+                        static_cast<MouseButton>(event.code), event.x, event.y});
+                    break;
+
+                case EventType::MouseButtonReleased:
+                    eventDispatcher.post(EventMouseButtonReleased{
+                        static_cast<MouseButton>(event.code), event.x, event.y});
+                    break;
+
+                case EventType::MouseMoved:
+                    eventDispatcher.post(EventMouseMoved{event.x, event.y});
+                    break;
+
+                default:
+                    break;
+            }
+        }
+    }
+
+    bool InputRecording::save(const std::string &path) const {
+        std::ofstream file(path, std::ios::binary);
+
+        if (!file) {
+            LOG_CATEGORY_ERROR(Input, "InputRecording: can't open {0} for writing", path);
+
+            return false;
+        }
+
+        writeInputRecordingValue(file, s_fileMagic);
+        writeInputRecordingValue(file, s_fileVersion);
+        writeInputRecordingValue(file, m_timeStep);
+        writeInputRecordingValue(file, static_cast<uint32_t>(m_frames.size()));
+        writeInputRecordingValue(file, static_cast<uint32_t>(m_events.size()));
+
+        for (const InputRecordingFrame &frame : m_frames) {
+            writeInputRecordingValue(file, frame.cameraPosition);
+            writeInputRecordingValue(file, frame.cameraRotation);
+            writeInputRecordingValue(file, frame.cursorPosition);
+            writeInputRecordingValue(file, frame.eventsCount);
+        }
+
+        for (const InputRecordingEvent &event : m_events) {
+            writeInputRecordingValue(file, static_cast<uint8_t>(event.type));
+            writeInputRecordingValue(file, static_cast<uint8_t>(event.repeated));
+            writeInputRecordingValue(file, static_cast<int16_t>(event.code));
+            writeInputRecordingValue(file, event.x);
+            writeInputRecordingValue(file, event.y);
+        }
+
+        LOG_CATEGORY_INFO(Input, "InputRecording: saved {0} frames and {1} events to {2}",
+                          m_frames.size(), m_events.size(), path);
+
+        return static_cast<bool>(file);
+    }
+
+    bool InputRecording::load(const std::string &path) {
+        std::ifstream file(path, std::ios::binary);
+
+        if (!file) {
+            LOG_CATEGORY_ERROR(Input, "InputRecording: can't open {0}", path);
+
+            return false;
+        }
+
+        InputRecordingFileHeader header;
+        if (!readInputRecordingValue(file, header.magic) ||
+            !readInputRecordingValue(file, header.version) ||
+            header.magic != s_fileMagic || header.version != s_fileVersion) {
+            LOG_CATEGORY_ERROR(Input, "InputRecording: {0} is not a supported recording", path);
+
+            return false;
+        }
+
+        readInputRecordingValue(file, header.timeStep);
+        readInputRecordingValue(file, header.framesCount);
+        readInputRecordingValue(file, header.eventsCount);
+
+        const std::streamoff dataOffset = file.tellg();
+        file.seekg(0, std::ios::end);
+        const std::streamoff fileSize = file.tellg();
+        file.seekg(dataOffset);
+
+        if (!file || static_cast<uint64_t>(fileSize - dataOffset) <
+                     header.framesCount * s_recordedFrameSize +
+                     header.eventsCount * s_recordedEventSize) {
+            LOG_CATEGORY_ERROR(Input, "InputRecording: {0} is truncated or corrupted", path);
+
+            return false;
+        }
+
+        std::vector<InputRecordingFrame> frames(header.framesCount);
+        uint64_t firstEvent = 0;
+
+        for (InputRecordingFrame &frame : frames) {
+            readInputRecordingValue(file, frame.cameraPosition);
+            readInputRecordingValue(file, frame.cameraRotation);
+            readInputRecordingValue(file, frame.cursorPosition);
+            readInputRecordingValue(file, frame.eventsCount);
+
+            if (!file || frame.eventsCount > header.eventsCount - firstEvent) {
+                LOG_CATEGORY_ERROR(Input, "InputRecording: {0} is truncated or corrupted", path);
+
+                return false;
+            }
+
+            frame.firstEvent = static_cast<uint32_t>(firstEvent);
+            firstEvent += frame.eventsCount;
+        }
+
+        std::vector<InputRecordingEvent> events(header.eventsCount);
+
+        for (InputRecordingEvent &event : events) {
+            uint8_t type = 0;
+            uint8_t repeated = 0;
+            int16_t code = 0;
+
+            readInputRecordingValue(file, type);
+            readInputRecordingValue(file, repeated);
+            readInputRecordingValue(file, code);
+            readInputRecordingValue(file, event.x);
+            readInputRecordingValue(file, event.y);
+
+            event.type = static_cast<EventType>(type);
+            event.repeated = repeated != 0;
+            event.code = code;
+        }
+
+        if (!file || firstEvent != header.eventsCount || header.timeStep <= 0.0) {
+            LOG_CATEGORY_ERROR(Input, "InputRecording: {0} is truncated or corrupted", path);
+
+            return false;
+        }
+
+        m_timeStep = header.timeStep;
+        m_frames = std::move(frames);
+        m_events = std::move(events);
+
+        LOG_CATEGORY_INFO(Input, "InputRecording: loaded {0} frames and {1} events from {2}",
+                          m_frames.size(), m_events.size(), path);
+
+        return true;
+    }
+}
@@ -0,0 +1,253 @@
+#include "game_engine_core/jobs/job_system.hpp"
+#include "game_engine_core/jobs/work_stealing_deque.hpp"
+
+#include "game_engine_core/log.hpp"
+#include "game_engine_core/profiler.hpp"
+
+#include <vector>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <cstdint>
+
+namespace game_engine {
+    constexpr size_t s_jobsPerThreadCount = 4096;
+    constexpr size_t s_idleSpinsCount = 64;
+
+    struct WorkerContext {
+        WorkStealingDeque deque{s_jobsPerThreadCount};
+        std::unique_ptr<Job[]> jobs = std::make_unique<Job[]>(s_jobsPerThreadCount);
+        size_t nextJobIndex = 0;
+        uint32_t randomState = 0;
+    };
+
+    std::vector<std::unique_ptr<WorkerContext>> workerContexts;
+    std::vector<std::thread> workerThreads;
+    std::atomic<bool> isJobSystemRunning{false};
+    std::atomic<bool> isJobSystemStopping{false};
+    std::atomic<int> queuedJobsCount{0};
+    std::atomic<int> sleepingWorkersCount{0};
+    std::mutex sleepMutex;
+    std::condition_variable sleepCondition;
+
+    thread_local size_t currentThreadIndex = JobSystem::s_invalidThreadIndex;
+
+    uint32_t nextRandom(uint32_t &state) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+
+        return state;
+    }
+
+    Job *allocateJob(WorkerContext &context) {
+        for (;;) {
+            Job &job = context.jobs[context.nextJobIndex++ % s_jobsPerThreadCount];
+
+            if (!job.pending.load(std::memory_order_acquire)) {
+                return &job;
+            }
+
+            if (!JobSystem::runOneJob()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void JobSystem::executeJob(Job &job) {
+        if (job.dependency != nullptr && !job.dependency->isDone()) {
+            JobSystem::wait(*job.dependency);
+        }
+
+        {
+            PROFILE_SCOPE("Job");
+
+            job.function();
+        }
+        job.function = nullptr;
+
+        JobCounter *counter = job.counter;
+        job.pending.store(false, std::memory_order_release);
+
+        if (counter != nullptr) {
+            counter->m_value.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    void wakeWorker() {
+        if (sleepingWorkersCount.load() > 0) {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            sleepCondition.notify_one();
+        }
+    }
+
+    void workerLoop(const size_t threadIndex) {
+        currentThreadIndex = threadIndex;
+
+        PROFILE_THREAD("Job worker " + std::to_string(threadIndex));
+
+        size_t spinsCount = 0;
+        while (!isJobSystemStopping.load(std::memory_order_acquire)) {
+            if (JobSystem::runOneJob()) {
+                spinsCount = 0;
+                continue;
+            }
+
+            if (++spinsCount < s_idleSpinsCount) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            spinsCount = 0;
+
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            ++sleepingWorkersCount;
+            sleepCondition.wait(lock, []() {
+                return queuedJobsCount.load() > 0 || isJobSystemStopping.load();
+            });
+            --sleepingWorkersCount;
+        }
+
+        currentThreadIndex = JobSystem::s_invalidThreadIndex;
+    }
+
+    bool JobSystem::initialize(const size_t threadsCount) {
+        if (isJobSystemRunning.load()) {
+            LOG_WARNING("JobSystem: already initialized with {0} threads", workerContexts.size());
+
+            return false;
+        }
+
+        const size_t count = threadsCount > 0 ? threadsCount :
+                             std::max<size_t>(1, std::thread::hardware_concurrency());
+
+        workerContexts.clear();
+        for (size_t i = 0; i < count; ++i) {
+            workerContexts.push_back(std::make_unique<WorkerContext>());
+            workerContexts.back()->randomState = static_cast<uint32_t>(i * 2654435761u + 1);
+        }
+
+        queuedJobsCount = 0;
+        isJobSystemStopping = false;
+        isJobSystemRunning = true;
+        currentThreadIndex = 0;
+
+        for (size_t i = 1; i < count; ++i) {
+            workerThreads.emplace_back(workerLoop, i);
+        }
+
+        LOG_INFO("JobSystem: started {0} threads", count);
+
+        return true;
+    }
+
+    void JobSystem::shutdown() {
+        if (!isJobSystemRunning.load()) {
+            return;
+        }
+
+        while (runOneJob()) {
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            isJobSystemStopping = true;
+        }
+        sleepCondition.notify_all();
+
+        for (std::thread &thread : workerThreads) {
+            thread.join();
+        }
+
+        workerThreads.clear();
+        workerContexts.clear();
+        currentThreadIndex = s_invalidThreadIndex;
+        isJobSystemRunning = false;
+    }
+
+    bool JobSystem::isInitialized() {
+        return isJobSystemRunning.load();
+    }
+
+    size_t JobSystem::getThreadsCount() {
+        return isJobSystemRunning.load() ? workerContexts.size() : 1;
+    }
+
+    size_t JobSystem::getCurrentThreadIndex() {
+        return currentThreadIndex;
+    }
+
+    void JobSystem::run(std::function<void()> function, JobCounter *counter,
+                        const JobCounter *dependency) {
+        if (!isJobSystemRunning.load() || currentThreadIndex == s_invalidThreadIndex) {
+            if (dependency != nullptr) {
+                wait(*dependency);
+            }
+
+            function();
+
+            return;
+        }
+
+        WorkerContext &context = *workerContexts[currentThreadIndex];
+        Job *job = allocateJob(context);
+        job->function = std::move(function);
+        job->counter = counter;
+        job->dependency = dependency;
+        job->pending.store(true, std::memory_order_relaxed);
+
+        if (counter != nullptr) {
+            counter->m_value.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        ++queuedJobsCount;
+        if (!context.deque.push(job)) {
+            --queuedJobsCount;
+            executeJob(*job);
+
+            return;
+        }
+
+        wakeWorker();
+    }
+
+    void JobSystem::wait(const JobCounter &counter) {
+        while (!counter.isDone()) {
+            if (!runOneJob()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    bool JobSystem::runOneJob() {
+        if (currentThreadIndex == s_invalidThreadIndex) {
+            return false;
+        }
+
+        WorkerContext &context = *workerContexts[currentThreadIndex];
+        Job *job = context.deque.pop();
+
+        if (job == nullptr) {
+            const size_t contextsCount = workerContexts.size();
+            const size_t firstVictim = nextRandom(context.randomState) % contextsCount;
+
+            for (size_t i = 0; i < contextsCount && job == nullptr; ++i) {
+                const size_t victim = (firstVictim + i) % contextsCount;
+
+                if (victim != currentThreadIndex) {
+                    job = workerContexts[victim]->deque.steal();
+                }
+            }
+        }
+
+        if (job == nullptr) {
+            return false;
+        }
+
+        --queuedJobsCount;
+        executeJob(*job);
+
+        return true;
+    }
+}
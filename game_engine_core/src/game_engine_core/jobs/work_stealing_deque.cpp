@@ -0,0 +1,71 @@
+#include "game_engine_core/jobs/work_stealing_deque.hpp"
+
+namespace game_engine {
+    WorkStealingDeque::WorkStealingDeque(const size_t capacity) {
+        size_t powerOfTwoCapacity = 1;
+        while (powerOfTwoCapacity < capacity) {
+            powerOfTwoCapacity <<= 1;
+        }
+
+        m_jobs = std::make_unique<std::atomic<Job*>[]>(powerOfTwoCapacity);
+        m_mask = powerOfTwoCapacity - 1;
+    }
+
+    bool WorkStealingDeque::push(Job *job) {
+        const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+        const int64_t top = m_top.load(std::memory_order_acquire);
+
+        if (bottom - top > static_cast<int64_t>(m_mask)) {
+            return false;
+        }
+
+        m_jobs[static_cast<size_t>(bottom) & m_mask].store(job, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+
+        return true;
+    }
+
+    Job *WorkStealingDeque::pop() {
+        const int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        m_bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t top = m_top.load(std::memory_order_relaxed);
+
+        if (top > bottom) {
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+
+            return nullptr;
+        }
+
+        Job *job = m_jobs[static_cast<size_t>(bottom) & m_mask].load(std::memory_order_relaxed);
+        if (top == bottom) {
+            if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                               std::memory_order_relaxed)) {
+                job = nullptr;
+            }
+
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+
+        return job;
+    }
+
+    Job *WorkStealingDeque::steal() {
+        int64_t top = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t bottom = m_bottom.load(std::memory_order_acquire);
+
+        if (top >= bottom) {
+            return nullptr;
+        }
+
+        Job *job = m_jobs[static_cast<size_t>(top) & m_mask].load(std::memory_order_relaxed);
+        if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                           std::memory_order_relaxed)) {
+            return nullptr;
+        }
+
+        return job;
+    }
+}
@@ -1 +1,299 @@
+#include "game_engine_core/log.hpp"
 
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+
+namespace game_engine {
+    struct LogRateLimit {
+        std::atomic<int64_t> windowStartMs{0};
+        std::atomic<uint32_t> messagesCount{0};
+        std::atomic<uint32_t> suppressedCount{0};
+    };
+
+    struct LogSlot {
+        std::atomic<size_t> sequence{0};
+        LogRecord record;
+    };
+
+    constexpr std::array<const char*, static_cast<size_t>(LogCategory::CategoriesCount)>
+        logCategoryNames = { "core", "render", "input", "window", "ui" };
+    constexpr auto logFlushInterval = std::chrono::milliseconds(5);
+
+    std::array<std::atomic<LogLevel>, static_cast<size_t>(LogCategory::CategoriesCount)>
+        Log::s_levels = { LogLevel::Info, LogLevel::Info, LogLevel::Info, LogLevel::Info,
+                          LogLevel::Info };
+    std::atomic<bool> Log::s_isBinaryMode{false};
+
+    std::unique_ptr<LogSlot[]> logSlots;
+    alignas(64) std::atomic<size_t> logEnqueuePosition{0};
+    alignas(64) size_t logDequeuePosition = 0;
+
+    std::thread logFlushThread;
+    std::mutex logFlushMutex;
+    std::condition_variable logFlushCondition;
+    std::atomic<bool> isLogRunning{false};
+    std::atomic<bool> isLogStopping{false};
+    std::atomic<uint32_t> logWritersCount{0};
+
+    std::array<LogRateLimit, Log::s_rateLimitsCount> logRateLimits;
+
+    std::atomic<uint64_t> droppedLogMessagesCount{0};
+    std::atomic<uint64_t> suppressedLogMessagesCount{0};
+
+    spdlog::level::level_enum toSpdlogLevel(const LogLevel level) {
+        switch (level) {
+            case LogLevel::Trace:
+                return spdlog::level::trace;
+            case LogLevel::Info:
+                return spdlog::level::info;
+            case LogLevel::Warning:
+                return spdlog::level::warn;
+            case LogLevel::Error:
+                return spdlog::level::err;
+            case LogLevel::Critical:
+                return spdlog::level::critical;
+            case LogLevel::Off:
+                return spdlog::level::off;
+        }
+
+        return spdlog::level::info;
+    }
+
+    void writeLogMessage(const std::chrono::system_clock::time_point time,
+                         const LogCategory category, const LogLevel level,
+                         const std::string_view message) {
+        spdlog::default_logger_raw()->log(time, spdlog::source_loc{}, toSpdlogLevel(level),
+                                          fmt::format("[{}] {}", Log::getCategoryName(category),
+                                                      message));
+    }
+
+    bool consumeLogRecords() {
+        bool consumed = false;
+        std::string message;
+
+        for (;;) {
+            LogSlot &slot = logSlots[logDequeuePosition % Log::s_queueCapacity];
+
+            if (slot.sequence.load(std::memory_order_acquire) != logDequeuePosition + 1) {
+                break;
+            }
+
+            const LogRecord &record = slot.record;
+            if (record.formatFunction != nullptr) {
+                record.formatFunction(record, message);
+            } else {
+                message.assign(reinterpret_cast<const char*>(record.payload), record.payloadLength);
+            }
+
+            writeLogMessage(record.time, record.category, record.level, message);
+
+            slot.sequence.store(logDequeuePosition + Log::s_queueCapacity,
+                                std::memory_order_release);
+            ++logDequeuePosition;
+            consumed = true;
+        }
+
+        return consumed;
+    }
+
+    void logFlushLoop() {
+        while (!isLogStopping.load()) {
+            if (consumeLogRecords()) {
+                spdlog::default_logger_raw()->flush();
+            }
+
+            std::unique_lock<std::mutex> lock(logFlushMutex);
+            logFlushCondition.wait_for(lock, logFlushInterval, []() {
+                return isLogStopping.load();
+            });
+        }
+
+        consumeLogRecords();
+        spdlog::default_logger_raw()->flush();
+    }
+
+    void Log::initialize() {
+        if (isLogRunning.load()) {
+            return;
+        }
+
+        logSlots = std::make_unique<LogSlot[]>(s_queueCapacity);
+        for (size_t i = 0; i < s_queueCapacity; ++i) {
+            logSlots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        logEnqueuePosition.store(0);
+        logDequeuePosition = 0;
+
+        isLogStopping = false;
+        isLogRunning = true;
+        logFlushThread = std::thread(logFlushLoop);
+    }
+
+    void Log::shutdown() {
+        if (!isLogRunning.exchange(false)) {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(logFlushMutex);
+            isLogStopping = true;
+        }
+
+        logFlushCondition.notify_one();
+        logFlushThread.join();
+
+        while (logWritersCount.load() > 0) {
+            std::this_thread::yield();
+        }
+
+        consumeLogRecords();
+        spdlog::default_logger_raw()->flush();
+        logSlots.reset();
+
+        const uint64_t droppedCount = droppedLogMessagesCount.load();
+        if (droppedCount > 0) {
+            spdlog::warn("[core] {} log messages were dropped", droppedCount);
+        }
+    }
+
+    bool Log::isInitialized() {
+        return isLogRunning.load();
+    }
+
+    void Log::setLevel(const LogCategory category, const LogLevel level) {
+        s_levels[static_cast<size_t>(category)].store(level, std::memory_order_relaxed);
+    }
+
+    LogLevel Log::getLevel(const LogCategory category) {
+        return s_levels[static_cast<size_t>(category)].load(std::memory_order_relaxed);
+    }
+
+    const char *Log::getCategoryName(const LogCategory category) {
+        return logCategoryNames[static_cast<size_t>(category)];
+    }
+
+    void Log::setBinaryMode(const bool enabled) {
+        s_isBinaryMode.store(enabled, std::memory_order_relaxed);
+    }
+
+    uint64_t Log::getDroppedMessagesCount() {
+        return droppedLogMessagesCount.load(std::memory_order_relaxed);
+    }
+
+    uint64_t Log::getSuppressedMessagesCount() {
+        return suppressedLogMessagesCount.load(std::memory_order_relaxed);
+    }
+
+    bool Log::acquireRateLimit(const void *callSite, uint32_t &suppressedCount) {
+        const size_t callSiteHash = std::hash<const void*>{}(callSite);
+        LogRateLimit &rateLimit = logRateLimits[(callSiteHash ^ (callSiteHash >> 12)) %
+                                                s_rateLimitsCount];
+
+        const int64_t nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        int64_t windowStartMs = rateLimit.windowStartMs.load(std::memory_order_relaxed);
+
+        if (nowMs - windowStartMs >= s_rateLimitWindowMs &&
+            rateLimit.windowStartMs.compare_exchange_strong(windowStartMs, nowMs,
+                                                            std::memory_order_relaxed)) {
+            rateLimit.messagesCount.store(0, std::memory_order_relaxed);
+            suppressedCount = rateLimit.suppressedCount.exchange(0, std::memory_order_relaxed);
+        }
+
+        if (rateLimit.messagesCount.fetch_add(1, std::memory_order_relaxed) >=
+            s_rateLimitMessagesCount) {
+            rateLimit.suppressedCount.fetch_add(1, std::memory_order_relaxed);
+            suppressedLogMessagesCount.fetch_add(1, std::memory_order_relaxed);
+
+            return false;
+        }
+
+        return true;
+    }
+
+    void Log::writeSuppressedNotice(const LogCategory category, const LogLevel level,
+                                    const uint32_t suppressedCount) {
+        fmt::basic_memory_buffer<char, 64> buffer;
+        fmt::format_to(std::back_inserter(buffer), "{} similar messages suppressed",
+                       suppressedCount);
+
+        writeText(category, level, std::string_view(buffer.data(), buffer.size()));
+    }
+
+    void Log::writeText(const LogCategory category, const LogLevel level,
+                        const std::string_view message) {
+        if (!isLogRunning.load(std::memory_order_acquire) ||
+            message.size() > LogRecord::s_payloadSize) {
+            writeLogMessage(std::chrono::system_clock::now(), category, level, message);
+
+            return;
+        }
+
+        LogRecord *record = acquireRecord();
+        if (record == nullptr) {
+            return;
+        }
+
+        record->time = std::chrono::system_clock::now();
+        record->formatFunction = nullptr;
+        record->format = nullptr;
+        record->formatLength = 0;
+        record->payloadLength = static_cast<uint32_t>(message.size());
+        record->level = level;
+        record->category = category;
+        std::memcpy(record->payload, message.data(), message.size());
+
+        publishRecord(record);
+    }
+
+    LogRecord *Log::acquireRecord() {
+        logWritersCount.fetch_add(1);
+
+        if (!isLogRunning.load()) {
+            logWritersCount.fetch_sub(1, std::memory_order_release);
+            droppedLogMessagesCount.fetch_add(1, std::memory_order_relaxed);
+
+            return nullptr;
+        }
+
+        size_t position = logEnqueuePosition.load(std::memory_order_relaxed);
+
+        for (;;) {
+            LogSlot &slot = logSlots[position % s_queueCapacity];
+            const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            const intptr_t difference = static_cast<intptr_t>(sequence) -
+                                        static_cast<intptr_t>(position);
+
+            if (difference == 0) {
+                if (logEnqueuePosition.compare_exchange_weak(position, position + 1,
+                                                             std::memory_order_relaxed)) {
+                    return &slot.record;
+                }
+            } else if (difference < 0) {
+                logWritersCount.fetch_sub(1, std::memory_order_release);
+                droppedLogMessagesCount.fetch_add(1, std::memory_order_relaxed);
+
+                return nullptr;
+            } else {
+                position = logEnqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void Log::publishRecord(LogRecord *record) {
+        LogSlot *slot = reinterpret_cast<LogSlot*>(reinterpret_cast<std::byte*>(record) -
+                                                   offsetof(LogSlot, record));
+        const size_t position = slot->sequence.load(std::memory_order_relaxed);
+
+        slot->sequence.store(position + 1, std::memory_order_release);
+
+        if (record->level >= LogLevel::Error) {
+            logFlushCondition.notify_one();
+        }
+
+        logWritersCount.fetch_sub(1, std::memory_order_release);
+    }
+}
@@ -1,12 +1,53 @@
 #include "game_engine_core/modules/UI_module.hpp"
+#include "game_engine_core/rendering/OpenGL/state_tracker_OpenGL.hpp"
+#include "game_engine_core/rendering/OpenGL/gpu_profiler.hpp"
+#include "game_engine_core/profiler.hpp"
 
 #include <imgui/imgui.h>
+#include <imgui/imgui_internal.h>
 #include <imgui/backends/imgui_impl_opengl3.h>
 #include <imgui/backends/imgui_impl_glfw.h>
 
 #include "GLFW/glfw3.h"
 
 namespace game_engine {
+    constexpr float s_headlessUIDeltaTime = 1.0f / 60.0f;
+
+    bool isUIPlatformBackendInitialized = false;
+
+    UIDrawSnapshot::UIDrawSnapshot() : m_drawData{std::make_unique<ImDrawData>()} {}
+
+    UIDrawSnapshot::~UIDrawSnapshot() {
+        clear();
+    }
+
+    void UIDrawSnapshot::capture(const ImDrawData &drawData) {
+        clear();
+
+        m_drawData->Valid = drawData.Valid;
+        m_drawData->DisplayPos = drawData.DisplayPos;
+        m_drawData->DisplaySize = drawData.DisplaySize;
+        m_drawData->FramebufferScale = drawData.FramebufferScale;
+        m_drawData->TotalIdxCount = drawData.TotalIdxCount;
+        m_drawData->TotalVtxCount = drawData.TotalVtxCount;
+
+        for (int i = 0; i < drawData.CmdListsCount; ++i) {
+            m_drawData->CmdLists.push_back(drawData.CmdLists[i]->CloneOutput());
+        }
+
+        m_drawData->CmdListsCount = drawData.CmdListsCount;
+    }
+
+    void UIDrawSnapshot::clear() {
+        for (ImDrawList *drawList : m_drawData->CmdLists) {
+            IM_DELETE(drawList);
+        }
+
+        m_drawData->CmdLists.clear();
+        m_drawData->CmdListsCount = 0;
+        m_drawData->Valid = false;
+    }
+
     void UIModule::onWindowCreate(GLFWwindow* window) {
         IMGUI_CHECKVERSION();
         ImGui::CreateContext();
@@ -17,21 +58,66 @@ namespace game_engine {
 
         ImGui_ImplOpenGL3_Init();
         ImGui_ImplGlfw_InitForOpenGL(window, true);
+        isUIPlatformBackendInitialized = true;
+    }
+
+    void UIModule::onHeadlessCreate(const unsigned int width, const unsigned int height) {
+        IMGUI_CHECKVERSION();
+        ImGui::CreateContext();
+
+        ImGuiIO &io = ImGui::GetIO();
+        io.ConfigFlags |= ImGuiConfigFlags_::ImGuiConfigFlags_DockingEnable;
+        io.IniFilename = nullptr;
+        io.DisplaySize = ImVec2(static_cast<float>(width), static_cast<float>(height));
+        io.DeltaTime = s_headlessUIDeltaTime;
+
+        ImGui_ImplOpenGL3_Init();
+        isUIPlatformBackendInitialized = false;
     }
 
     void UIModule::onWindowClose() {
         ImGui_ImplOpenGL3_Shutdown();
-        ImGui_ImplGlfw_Shutdown();
+
+        if (isUIPlatformBackendInitialized) {
+            ImGui_ImplGlfw_Shutdown();
+            isUIPlatformBackendInitialized = false;
+        }
+
         ImGui::DestroyContext();
     }
 
+    void UIModule::setViewportsEnabled(const bool enabled) {
+        ImGuiIO &io = ImGui::GetIO();
+
+        if (enabled) {
+            io.ConfigFlags |= ImGuiConfigFlags_::ImGuiConfigFlags_ViewportsEnable;
+        } else {
+            io.ConfigFlags &= ~ImGuiConfigFlags_::ImGuiConfigFlags_ViewportsEnable;
+        }
+    }
+
+    void UIModule::createDeviceObjects() {
+        ImGui_ImplOpenGL3_CreateDeviceObjects();
+    }
+
+    bool UIModule::needsRedraw() {
+        return GImGui->InputEventsQueue.Size > 0 || ImGui::GetIO().WantTextInput;
+    }
+
     void UIModule::onUIDrawBegin() {
         ImGui_ImplOpenGL3_NewFrame();
-        ImGui_ImplGlfw_NewFrame();
+
+        if (isUIPlatformBackendInitialized) {
+            ImGui_ImplGlfw_NewFrame();
+        }
+
         ImGui::NewFrame();
     }
 
     void UIModule::onUIDrawEnd() {
+        PROFILE_SCOPE("UIModule::onUIDrawEnd");
+        PROFILE_GPU_SCOPE("UI");
+
         ImGui::Render();
         ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 
@@ -42,5 +128,23 @@ namespace game_engine {
             ImGui::RenderPlatformWindowsDefault();
             glfwMakeContextCurrent(backupCurrentContext);
         }
+
+        StateTrackerOpenGL::invalidate();
+    }
+
+    void UIModule::onUIDrawEnd(UIDrawSnapshot &snapshot) {
+        PROFILE_SCOPE("UIModule::onUIDrawEnd");
+
+        ImGui::Render();
+        snapshot.capture(*ImGui::GetDrawData());
+    }
+
+    void UIModule::renderSnapshot(const UIDrawSnapshot &snapshot) {
+        PROFILE_SCOPE("UIModule::renderSnapshot");
+        PROFILE_GPU_SCOPE("UI");
+
+        ImGui_ImplOpenGL3_RenderDrawData(snapshot.getDrawData());
+
+        StateTrackerOpenGL::invalidate();
     }
 }
@@ -0,0 +1,168 @@
+#include "game_engine_core/modules/performance_overlay.hpp"
+#include "game_engine_core/frame_stats.hpp"
+#include "game_engine_core/profiler.hpp"
+
+#include <imgui/imgui.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+namespace game_engine {
+    constexpr float s_overlayGraphHeight = 80.0f;
+    constexpr double s_bytesInKilobyte = 1024.0;
+    constexpr double s_bytesInMegabyte = 1024.0 * 1024.0;
+
+    std::vector<float> overlayFrameTimes;
+    float overlayFrameBudgetMs = 0.0f;
+
+    void drawFrameTimeGraph(const char *label, const std::vector<float> &frameTimes,
+                            const double budgetMs) {
+        if (frameTimes.empty()) {
+            return;
+        }
+
+        float maximumMs = *std::max_element(frameTimes.begin(), frameTimes.end());
+        float averageMs = 0.0f;
+        for (const float frameTimeMs : frameTimes) {
+            averageMs += frameTimeMs;
+        }
+        averageMs /= static_cast<float>(frameTimes.size());
+
+        char overlayText[64];
+        std::snprintf(overlayText, sizeof(overlayText), "avg %.2f ms, max %.2f ms", averageMs, maximumMs);
+
+        const float scaleMaximum = std::max(maximumMs, static_cast<float>(budgetMs) * 1.5f);
+        ImGui::PlotLines(label, frameTimes.data(), static_cast<int>(frameTimes.size()), 0,
+                         overlayText, 0.0f, scaleMaximum, ImVec2(0.0f, s_overlayGraphHeight));
+    }
+
+    void drawCountersTable(const FrameStatsSample &sample) {
+        if (!ImGui::BeginTable("Counters", 2, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+            return;
+        }
+
+        const auto drawRow = [](const char *name, const char *format, const double value) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(name);
+            ImGui::TableNextColumn();
+            ImGui::Text(format, value);
+        };
+
+        drawRow("Draw calls", "%.0f", static_cast<double>(sample.get(FrameCounter::DrawCalls)));
+        drawRow("Triangles", "%.0f", static_cast<double>(sample.get(FrameCounter::Triangles)));
+        drawRow("State changes", "%.0f",
+                static_cast<double>(sample.get(FrameCounter::StateChanges)));
+        drawRow("Uploaded", "%.1f KB",
+                static_cast<double>(sample.get(FrameCounter::UploadedBytes)) / s_bytesInKilobyte);
+        drawRow("Allocations", "%.0f", static_cast<double>(sample.get(FrameCounter::Allocations)));
+        drawRow("Texture memory", "%.1f MB",
+                static_cast<double>(sample.textureMemoryBytes) / s_bytesInMegabyte);
+        drawRow("Resident textures", "%.1f MB",
+                static_cast<double>(sample.residentTextureBytes) / s_bytesInMegabyte);
+        drawRow("Evicted mips", "%.0f",
+                static_cast<double>(sample.get(FrameCounter::TextureEvictions)));
+
+        ImGui::EndTable();
+    }
+
+    void drawStagesTable(const char *label, const std::vector<ProfileStageStats> &stages) {
+        if (stages.empty()) {
+            ImGui::TextUnformatted("No profile scopes recorded");
+
+            return;
+        }
+
+        if (!ImGui::BeginTable(label, 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+            return;
+        }
+
+        ImGui::TableSetupColumn("Stage");
+        ImGui::TableSetupColumn("CPU ms");
+        ImGui::TableSetupColumn("GPU ms");
+        ImGui::TableHeadersRow();
+
+        for (const ProfileStageStats &stage : stages) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(stage.name);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", stage.cpuTimeMs);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", stage.gpuTimeMs);
+        }
+
+        ImGui::EndTable();
+    }
+
+    void drawSpikes() {
+        overlayFrameBudgetMs = static_cast<float>(FrameStats::getFrameBudget());
+        if (ImGui::SliderFloat("Frame budget (ms)", &overlayFrameBudgetMs, 0.0f, 100.0f, "%.1f")) {
+            FrameStats::setFrameBudget(overlayFrameBudgetMs);
+        }
+
+        const std::vector<FrameStatsSpike> &spikes = FrameStats::getSpikes();
+
+        ImGui::Text("Spikes: %zu", spikes.size());
+        ImGui::SameLine();
+        if (ImGui::Button("Clear")) {
+            FrameStats::clearSpikes();
+
+            return;
+        }
+
+        std::vector<float> spikeFrameTimes;
+        for (size_t i = spikes.size(); i-- > 0;) {
+            const FrameStatsSpike &spike = spikes[i];
+
+            ImGui::PushID(static_cast<int>(i));
+
+            if (ImGui::TreeNode("Spike", "Frame %llu: %.2f ms (budget %.1f ms)",
+                                static_cast<unsigned long long>(spike.frameIndex),
+                                spike.frameTimeMs, spike.budgetMs)) {
+                spikeFrameTimes.clear();
+                for (const FrameStatsSample &sample : spike.frames) {
+                    spikeFrameTimes.push_back(static_cast<float>(sample.frameTimeMs));
+                }
+
+                drawFrameTimeGraph("##SpikeFrameTimes", spikeFrameTimes, spike.budgetMs);
+
+                if (!spike.frames.empty()) {
+                    drawCountersTable(spike.frames.back());
+                }
+
+                drawStagesTable("SpikeStages", spike.stages);
+
+                ImGui::TreePop();
+            }
+
+            ImGui::PopID();
+        }
+    }
+
+    void PerformanceOverlay::draw(bool &isOpen) {
+        if (!ImGui::Begin("Performance", &isOpen)) {
+            ImGui::End();
+
+            return;
+        }
+
+        FrameStats::copyFrameTimes(overlayFrameTimes);
+        drawFrameTimeGraph("##FrameTimes", overlayFrameTimes, FrameStats::getFrameBudget());
+
+        if (FrameStats::getHistoryCount() > 0) {
+            drawCountersTable(FrameStats::getLastSample());
+        }
+
+        if (ImGui::CollapsingHeader("Stages", ImGuiTreeNodeFlags_DefaultOpen)) {
+            drawStagesTable("Stages", Profiler::getStageStats());
+        }
+
+        if (ImGui::CollapsingHeader("Spikes")) {
+            drawSpikes();
+        }
+
+        ImGui::End();
+    }
+}
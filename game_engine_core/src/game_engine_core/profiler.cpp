@@ -0,0 +1,404 @@
+#include "game_engine_core/profiler.hpp"
+#include "game_engine_core/log.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace game_engine {
+    struct ThreadProfileBuffer {
+        std::unique_ptr<ProfileEvent[]> events =
+            std::make_unique<ProfileEvent[]>(Profiler::s_threadEventsCapacity);
+        std::atomic<uint64_t> writeIndex{0};
+        uint64_t readIndex = 0;
+        std::atomic<bool> isInUse{false};
+        uint32_t threadId = 0;
+        std::string threadName;
+    };
+
+    struct ThreadProfileBufferOwner {
+        ThreadProfileBuffer *buffer = nullptr;
+
+        ~ThreadProfileBufferOwner() {
+            if (buffer != nullptr) {
+                buffer->isInUse.store(false, std::memory_order_release);
+            }
+        }
+    };
+
+    struct CapturedProfileEvent {
+        ProfileEvent event;
+        uint32_t threadId;
+    };
+
+    enum class ProfileCaptureState {
+        Idle = 0,
+        Pending,
+        Capturing,
+        Finishing,
+        Ready
+    };
+
+    constexpr uint32_t s_gpuTrackThreadId = 0;
+
+    std::mutex profileBuffersMutex;
+    std::vector<std::unique_ptr<ThreadProfileBuffer>> profileBuffers;
+    thread_local ThreadProfileBufferOwner profileBufferOwner;
+    std::atomic<uint64_t> droppedProfileEventsCount{0};
+
+    ProfileCaptureState profileCaptureState = ProfileCaptureState::Idle;
+    size_t requestedCaptureFramesCount = 0;
+    size_t captureTailFramesCount = 0;
+    uint32_t captureFramesThreadId = 0;
+    std::vector<uint64_t> captureFrameBoundaries;
+    std::vector<CapturedProfileEvent> frameProfileEvents;
+    std::vector<ProfileStageStats> profileStageStats;
+    std::vector<ProfileStageStats> frameProfileStageTimes;
+    std::vector<CapturedProfileEvent> capturedProfileEvents;
+    std::vector<std::pair<uint32_t, std::string>> capturedThreadNames;
+
+    ThreadProfileBuffer &getThreadProfileBuffer() {
+        if (profileBufferOwner.buffer != nullptr) {
+            return *profileBufferOwner.buffer;
+        }
+
+        std::lock_guard<std::mutex> lock(profileBuffersMutex);
+
+        for (const std::unique_ptr<ThreadProfileBuffer> &buffer : profileBuffers) {
+            bool expected = false;
+
+            if (buffer->isInUse.compare_exchange_strong(expected, true)) {
+                profileBufferOwner.buffer = buffer.get();
+                break;
+            }
+        }
+
+        if (profileBufferOwner.buffer == nullptr) {
+            profileBuffers.push_back(std::make_unique<ThreadProfileBuffer>());
+            profileBuffers.back()->isInUse = true;
+            profileBuffers.back()->threadId = static_cast<uint32_t>(profileBuffers.size());
+
+            profileBufferOwner.buffer = profileBuffers.back().get();
+        }
+
+        profileBufferOwner.buffer->threadName =
+            "Thread " + std::to_string(profileBufferOwner.buffer->threadId);
+
+        return *profileBufferOwner.buffer;
+    }
+
+    void drainProfileBuffer(ThreadProfileBuffer &buffer, std::vector<CapturedProfileEvent> &events) {
+        const uint64_t capacity = Profiler::s_threadEventsCapacity;
+        const uint64_t writeIndex = buffer.writeIndex.load(std::memory_order_acquire);
+        uint64_t readIndex = buffer.readIndex;
+
+        if (writeIndex - readIndex > capacity) {
+            droppedProfileEventsCount += writeIndex - readIndex - capacity;
+            readIndex = writeIndex - capacity;
+        }
+
+        const size_t firstCapturedIndex = events.size();
+        for (uint64_t i = readIndex; i < writeIndex; ++i) {
+            events.push_back({ buffer.events[i % capacity], buffer.threadId });
+        }
+
+        const uint64_t overwrittenIndex = buffer.writeIndex.load(std::memory_order_acquire);
+        if (overwrittenIndex >= capacity && readIndex <= overwrittenIndex - capacity) {
+            const uint64_t tornCount = std::min(overwrittenIndex - capacity + 1, writeIndex) -
+                                       readIndex;
+
+            events.erase(events.begin() + firstCapturedIndex,
+                         events.begin() + firstCapturedIndex + tornCount);
+            droppedProfileEventsCount += tornCount;
+        }
+
+        buffer.readIndex = writeIndex;
+    }
+
+    void drainProfileBuffers(std::vector<CapturedProfileEvent> &events) {
+        std::lock_guard<std::mutex> lock(profileBuffersMutex);
+
+        for (const std::unique_ptr<ThreadProfileBuffer> &buffer : profileBuffers) {
+            drainProfileBuffer(*buffer, events);
+        }
+    }
+
+    ProfileStageStats &findProfileStage(std::vector<ProfileStageStats> &stages, const char *name) {
+        for (ProfileStageStats &stage : stages) {
+            if (stage.name == name || std::strcmp(stage.name, name) == 0) {
+                return stage;
+            }
+        }
+
+        return stages.emplace_back(ProfileStageStats{ name, 0.0, 0.0 });
+    }
+
+    void updateProfileStageStats() {
+        frameProfileStageTimes.clear();
+
+        for (const CapturedProfileEvent &captured : frameProfileEvents) {
+            const ProfileEvent &event = captured.event;
+            ProfileStageStats &stage = findProfileStage(frameProfileStageTimes, event.name);
+            const double durationMs = static_cast<double>(event.endNs - std::min(event.endNs,
+                                                                                 event.beginNs)) /
+                                      1000000.0;
+
+            if (event.gpu) {
+                stage.gpuTimeMs += durationMs;
+            } else {
+                stage.cpuTimeMs += durationMs;
+            }
+        }
+
+        for (const ProfileStageStats &frameStage : frameProfileStageTimes) {
+            findProfileStage(profileStageStats, frameStage.name);
+        }
+
+        for (ProfileStageStats &stage : profileStageStats) {
+            const ProfileStageStats &frameStage = findProfileStage(frameProfileStageTimes, stage.name);
+
+            stage.cpuTimeMs += (frameStage.cpuTimeMs - stage.cpuTimeMs) *
+                               Profiler::s_stageStatsSmoothing;
+            stage.gpuTimeMs += (frameStage.gpuTimeMs - stage.gpuTimeMs) *
+                               Profiler::s_stageStatsSmoothing;
+        }
+
+        std::sort(profileStageStats.begin(), profileStageStats.end(),
+            [](const ProfileStageStats &first, const ProfileStageStats &second) {
+                return first.cpuTimeMs + first.gpuTimeMs > second.cpuTimeMs + second.gpuTimeMs;
+            });
+    }
+
+    void finishProfileCapture() {
+        const uint64_t captureBeginNs = captureFrameBoundaries.front();
+        const uint64_t captureEndNs = captureFrameBoundaries.back();
+
+        capturedProfileEvents.erase(std::remove_if(capturedProfileEvents.begin(),
+            capturedProfileEvents.end(),
+            [captureBeginNs, captureEndNs](const CapturedProfileEvent &captured) {
+                return captured.event.endNs < captureBeginNs ||
+                       captured.event.beginNs >= captureEndNs;
+            }), capturedProfileEvents.end());
+
+        std::sort(capturedProfileEvents.begin(), capturedProfileEvents.end(),
+            [](const CapturedProfileEvent &first, const CapturedProfileEvent &second) {
+                return first.event.beginNs < second.event.beginNs;
+            });
+
+        capturedThreadNames.clear();
+        {
+            std::lock_guard<std::mutex> lock(profileBuffersMutex);
+
+            for (const std::unique_ptr<ThreadProfileBuffer> &buffer : profileBuffers) {
+                capturedThreadNames.emplace_back(buffer->threadId, buffer->threadName);
+            }
+        }
+
+        profileCaptureState = ProfileCaptureState::Ready;
+
+        LOG_INFO("Profiler: captured {0} events over {1} frames",
+                 capturedProfileEvents.size(), captureFrameBoundaries.size() - 1);
+    }
+
+    void writeTraceString(std::ostream &stream, const char *string) {
+        stream << '"';
+
+        for (const char *character = string; *character != '\0'; ++character) {
+            if (*character == '"' || *character == '\\') {
+                stream << '\\';
+            }
+
+            stream << *character;
+        }
+
+        stream << '"';
+    }
+
+    void writeTraceEvent(std::ostream &stream, const char *name, const char *category,
+                         const uint32_t threadId, const uint64_t beginNs, const uint64_t endNs,
+                         const uint64_t captureBeginNs) {
+        const uint64_t clampedBeginNs = std::max(beginNs, captureBeginNs);
+
+        stream << ",\n{\"name\":";
+        writeTraceString(stream, name);
+        stream << ",\"cat\":\"" << category << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << threadId
+               << ",\"ts\":" << static_cast<double>(clampedBeginNs - captureBeginNs) / 1000.0
+               << ",\"dur\":" << static_cast<double>(endNs - std::min(endNs, clampedBeginNs)) / 1000.0
+               << "}";
+    }
+
+    void Profiler::setThreadName(const std::string &name) {
+        ThreadProfileBuffer &buffer = getThreadProfileBuffer();
+
+        std::lock_guard<std::mutex> lock(profileBuffersMutex);
+        buffer.threadName = name;
+    }
+
+    void Profiler::beginFrame() {
+        const uint64_t frameBeginNs = getTimeNs();
+
+        frameProfileEvents.clear();
+        drainProfileBuffers(frameProfileEvents);
+        updateProfileStageStats();
+
+        switch (profileCaptureState) {
+            case ProfileCaptureState::Pending:
+                captureFrameBoundaries.assign(1, frameBeginNs);
+                captureFramesThreadId = getThreadProfileBuffer().threadId;
+                profileCaptureState = ProfileCaptureState::Capturing;
+
+                break;
+
+            case ProfileCaptureState::Capturing:
+                captureFrameBoundaries.push_back(frameBeginNs);
+                capturedProfileEvents.insert(capturedProfileEvents.end(),
+                                             frameProfileEvents.begin(), frameProfileEvents.end());
+
+                if (captureFrameBoundaries.size() > requestedCaptureFramesCount) {
+                    captureTailFramesCount = s_captureTailFramesCount;
+                    profileCaptureState = ProfileCaptureState::Finishing;
+                }
+
+                break;
+
+            case ProfileCaptureState::Finishing:
+                capturedProfileEvents.insert(capturedProfileEvents.end(),
+                                             frameProfileEvents.begin(), frameProfileEvents.end());
+
+                if (--captureTailFramesCount == 0) {
+                    finishProfileCapture();
+                }
+
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    void Profiler::recordEvent(const char *name, const uint64_t beginNs, const uint64_t endNs,
+                               const bool gpu) {
+        ThreadProfileBuffer &buffer = getThreadProfileBuffer();
+        const uint64_t writeIndex = buffer.writeIndex.load(std::memory_order_relaxed);
+
+        buffer.events[writeIndex % s_threadEventsCapacity] = ProfileEvent{ name, beginNs, endNs, gpu };
+        buffer.writeIndex.store(writeIndex + 1, std::memory_order_release);
+    }
+
+    bool Profiler::captureFrames(const size_t framesCount) {
+        if (profileCaptureState == ProfileCaptureState::Pending ||
+            profileCaptureState == ProfileCaptureState::Capturing ||
+            profileCaptureState == ProfileCaptureState::Finishing) {
+            LOG_WARNING("Profiler: capture is already in progress");
+
+            return false;
+        }
+
+        if (framesCount == 0 || framesCount > s_maxCaptureFramesCount) {
+            LOG_ERROR("Profiler: can't capture {0} frames, limit is {1}",
+                      framesCount, s_maxCaptureFramesCount);
+
+            return false;
+        }
+
+        capturedProfileEvents.clear();
+        captureFrameBoundaries.clear();
+        requestedCaptureFramesCount = framesCount;
+        profileCaptureState = ProfileCaptureState::Pending;
+
+        return true;
+    }
+
+    bool Profiler::isCapturing() {
+        return profileCaptureState != ProfileCaptureState::Idle &&
+               profileCaptureState != ProfileCaptureState::Ready;
+    }
+
+    bool Profiler::hasCapture() {
+        return profileCaptureState == ProfileCaptureState::Ready;
+    }
+
+    size_t Profiler::getCapturedFramesCount() {
+        return captureFrameBoundaries.empty() ? 0 : captureFrameBoundaries.size() - 1;
+    }
+
+    size_t Profiler::getCapturedEventsCount() {
+        return capturedProfileEvents.size();
+    }
+
+    void Profiler::recordDroppedEvents(const uint64_t count) {
+        droppedProfileEventsCount += count;
+    }
+
+    uint64_t Profiler::getDroppedEventsCount() {
+        return droppedProfileEventsCount.load();
+    }
+
+    const std::vector<ProfileStageStats> &Profiler::getStageStats() {
+        return profileStageStats;
+    }
+
+    bool Profiler::exportChromeTrace(const std::string &path) {
+        if (!hasCapture()) {
+            LOG_WARNING("Profiler: there is no finished capture to export");
+
+            return false;
+        }
+
+        std::ofstream file(path, std::ios::out | std::ios::trunc);
+
+        if (!file) {
+            LOG_ERROR("Profiler: can't open '{0}' for writing", path);
+
+            return false;
+        }
+
+        const uint64_t captureBeginNs = captureFrameBoundaries.front();
+
+        file << std::fixed << std::setprecision(3);
+        file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+        file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"game_engine\"}}";
+        file << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << s_gpuTrackThreadId
+             << ",\"args\":{\"name\":\"GPU\"}}";
+
+        for (const auto &[threadId, threadName] : capturedThreadNames) {
+            file << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << threadId
+                 << ",\"args\":{\"name\":";
+            writeTraceString(file, threadName.c_str());
+            file << "}}";
+        }
+
+        for (size_t i = 0; i + 1 < captureFrameBoundaries.size(); ++i) {
+            const std::string frameName = "Frame " + std::to_string(i);
+
+            writeTraceEvent(file, frameName.c_str(), "frame", captureFramesThreadId,
+                            captureFrameBoundaries[i], captureFrameBoundaries[i + 1],
+                            captureBeginNs);
+        }
+
+        for (const CapturedProfileEvent &captured : capturedProfileEvents) {
+            const ProfileEvent &event = captured.event;
+
+            writeTraceEvent(file, event.name, event.gpu ? "gpu" : "cpu",
+                            event.gpu ? s_gpuTrackThreadId : captured.threadId,
+                            event.beginNs, event.endNs, captureBeginNs);
+        }
+
+        file << "\n]}\n";
+
+        if (!file.good()) {
+            LOG_ERROR("Profiler: failed to write trace to '{0}'", path);
+
+            return false;
+        }
+
+        LOG_INFO("Profiler: exported {0} events to '{1}'", capturedProfileEvents.size(), path);
+
+        return true;
+    }
+}
@@ -0,0 +1,67 @@
+#include "game_engine_core/rendering/OpenGL/framebuffer.hpp"
+#include "game_engine_core/rendering/OpenGL/renderer_OpenGL.hpp"
+#include "game_engine_core/frame_stats.hpp"
+#include "game_engine_core/log.hpp"
+
+#include "glad/glad.h"
+
+namespace game_engine {
+    constexpr size_t s_framebufferColorBytesPerTexel = 4;
+    constexpr size_t s_framebufferDepthBytesPerTexel = 4;
+
+    Framebuffer::Framebuffer(const unsigned int width, const unsigned int height)
+        : m_width{width}, m_height{height} {
+        glCreateTextures(GL_TEXTURE_2D, 1, &m_colorTextureId);
+        glTextureStorage2D(m_colorTextureId, 1, GL_RGBA8, m_width, m_height);
+        glTextureParameteri(m_colorTextureId, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTextureParameteri(m_colorTextureId, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+        glCreateRenderbuffers(1, &m_depthRenderbufferId);
+        glNamedRenderbufferStorage(m_depthRenderbufferId, GL_DEPTH24_STENCIL8, m_width, m_height);
+
+        glCreateFramebuffers(1, &m_id);
+        glNamedFramebufferTexture(m_id, GL_COLOR_ATTACHMENT0, m_colorTextureId, 0);
+        glNamedFramebufferRenderbuffer(m_id, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER,
+                                       m_depthRenderbufferId);
+
+        const GLenum status = glCheckNamedFramebufferStatus(m_id, GL_FRAMEBUFFER);
+        m_isComplete = status == GL_FRAMEBUFFER_COMPLETE;
+
+        if (!m_isComplete) {
+            LOG_CATEGORY_ERROR(Render, "Framebuffer {0}x{1} is incomplete, status {2:#x}",
+                               m_width, m_height, status);
+        }
+
+        m_memorySize = static_cast<size_t>(m_width) * m_height *
+                       (s_framebufferColorBytesPerTexel + s_framebufferDepthBytesPerTexel);
+
+        FrameStats::add(FrameCounter::Allocations, 3);
+        FrameStats::addTextureMemory(static_cast<int64_t>(m_memorySize));
+    }
+
+    Framebuffer::~Framebuffer() {
+        RendererOpenGL::releaseFramebuffer(m_id);
+        RendererOpenGL::releaseRenderbuffer(m_depthRenderbufferId);
+        RendererOpenGL::releaseTexture(m_colorTextureId);
+        FrameStats::addTextureMemory(-static_cast<int64_t>(m_memorySize));
+    }
+
+    void Framebuffer::bind() const {
+        glBindFramebuffer(GL_FRAMEBUFFER, m_id);
+        RendererOpenGL::setViewport(m_width, m_height);
+    }
+
+    void Framebuffer::unbind() {
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    }
+
+    void Framebuffer::readPixels(std::vector<unsigned char> &pixels) const {
+        pixels.resize(static_cast<size_t>(m_width) * m_height * s_framebufferColorBytesPerTexel);
+
+        glNamedFramebufferReadBuffer(m_id, GL_COLOR_ATTACHMENT0);
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, m_id);
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        glReadPixels(0, 0, m_width, m_height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+    }
+}
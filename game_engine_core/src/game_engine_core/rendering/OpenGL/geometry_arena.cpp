@@ -0,0 +1,97 @@
+#include "game_engine_core/rendering/OpenGL/geometry_arena.hpp"
+
+#include "game_engine_core/log.hpp"
+
+#include <algorithm>
+
+namespace game_engine {
+    RangeAllocator::RangeAllocator(const size_t capacity)
+        : m_freeRanges{{0, capacity}}, m_capacity{capacity} {}
+
+    size_t RangeAllocator::allocate(const size_t size) {
+        for (auto iterator = m_freeRanges.begin(); iterator != m_freeRanges.end(); ++iterator) {
+            if (iterator->size < size) {
+                continue;
+            }
+
+            const size_t offset = iterator->offset;
+            iterator->offset += size;
+            iterator->size -= size;
+
+            if (iterator->size == 0) {
+                m_freeRanges.erase(iterator);
+            }
+
+            m_used += size;
+
+            return offset;
+        }
+
+        return s_invalidOffset;
+    }
+
+    void RangeAllocator::free(const size_t offset, const size_t size) {
+        auto next = std::lower_bound(m_freeRanges.begin(), m_freeRanges.end(), offset,
+            [](const FreeRange &range, const size_t rangeOffset) {
+                return range.offset < rangeOffset;
+            });
+
+        next = m_freeRanges.insert(next, FreeRange{offset, size});
+        m_used -= size;
+
+        if (next + 1 != m_freeRanges.end() && next->offset + next->size == (next + 1)->offset) {
+            next->size += (next + 1)->size;
+            m_freeRanges.erase(next + 1);
+        }
+
+        if (next != m_freeRanges.begin() && (next - 1)->offset + (next - 1)->size == next->offset) {
+            (next - 1)->size += next->size;
+            m_freeRanges.erase(next);
+        }
+    }
+
+    GeometryArena::GeometryArena(BufferLayout bufferLayout, const size_t maxVerticesCount,
+                                 const size_t maxIndicesCount)
+        : m_vertexBuffer{nullptr, maxVerticesCount * bufferLayout.getStride(), bufferLayout,
+                         VertexBuffer::TypeDrawUsage::Dynamic},
+          m_indexBuffer{nullptr, maxIndicesCount, VertexBuffer::TypeDrawUsage::Dynamic},
+          m_verticesAllocator{maxVerticesCount},
+          m_indicesAllocator{maxIndicesCount},
+          m_stride{bufferLayout.getStride()} {
+        m_vertexArray.addVertexBuffer(m_vertexBuffer);
+        m_vertexArray.setIndexBuffer(m_indexBuffer);
+    }
+
+    bool GeometryArena::addMesh(const void *vertices, const size_t verticesCount,
+                                const unsigned int *indices, const size_t indicesCount,
+                                MeshRange &meshRange) {
+        const size_t baseVertex = m_verticesAllocator.allocate(verticesCount);
+
+        if (baseVertex == RangeAllocator::s_invalidOffset) {
+            LOG_CATEGORY_ERROR(Render, "GeometryArena: no room for {0} vertices", verticesCount);
+
+            return false;
+        }
+
+        const size_t firstIndex = m_indicesAllocator.allocate(indicesCount);
+
+        if (firstIndex == RangeAllocator::s_invalidOffset) {
+            LOG_CATEGORY_ERROR(Render, "GeometryArena: no room for {0} indices", indicesCount);
+            m_verticesAllocator.free(baseVertex, verticesCount);
+
+            return false;
+        }
+
+        m_vertexBuffer.setData(vertices, verticesCount * m_stride, baseVertex * m_stride);
+        m_indexBuffer.setData(indices, indicesCount, firstIndex);
+
+        meshRange = MeshRange{baseVertex, verticesCount, firstIndex, indicesCount};
+
+        return true;
+    }
+
+    void GeometryArena::removeMesh(const MeshRange &meshRange) {
+        m_verticesAllocator.free(meshRange.baseVertex, meshRange.verticesCount);
+        m_indicesAllocator.free(meshRange.firstIndex, meshRange.indicesCount);
+    }
+}
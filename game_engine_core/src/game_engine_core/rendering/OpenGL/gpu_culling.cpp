@@ -0,0 +1,204 @@
+#include "game_engine_core/rendering/OpenGL/gpu_culling.hpp"
+
+#include "game_engine_core/rendering/OpenGL/renderer_OpenGL.hpp"
+#include "game_engine_core/rendering/OpenGL/state_tracker_OpenGL.hpp"
+#include "game_engine_core/log.hpp"
+#include "game_engine_core/frame_stats.hpp"
+
+#include "glad/glad.h"
+
+#include <algorithm>
+
+namespace game_engine {
+    constexpr unsigned int s_cullingGroupSize = 64;
+
+    const char *cullingComputeShader =
+        R"(#version 450
+            layout(local_size_x = 64) in;
+
+            struct CullObject {
+                vec4 bounding_sphere;
+                mat4 model_matrix;
+                uint first_index;
+                uint indices_count;
+                int base_vertex;
+                uint material_index;
+            };
+
+            struct DrawCommand {
+                uint count;
+                uint instance_count;
+                uint first_index;
+                int base_vertex;
+                uint base_instance;
+            };
+
+            struct DrawData {
+                mat4 model_matrix;
+                uint material_index;
+            };
+
+            layout(std430, binding = 0) writeonly buffer DrawDataBuffer {
+                DrawData draws[];
+            };
+
+            layout(std430, binding = 1) readonly buffer CullObjectsBuffer {
+                CullObject objects[];
+            };
+
+            layout(std430, binding = 2) writeonly buffer DrawCommandsBuffer {
+                DrawCommand commands[];
+            };
+
+            layout(std430, binding = 3) buffer DrawCountBuffer {
+                uint draw_count;
+            };
+
+            uniform vec4 frustum_planes[6];
+            uniform int objects_count;
+
+            void main() {
+                const uint index = gl_GlobalInvocationID.x;
+
+                if (index >= uint(objects_count)) {
+                    return;
+                }
+
+                const CullObject object = objects[index];
+                const vec3 center = (object.model_matrix *
+                    vec4(object.bounding_sphere.xyz, 1.0)).xyz;
+                const float scale = max(length(object.model_matrix[0].xyz),
+                    max(length(object.model_matrix[1].xyz), length(object.model_matrix[2].xyz)));
+                const float radius = object.bounding_sphere.w * scale;
+
+                for (int i = 0; i < 6; ++i) {
+                    if (dot(frustum_planes[i].xyz, center) + frustum_planes[i].w < -radius) {
+                        return;
+                    }
+                }
+
+                const uint slot = atomicAdd(draw_count, 1u);
+
+                commands[slot] = DrawCommand(object.indices_count, 1u, object.first_index,
+                                             object.base_vertex, slot);
+                draws[slot] = DrawData(object.model_matrix, object.material_index);
+            }
+        )";
+
+    GpuCulling::GpuCulling(const size_t maxObjectsCount)
+        : m_cullingProgram{cullingComputeShader}, m_maxObjectsCount{maxObjectsCount} {
+        m_frustumPlanesLocation = m_cullingProgram.getUniformLocation("frustum_planes");
+        m_objectsCountLocation = m_cullingProgram.getUniformLocation("objects_count");
+
+        glCreateBuffers(1, &m_objectsBufferId);
+        glNamedBufferData(m_objectsBufferId, maxObjectsCount * sizeof(GpuCullingObject),
+                          nullptr, GL_STATIC_DRAW);
+
+        glCreateBuffers(1, &m_commandsBufferId);
+        glNamedBufferData(m_commandsBufferId, maxObjectsCount * sizeof(DrawElementsIndirectCommand),
+                          nullptr, GL_DYNAMIC_COPY);
+
+        glCreateBuffers(1, &m_drawDataBufferId);
+        glNamedBufferData(m_drawDataBufferId, maxObjectsCount * sizeof(IndirectDrawData),
+                          nullptr, GL_DYNAMIC_COPY);
+
+        glCreateBuffers(1, &m_drawCountBufferId);
+        glNamedBufferData(m_drawCountBufferId, sizeof(GLuint), nullptr, GL_DYNAMIC_COPY);
+
+        FrameStats::add(FrameCounter::Allocations, 4);
+
+        if (!RendererOpenGL::isIndirectCountSupported()) {
+            LOG_CATEGORY_WARNING(Render, "GpuCulling: glMultiDrawElementsIndirectCount is unavailable, "
+                        "culled draws fall back to zeroed indirect commands");
+        }
+    }
+
+    GpuCulling::~GpuCulling() {
+        for (const unsigned int bufferId : { m_objectsBufferId, m_commandsBufferId,
+                                             m_drawDataBufferId, m_drawCountBufferId }) {
+            RendererOpenGL::releaseBuffer(bufferId);
+        }
+    }
+
+    void GpuCulling::setObjects(const std::vector<GpuCullingObject> &objects) {
+        m_objectsCount = std::min(objects.size(), m_maxObjectsCount);
+
+        if (m_objectsCount < objects.size()) {
+            LOG_CATEGORY_WARNING(Render, "GpuCulling: {0} objects exceed capacity {1}, extra objects are ignored",
+                        objects.size(), m_maxObjectsCount);
+        }
+
+        glNamedBufferSubData(m_objectsBufferId, 0, m_objectsCount * sizeof(GpuCullingObject),
+                             objects.data());
+
+        FrameStats::add(FrameCounter::UploadedBytes, m_objectsCount * sizeof(GpuCullingObject));
+    }
+
+    void GpuCulling::cull(const Frustum &frustum, const size_t objectsCount) {
+        m_culledObjectsCount = std::min(objectsCount, m_objectsCount);
+
+        const GLuint zero = 0;
+        glClearNamedBufferData(m_drawCountBufferId, GL_R32UI, GL_RED_INTEGER,
+                               GL_UNSIGNED_INT, &zero);
+
+        if (!RendererOpenGL::isIndirectCountSupported()) {
+            glClearNamedBufferData(m_commandsBufferId, GL_R32UI, GL_RED_INTEGER,
+                                   GL_UNSIGNED_INT, &zero);
+        }
+
+        if (m_culledObjectsCount == 0) {
+            return;
+        }
+
+        m_cullingProgram.setVec4Array(m_frustumPlanesLocation, frustum.planes.data(),
+                                      frustum.planes.size());
+        m_cullingProgram.setInt(m_objectsCountLocation, static_cast<int>(m_culledObjectsCount));
+        m_cullingProgram.bind();
+
+        StateTrackerOpenGL::bindBufferBase(BufferTarget::ShaderStorage,
+            static_cast<unsigned int>(StorageBlockBinding::DrawData), m_drawDataBufferId);
+        StateTrackerOpenGL::bindBufferBase(BufferTarget::ShaderStorage,
+            static_cast<unsigned int>(StorageBlockBinding::CullObjects), m_objectsBufferId);
+        StateTrackerOpenGL::bindBufferBase(BufferTarget::ShaderStorage,
+            static_cast<unsigned int>(StorageBlockBinding::DrawCommands), m_commandsBufferId);
+        StateTrackerOpenGL::bindBufferBase(BufferTarget::ShaderStorage,
+            static_cast<unsigned int>(StorageBlockBinding::DrawCount), m_drawCountBufferId);
+
+        const unsigned int groupsCount = static_cast<unsigned int>(
+            (m_culledObjectsCount + s_cullingGroupSize - 1) / s_cullingGroupSize);
+        RendererOpenGL::dispatchCompute(groupsCount);
+        RendererOpenGL::indirectCommandsBarrier();
+    }
+
+    size_t GpuCulling::readVisibleCount() const {
+        if (m_culledObjectsCount == 0) {
+            return 0;
+        }
+
+        glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+
+        GLuint visibleCount = 0;
+        glGetNamedBufferSubData(m_drawCountBufferId, 0, sizeof(visibleCount), &visibleCount);
+
+        return visibleCount;
+    }
+
+    void GpuCulling::draw(const GeometryArena &geometryArena) const {
+        if (m_culledObjectsCount == 0) {
+            return;
+        }
+
+        StateTrackerOpenGL::bindBufferBase(BufferTarget::ShaderStorage,
+            static_cast<unsigned int>(StorageBlockBinding::DrawData), m_drawDataBufferId);
+        StateTrackerOpenGL::bindBuffer(BufferTarget::DrawIndirect, m_commandsBufferId);
+        StateTrackerOpenGL::bindBuffer(BufferTarget::Parameter, m_drawCountBufferId);
+
+        if (!RendererOpenGL::multiDrawIndirectCount(geometryArena.getVertexArray(), 0, 0,
+                                                    m_culledObjectsCount)) {
+            RendererOpenGL::multiDrawIndirect(geometryArena.getVertexArray(), 0,
+                                              m_culledObjectsCount);
+        }
+
+        FrameStats::add(FrameCounter::DrawCalls);
+    }
+}
@@ -0,0 +1,164 @@
+#include "game_engine_core/rendering/OpenGL/gpu_profiler.hpp"
+
+#include "glad/glad.h"
+
+#include <array>
+#include <cstdint>
+
+namespace game_engine {
+    constexpr size_t s_invalidGpuScopeIndex = static_cast<size_t>(-1);
+
+    struct GpuQueryScope {
+        const char *name = nullptr;
+        bool isEnded = false;
+    };
+
+    struct GpuQueryFrame {
+        std::array<GpuQueryScope, GpuProfiler::s_maxScopesPerFrameCount> scopes;
+        size_t scopesCount = 0;
+        GLuint lastQuery = 0;
+        int64_t cpuTimeOffsetNs = 0;
+    };
+
+    std::array<GLuint, GpuProfiler::s_queryFramesCount *
+                       GpuProfiler::s_maxScopesPerFrameCount * 2> gpuProfilerQueries{};
+    std::array<GpuQueryFrame, GpuProfiler::s_queryFramesCount> gpuQueryFrames;
+    size_t gpuQueryFrameIndex = 0;
+    bool areGpuQueriesCreated = false;
+    bool isGpuQueryFrameActive = false;
+
+    std::array<size_t, GpuProfiler::s_maxScopesDepth> gpuScopesStack;
+    size_t gpuScopesDepth = 0;
+
+    GLuint getGpuProfilerQuery(const size_t frameIndex, const size_t scopeIndex, const bool end) {
+        return gpuProfilerQueries[(frameIndex * GpuProfiler::s_maxScopesPerFrameCount +
+                                   scopeIndex) * 2 + (end ? 1 : 0)];
+    }
+
+    size_t getEndedScopesCount(const GpuQueryFrame &frame) {
+        size_t endedScopesCount = 0;
+
+        for (size_t i = 0; i < frame.scopesCount; ++i) {
+            if (frame.scopes[i].isEnded) {
+                ++endedScopesCount;
+            }
+        }
+
+        return endedScopesCount;
+    }
+
+    void readbackGpuQueryFrame(const size_t frameIndex) {
+        GpuQueryFrame &frame = gpuQueryFrames[frameIndex];
+
+        if (frame.scopesCount == 0 || frame.lastQuery == 0) {
+            return;
+        }
+
+        GLuint isAvailable = GL_FALSE;
+        glGetQueryObjectuiv(frame.lastQuery, GL_QUERY_RESULT_AVAILABLE, &isAvailable);
+
+        if (isAvailable == GL_FALSE) {
+            Profiler::recordDroppedEvents(getEndedScopesCount(frame));
+
+            return;
+        }
+
+        for (size_t i = 0; i < frame.scopesCount; ++i) {
+            if (!frame.scopes[i].isEnded) {
+                continue;
+            }
+
+            GLuint64 beginTime = 0;
+            GLuint64 endTime = 0;
+            glGetQueryObjectui64v(getGpuProfilerQuery(frameIndex, i, false), GL_QUERY_RESULT,
+                                  &beginTime);
+            glGetQueryObjectui64v(getGpuProfilerQuery(frameIndex, i, true), GL_QUERY_RESULT,
+                                  &endTime);
+
+            Profiler::recordEvent(frame.scopes[i].name,
+                                  static_cast<uint64_t>(static_cast<int64_t>(beginTime) +
+                                                        frame.cpuTimeOffsetNs),
+                                  static_cast<uint64_t>(static_cast<int64_t>(endTime) +
+                                                        frame.cpuTimeOffsetNs),
+                                  true);
+        }
+    }
+
+    void GpuProfiler::beginFrame() {
+        if (!areGpuQueriesCreated) {
+            glCreateQueries(GL_TIMESTAMP, static_cast<GLsizei>(gpuProfilerQueries.size()),
+                            gpuProfilerQueries.data());
+            areGpuQueriesCreated = true;
+        }
+
+        gpuQueryFrameIndex = (gpuQueryFrameIndex + 1) % s_queryFramesCount;
+        readbackGpuQueryFrame(gpuQueryFrameIndex);
+
+        GpuQueryFrame &frame = gpuQueryFrames[gpuQueryFrameIndex];
+        frame.scopesCount = 0;
+        frame.lastQuery = 0;
+
+        GLint64 gpuTime = 0;
+        glGetInteger64v(GL_TIMESTAMP, &gpuTime);
+        frame.cpuTimeOffsetNs = static_cast<int64_t>(Profiler::getTimeNs()) -
+                                static_cast<int64_t>(gpuTime);
+
+        gpuScopesDepth = 0;
+        isGpuQueryFrameActive = true;
+    }
+
+    void GpuProfiler::beginScope(const char *name) {
+        if (!isGpuQueryFrameActive || gpuScopesDepth == s_maxScopesDepth) {
+            return;
+        }
+
+        GpuQueryFrame &frame = gpuQueryFrames[gpuQueryFrameIndex];
+
+        if (frame.scopesCount == s_maxScopesPerFrameCount) {
+            gpuScopesStack[gpuScopesDepth++] = s_invalidGpuScopeIndex;
+
+            return;
+        }
+
+        const size_t scopeIndex = frame.scopesCount++;
+        frame.scopes[scopeIndex] = GpuQueryScope{ name, false };
+        gpuScopesStack[gpuScopesDepth++] = scopeIndex;
+
+        glQueryCounter(getGpuProfilerQuery(gpuQueryFrameIndex, scopeIndex, false), GL_TIMESTAMP);
+    }
+
+    void GpuProfiler::endScope() {
+        if (!isGpuQueryFrameActive || gpuScopesDepth == 0) {
+            return;
+        }
+
+        const size_t scopeIndex = gpuScopesStack[--gpuScopesDepth];
+
+        if (scopeIndex == s_invalidGpuScopeIndex) {
+            return;
+        }
+
+        GpuQueryFrame &frame = gpuQueryFrames[gpuQueryFrameIndex];
+        const GLuint query = getGpuProfilerQuery(gpuQueryFrameIndex, scopeIndex, true);
+
+        glQueryCounter(query, GL_TIMESTAMP);
+        frame.scopes[scopeIndex].isEnded = true;
+        frame.lastQuery = query;
+    }
+
+    void GpuProfiler::release() {
+        if (areGpuQueriesCreated) {
+            glDeleteQueries(static_cast<GLsizei>(gpuProfilerQueries.size()),
+                            gpuProfilerQueries.data());
+            areGpuQueriesCreated = false;
+        }
+
+        for (GpuQueryFrame &frame : gpuQueryFrames) {
+            frame.scopesCount = 0;
+            frame.lastQuery = 0;
+        }
+
+        gpuScopesDepth = 0;
+        isGpuQueryFrameActive = false;
+    }
+}
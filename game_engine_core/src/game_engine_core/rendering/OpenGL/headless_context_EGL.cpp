@@ -0,0 +1,202 @@
+#include "game_engine_core/rendering/OpenGL/headless_context_EGL.hpp"
+#include "game_engine_core/log.hpp"
+
+#ifdef GAME_ENGINE_HAS_EGL
+    #include <EGL/egl.h>
+    #include <EGL/eglext.h>
+
+    #include <cstring>
+#endif
+
+namespace game_engine {
+#ifdef GAME_ENGINE_HAS_EGL
+    EGLDisplay headlessDisplay = EGL_NO_DISPLAY;
+    EGLContext headlessContext = EGL_NO_CONTEXT;
+
+    bool hasEGLExtension(const char *extensions, const char *extension) {
+        if (extensions == nullptr) {
+            return false;
+        }
+
+        const size_t extensionLength = std::strlen(extension);
+
+        for (const char *position = std::strstr(extensions, extension); position != nullptr;
+             position = std::strstr(position + extensionLength, extension)) {
+            const bool isWordStart = position == extensions || position[-1] == ' ';
+            const bool isWordEnd = position[extensionLength] == ' ' ||
+                                   position[extensionLength] == '\0';
+
+            if (isWordStart && isWordEnd) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    EGLDisplay getHeadlessEGLDisplay() {
+        const char *clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+        const auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+            eglGetProcAddress("eglGetPlatformDisplayEXT"));
+
+        if (getPlatformDisplay != nullptr &&
+            hasEGLExtension(clientExtensions, "EGL_MESA_platform_surfaceless")) {
+            const EGLDisplay display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA,
+                                                          EGL_DEFAULT_DISPLAY, nullptr);
+
+            if (display != EGL_NO_DISPLAY) {
+                return display;
+            }
+        }
+
+        LOG_CATEGORY_WARNING(Render, "HeadlessContextEGL: surfaceless platform is unavailable, "
+                             "falling back to the default display");
+
+        return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    }
+
+    bool HeadlessContextEGL::isSupported() {
+        return true;
+    }
+
+    bool HeadlessContextEGL::create() {
+        if (headlessContext != EGL_NO_CONTEXT) {
+            LOG_CATEGORY_WARNING(Render, "HeadlessContextEGL: context is already created");
+
+            return false;
+        }
+
+        headlessDisplay = getHeadlessEGLDisplay();
+
+        EGLint majorVersion = 0;
+        EGLint minorVersion = 0;
+        if (headlessDisplay == EGL_NO_DISPLAY ||
+            !eglInitialize(headlessDisplay, &majorVersion, &minorVersion)) {
+            LOG_CATEGORY_CRITICAL(Render, "HeadlessContextEGL: failed to initialize EGL display, error {0:#x}",
+                                  eglGetError());
+            headlessDisplay = EGL_NO_DISPLAY;
+
+            return false;
+        }
+
+        LOG_CATEGORY_INFO(Render, "HeadlessContextEGL: EGL {0}.{1} ({2})", majorVersion, minorVersion,
+                          eglQueryString(headlessDisplay, EGL_VENDOR));
+
+        if (!hasEGLExtension(eglQueryString(headlessDisplay, EGL_EXTENSIONS),
+                             "EGL_KHR_surfaceless_context")) {
+            LOG_CATEGORY_CRITICAL(Render, "HeadlessContextEGL: EGL_KHR_surfaceless_context is not supported");
+            destroy();
+
+            return false;
+        }
+
+        if (!eglBindAPI(EGL_OPENGL_API)) {
+            LOG_CATEGORY_CRITICAL(Render, "HeadlessContextEGL: desktop OpenGL API is not supported");
+            destroy();
+
+            return false;
+        }
+
+        const EGLint configAttributes[] = {
+            EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+            EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+            EGL_RED_SIZE, 8,
+            EGL_GREEN_SIZE, 8,
+            EGL_BLUE_SIZE, 8,
+            EGL_NONE
+        };
+
+        EGLConfig config = nullptr;
+        EGLint configsCount = 0;
+        if (!eglChooseConfig(headlessDisplay, configAttributes, &config, 1, &configsCount) ||
+            configsCount == 0) {
+            LOG_CATEGORY_CRITICAL(Render, "HeadlessContextEGL: no suitable EGL config");
+            destroy();
+
+            return false;
+        }
+
+        const EGLint contextAttributes[] = {
+            EGL_CONTEXT_MAJOR_VERSION, s_contextMajorVersion,
+            EGL_CONTEXT_MINOR_VERSION, s_contextMinorVersion,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+            EGL_NONE
+        };
+
+        headlessContext = eglCreateContext(headlessDisplay, config, EGL_NO_CONTEXT,
+                                           contextAttributes);
+
+        if (headlessContext == EGL_NO_CONTEXT) {
+            LOG_CATEGORY_CRITICAL(Render, "HeadlessContextEGL: failed to create OpenGL {0}.{1} core context, "
+                                  "error {2:#x}", s_contextMajorVersion, s_contextMinorVersion,
+                                  eglGetError());
+            destroy();
+
+            return false;
+        }
+
+        if (!makeCurrent()) {
+            LOG_CATEGORY_CRITICAL(Render, "HeadlessContextEGL: failed to make context current, error {0:#x}",
+                                  eglGetError());
+            destroy();
+
+            return false;
+        }
+
+        return true;
+    }
+
+    void HeadlessContextEGL::destroy() {
+        if (headlessDisplay == EGL_NO_DISPLAY) {
+            return;
+        }
+
+        eglMakeCurrent(headlessDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+
+        if (headlessContext != EGL_NO_CONTEXT) {
+            eglDestroyContext(headlessDisplay, headlessContext);
+            headlessContext = EGL_NO_CONTEXT;
+        }
+
+        eglTerminate(headlessDisplay);
+        headlessDisplay = EGL_NO_DISPLAY;
+    }
+
+    bool HeadlessContextEGL::makeCurrent() {
+        return eglMakeCurrent(headlessDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE,
+                              headlessContext) == EGL_TRUE;
+    }
+
+    void HeadlessContextEGL::releaseCurrent() {
+        eglMakeCurrent(headlessDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    }
+
+    void *HeadlessContextEGL::getProcAddress(const char *name) {
+        return reinterpret_cast<void*>(eglGetProcAddress(name));
+    }
+#else
+    bool HeadlessContextEGL::isSupported() {
+        return false;
+    }
+
+    bool HeadlessContextEGL::create() {
+        LOG_CATEGORY_CRITICAL(Render, "HeadlessContextEGL: engine was built without EGL support");
+
+        return false;
+    }
+
+    void HeadlessContextEGL::destroy() {
+    }
+
+    bool HeadlessContextEGL::makeCurrent() {
+        return false;
+    }
+
+    void HeadlessContextEGL::releaseCurrent() {
+    }
+
+    void *HeadlessContextEGL::getProcAddress(const char *name) {
+        return nullptr;
+    }
+#endif
+}
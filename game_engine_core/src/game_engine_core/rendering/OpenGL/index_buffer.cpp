@@ -1,6 +1,9 @@
 #include "game_engine_core/rendering/OpenGL/index_buffer.hpp"
 
+#include "game_engine_core/rendering/OpenGL/state_tracker_OpenGL.hpp"
+#include "game_engine_core/rendering/OpenGL/renderer_OpenGL.hpp"
 #include "game_engine_core/log.hpp"
+#include "game_engine_core/frame_stats.hpp"
 
 #include "glad/glad.h"
 
@@ -12,7 +15,7 @@ namespace game_engine {
             case VertexBuffer::TypeDrawUsage::Stream: return GL_STREAM_DRAW;
         }
 
-        LOG_ERROR("Unknown VertexBuffer usage");
+        LOG_CATEGORY_ERROR(Render, "Unknown VertexBuffer usage");
 
         return GL_STREAM_DRAW;
     }
@@ -20,16 +23,22 @@ namespace game_engine {
     IndexBuffer::IndexBuffer(const void *data, const size_t count,
                              const VertexBuffer::TypeDrawUsage usage)
         : m_count{count} {
-        glGenBuffers(1, &m_id);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_id);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(GLuint), data, usageToGLenum(usage));
+        glCreateBuffers(1, &m_id);
+        glNamedBufferData(m_id, count * sizeof(GLuint), data, usageToGLenum(usage));
+
+        FrameStats::add(FrameCounter::Allocations);
+        if (data != nullptr) {
+            FrameStats::add(FrameCounter::UploadedBytes, count * sizeof(GLuint));
+        }
     }
 
     IndexBuffer::~IndexBuffer() {
-        glDeleteBuffers(1, &m_id);
+        RendererOpenGL::releaseBuffer(m_id);
     }
 
     IndexBuffer &IndexBuffer::operator=(IndexBuffer &&indexBuffer) noexcept {
+        RendererOpenGL::releaseBuffer(m_id);
+
         m_id = indexBuffer.m_id;
         m_count = indexBuffer.m_count;
         indexBuffer.m_id = 0;
@@ -44,11 +53,26 @@ namespace game_engine {
         indexBuffer.m_count = 0;
     }
 
+    void IndexBuffer::setData(const void *data, const size_t count,
+                              const size_t firstIndex) const {
+        if (firstIndex + count > m_count) {
+            LOG_CATEGORY_ERROR(Render, "IndexBuffer: update of {0} indices at {1} exceeds count {2}",
+                      count, firstIndex, m_count);
+
+            return;
+        }
+
+        glNamedBufferSubData(m_id, static_cast<GLintptr>(firstIndex * sizeof(GLuint)),
+                             static_cast<GLsizeiptr>(count * sizeof(GLuint)), data);
+
+        FrameStats::add(FrameCounter::UploadedBytes, count * sizeof(GLuint));
+    }
+
     void IndexBuffer::bind() const {
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_id);
+        StateTrackerOpenGL::bindBuffer(BufferTarget::ElementArray, m_id);
     }
 
     void IndexBuffer::unbind() {
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+        StateTrackerOpenGL::bindBuffer(BufferTarget::ElementArray, 0);
     }
 }
@@ -0,0 +1,95 @@
+#include "game_engine_core/rendering/OpenGL/indirect_batch.hpp"
+
+#include "game_engine_core/rendering/OpenGL/renderer_OpenGL.hpp"
+#include "game_engine_core/rendering/OpenGL/state_tracker_OpenGL.hpp"
+#include "game_engine_core/frame_stats.hpp"
+
+#include "glad/glad.h"
+
+#include <algorithm>
+
+namespace game_engine {
+    IndirectBatch::~IndirectBatch() {
+        RendererOpenGL::releaseBuffer(m_commandsBufferId);
+        RendererOpenGL::releaseBuffer(m_drawDataBufferId);
+    }
+
+    void IndirectBatch::add(const MeshRange &meshRange, const glm::mat4 &modelMatrix,
+                            const unsigned int materialIndex) {
+        m_commands.push_back(DrawElementsIndirectCommand{
+            static_cast<uint32_t>(meshRange.indicesCount),
+            1,
+            static_cast<uint32_t>(meshRange.firstIndex),
+            static_cast<int32_t>(meshRange.baseVertex),
+            static_cast<uint32_t>(m_drawData.size())
+        });
+
+        m_drawData.push_back(IndirectDrawData{modelMatrix, materialIndex, {}});
+        m_indicesTotals.push_back((m_indicesTotals.empty() ? 0 : m_indicesTotals.back()) +
+                                  meshRange.indicesCount);
+        m_dirty = true;
+    }
+
+    void IndirectBatch::clear() {
+        m_commands.clear();
+        m_drawData.clear();
+        m_indicesTotals.clear();
+        m_dirty = true;
+    }
+
+    void IndirectBatch::upload() {
+        const size_t drawsCount = m_commands.size();
+
+        if (drawsCount > m_capacity) {
+            RendererOpenGL::releaseBuffer(m_commandsBufferId);
+            RendererOpenGL::releaseBuffer(m_drawDataBufferId);
+
+            m_capacity = std::max(drawsCount, m_capacity * 2);
+
+            glCreateBuffers(1, &m_commandsBufferId);
+            glNamedBufferData(m_commandsBufferId,
+                              m_capacity * sizeof(DrawElementsIndirectCommand),
+                              nullptr, GL_DYNAMIC_DRAW);
+            glCreateBuffers(1, &m_drawDataBufferId);
+            glNamedBufferData(m_drawDataBufferId, m_capacity * sizeof(IndirectDrawData),
+                              nullptr, GL_DYNAMIC_DRAW);
+
+            FrameStats::add(FrameCounter::Allocations, 2);
+        }
+
+        if (drawsCount > 0) {
+            glNamedBufferSubData(m_commandsBufferId, 0,
+                                 drawsCount * sizeof(DrawElementsIndirectCommand),
+                                 m_commands.data());
+            glNamedBufferSubData(m_drawDataBufferId, 0, drawsCount * sizeof(IndirectDrawData),
+                                 m_drawData.data());
+
+            FrameStats::add(FrameCounter::UploadedBytes, drawsCount *
+                            (sizeof(DrawElementsIndirectCommand) + sizeof(IndirectDrawData)));
+        }
+
+        m_dirty = false;
+    }
+
+    void IndirectBatch::submit(const GeometryArena &geometryArena, const size_t drawsCount) {
+        if (m_dirty) {
+            upload();
+        }
+
+        const size_t submittedDrawsCount = std::min(drawsCount, m_commands.size());
+
+        if (submittedDrawsCount == 0) {
+            return;
+        }
+
+        StateTrackerOpenGL::bindBufferBase(BufferTarget::ShaderStorage,
+                                           static_cast<unsigned int>(StorageBlockBinding::DrawData),
+                                           m_drawDataBufferId);
+        StateTrackerOpenGL::bindBuffer(BufferTarget::DrawIndirect, m_commandsBufferId);
+
+        RendererOpenGL::multiDrawIndirect(geometryArena.getVertexArray(), 0, submittedDrawsCount);
+
+        FrameStats::add(FrameCounter::DrawCalls, submittedDrawsCount);
+        FrameStats::add(FrameCounter::Triangles, m_indicesTotals[submittedDrawsCount - 1] / 3);
+    }
+}
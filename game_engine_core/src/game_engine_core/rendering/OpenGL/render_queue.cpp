@@ -0,0 +1,280 @@
+#include "game_engine_core/rendering/OpenGL/render_queue.hpp"
+
+#include "game_engine_core/rendering/OpenGL/renderer_OpenGL.hpp"
+#include "game_engine_core/rendering/OpenGL/shader_program.hpp"
+#include "game_engine_core/rendering/OpenGL/vertex_array.hpp"
+#include "game_engine_core/rendering/OpenGL/texture_2D.hpp"
+#include "game_engine_core/rendering/OpenGL/state_tracker_OpenGL.hpp"
+#include "game_engine_core/rendering/OpenGL/sampler_cache.hpp"
+#include "game_engine_core/log.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <cstring>
+
+namespace game_engine {
+    constexpr uint64_t s_idMask = (1ull << 10) - 1;
+    constexpr uint64_t s_depthMask = (1ull << 24) - 1;
+    constexpr uint64_t s_layerMask = (1ull << 4) - 1;
+
+    constexpr PipelineState s_opaquePipelineState{};
+    constexpr PipelineState s_transparentPipelineState{ true, false, DepthFunction::Less, true, false };
+
+    size_t getDrawUniformSize(const DrawUniformType type) {
+        switch (type) {
+            case DrawUniformType::Int: return sizeof(int);
+            case DrawUniformType::Float: return sizeof(float);
+            case DrawUniformType::Vec4: return sizeof(glm::vec4);
+            case DrawUniformType::Mat4: return sizeof(glm::mat4);
+        }
+
+        return 0;
+    }
+
+    void RenderQueue::begin(const float maxDepth) {
+        m_packets.clear();
+        m_keys.clear();
+        m_uniformArena.clear();
+        m_programSortIds.clear();
+        m_vertexArraySortIds.clear();
+        m_textureSortIds.clear();
+        m_hasSortIdsOverflowed = false;
+        m_maxDepth = maxDepth > 0.0f ? maxDepth : 1.0f;
+    }
+
+    void RenderQueue::submit(const DrawPacket &packet) {
+        m_keys.push_back(makeSortKey(packet));
+        m_packets.push_back(packet);
+    }
+
+    void RenderQueue::setUniform(DrawPacket &packet, const int location, const int value) {
+        appendUniform(packet, location, DrawUniformType::Int, &value, sizeof(value));
+    }
+
+    void RenderQueue::setUniform(DrawPacket &packet, const int location, const float value) {
+        appendUniform(packet, location, DrawUniformType::Float, &value, sizeof(value));
+    }
+
+    void RenderQueue::setUniform(DrawPacket &packet, const int location, const glm::vec4 &value) {
+        appendUniform(packet, location, DrawUniformType::Vec4, &value, sizeof(value));
+    }
+
+    void RenderQueue::setUniform(DrawPacket &packet, const int location, const glm::mat4 &value) {
+        appendUniform(packet, location, DrawUniformType::Mat4, &value, sizeof(value));
+    }
+
+    void RenderQueue::appendUniform(DrawPacket &packet, const int location,
+                                    const DrawUniformType type, const void *data,
+                                    const size_t size) {
+        if (location < 0) {
+            return;
+        }
+
+        if (packet.uniformsSize == 0) {
+            packet.uniformsOffset = static_cast<uint32_t>(m_uniformArena.size());
+        } else if (packet.uniformsOffset + packet.uniformsSize != m_uniformArena.size()) {
+            LOG_CATEGORY_ERROR(Render, "RenderQueue: uniforms of a draw packet must be set "
+                               "before uniforms of the next one");
+
+            return;
+        }
+
+        const DrawUniform uniform{ location, type };
+        const size_t offset = m_uniformArena.size();
+        m_uniformArena.resize(offset + sizeof(uniform) + size);
+        std::memcpy(m_uniformArena.data() + offset, &uniform, sizeof(uniform));
+        std::memcpy(m_uniformArena.data() + offset + sizeof(uniform), data, size);
+
+        packet.uniformsSize += static_cast<uint32_t>(sizeof(uniform) + size);
+    }
+
+    void RenderQueue::applyUniforms(const ShaderProgram &shaderProgram,
+                                    const DrawPacket &packet) const {
+        const std::byte *current = m_uniformArena.data() + packet.uniformsOffset;
+        const std::byte *end = current + packet.uniformsSize;
+
+        while (current < end) {
+            DrawUniform uniform;
+            std::memcpy(&uniform, current, sizeof(uniform));
+            current += sizeof(uniform);
+
+            switch (uniform.type) {
+                case DrawUniformType::Int: {
+                    int value = 0;
+                    std::memcpy(&value, current, sizeof(value));
+                    shaderProgram.setInt(uniform.location, value);
+                    break;
+                }
+                case DrawUniformType::Float: {
+                    float value = 0.0f;
+                    std::memcpy(&value, current, sizeof(value));
+                    shaderProgram.setFloat(uniform.location, value);
+                    break;
+                }
+                case DrawUniformType::Vec4: {
+                    glm::vec4 value;
+                    std::memcpy(&value, current, sizeof(value));
+                    shaderProgram.setVec4Array(uniform.location, &value, 1);
+                    break;
+                }
+                case DrawUniformType::Mat4: {
+                    glm::mat4 value;
+                    std::memcpy(&value, current, sizeof(value));
+                    shaderProgram.setMatrix_4(uniform.location, value);
+                    break;
+                }
+            }
+
+            current += getDrawUniformSize(uniform.type);
+        }
+    }
+
+    uint64_t RenderQueue::getSortId(std::unordered_map<uint64_t, uint64_t> &sortIds,
+                                    const uint64_t id) {
+        const auto [iterator, inserted] = sortIds.emplace(id, sortIds.size());
+
+        if (iterator->second <= s_idMask) {
+            return iterator->second;
+        }
+
+        if (!m_hasSortIdsOverflowed) {
+            LOG_CATEGORY_WARNING(Render, "RenderQueue: more than {0} distinct states in a frame, "
+                                 "sorting by state is partial", s_idMask + 1);
+            m_hasSortIdsOverflowed = true;
+        }
+
+        return s_idMask;
+    }
+
+    uint64_t RenderQueue::makeSortKey(const DrawPacket &packet) {
+        const uint64_t layer = packet.layer & s_layerMask;
+        const uint64_t program = getSortId(m_programSortIds,
+            packet.shaderProgram ? packet.shaderProgram->getId() : 0);
+        const uint64_t vertexArray = getSortId(m_vertexArraySortIds,
+            packet.vertexArray ? packet.vertexArray->getId() : 0);
+
+        uint64_t textures = 0;
+        for (const Texture2D *currentTexture : packet.textures) {
+            textures = textures << 32 ^ textures >> 32 ^
+                       (currentTexture ? currentTexture->getId() : 0);
+        }
+        const uint64_t texture = getSortId(m_textureSortIds, textures);
+
+        const float normalizedDepth = std::clamp(packet.depth / m_maxDepth, 0.0f, 1.0f);
+        const uint64_t depth = static_cast<uint64_t>(normalizedDepth * s_depthMask);
+
+        if (!packet.transparent) {
+            return layer << 60 | program << 49 | texture << 39 | vertexArray << 29 | depth << 5;
+        }
+
+        return layer << 60 | 1ull << 59 | (s_depthMask - depth) << 35 |
+               program << 25 | texture << 15 | vertexArray << 5;
+    }
+
+    void RenderQueue::sort() {
+        const size_t count = m_keys.size();
+
+        m_order.resize(count);
+        std::iota(m_order.begin(), m_order.end(), 0u);
+
+        if (count < 2) {
+            return;
+        }
+
+        m_scratchKeys.resize(count);
+        m_scratchOrder.resize(count);
+
+        for (unsigned int shift = 0; shift < 64; shift += 8) {
+            std::array<uint32_t, 256> histogram{};
+
+            for (const uint64_t key : m_keys) {
+                ++histogram[(key >> shift) & 0xFF];
+            }
+
+            if (histogram[(m_keys[0] >> shift) & 0xFF] == count) {
+                continue;
+            }
+
+            uint32_t offset = 0;
+            for (uint32_t &bucket : histogram) {
+                const uint32_t bucketSize = bucket;
+                bucket = offset;
+                offset += bucketSize;
+            }
+
+            for (size_t i = 0; i < count; ++i) {
+                const uint32_t destination = histogram[(m_keys[i] >> shift) & 0xFF]++;
+                m_scratchKeys[destination] = m_keys[i];
+                m_scratchOrder[destination] = m_order[i];
+            }
+
+            std::swap(m_keys, m_scratchKeys);
+            std::swap(m_order, m_scratchOrder);
+        }
+    }
+
+    void RenderQueue::execute() {
+        sort();
+
+        m_stats = {};
+
+        const ShaderProgram *currentProgram = nullptr;
+        const VertexArray *currentVertexArray = nullptr;
+        std::array<const Texture2D*, DrawPacket::s_maxTexturesCount> currentTextures{};
+        StateTrackerOpenGL::applyPipelineState(s_opaquePipelineState);
+
+        const unsigned int sampler = SamplerCache::getSampler(SamplerState{});
+        for (unsigned int unit = 0; unit < DrawPacket::s_maxTexturesCount; ++unit) {
+            StateTrackerOpenGL::bindSampler(unit, sampler);
+        }
+
+        for (const uint32_t index : m_order) {
+            const DrawPacket &packet = m_packets[index];
+
+            if (!packet.vertexArray || !packet.shaderProgram) {
+                continue;
+            }
+
+            StateTrackerOpenGL::applyPipelineState(packet.transparent ?
+                s_transparentPipelineState : s_opaquePipelineState);
+
+            if (packet.shaderProgram != currentProgram) {
+                currentProgram = packet.shaderProgram;
+                currentProgram->bind();
+                ++m_stats.programSwitches;
+            }
+
+            if (packet.vertexArray != currentVertexArray) {
+                currentVertexArray = packet.vertexArray;
+                currentVertexArray->bind();
+                ++m_stats.vertexArraySwitches;
+            }
+
+            for (unsigned int unit = 0; unit < DrawPacket::s_maxTexturesCount; ++unit) {
+                if (packet.textures[unit] && packet.textures[unit] != currentTextures[unit]) {
+                    currentTextures[unit] = packet.textures[unit];
+                    currentTextures[unit]->bind(unit);
+                    ++m_stats.textureSwitches;
+                }
+            }
+
+            if (currentProgram->getModelMatrixLocation() >= 0) {
+                currentProgram->setMatrix_4(currentProgram->getModelMatrixLocation(),
+                                            packet.modelMatrix);
+            }
+
+            applyUniforms(*currentProgram, packet);
+
+            RendererOpenGL::drawIndexed(currentVertexArray->getIndicesCount(),
+                                        packet.instanceCount);
+            ++m_stats.drawCalls;
+        }
+
+        StateTrackerOpenGL::applyPipelineState(s_opaquePipelineState);
+
+        m_packets.clear();
+        m_keys.clear();
+        m_uniformArena.clear();
+    }
+}
@@ -4,35 +4,131 @@
 #include "GLFW/glfw3.h"
 
 #include "game_engine_core/rendering/OpenGL/vertex_array.hpp"
+#include "game_engine_core/rendering/OpenGL/state_tracker_OpenGL.hpp"
+#include "game_engine_core/rendering/render_thread.hpp"
 #include "game_engine_core/log.hpp"
+#include "game_engine_core/frame_stats.hpp"
+
+#include <cstring>
+#include <string>
+#include <vector>
 
 namespace game_engine {
+    std::vector<std::string> supportedExtensions;
+
     bool RendererOpenGL::init(GLFWwindow *window) {
         glfwMakeContextCurrent(window);
 
-        if (!gladLoadGLLoader(reinterpret_cast<GLADloadproc>(glfwGetProcAddress))) {
-            LOG_CRITICAL("Failed to initialize GLAD");
+        return init(reinterpret_cast<ProcAddressLoader>(glfwGetProcAddress));
+    }
+
+    bool RendererOpenGL::init(const ProcAddressLoader loader) {
+        if (!gladLoadGLLoader(reinterpret_cast<GLADloadproc>(loader))) {
+            LOG_CATEGORY_CRITICAL(Render, "Failed to initialize GLAD");
 
             return false;
         }
 
-        LOG_INFO("OpenGL context initialized:");
-        LOG_INFO("Vendor: {0}", getVendorStr());
-        LOG_INFO("Renderer: {0}", getRendererStr());
-        LOG_INFO("Version: {0}", getVersionStr());
+        RenderThread::setContextThread();
+
+        LOG_CATEGORY_INFO(Render, "OpenGL context initialized:");
+        LOG_CATEGORY_INFO(Render, "Vendor: {0}", getVendorStr());
+        LOG_CATEGORY_INFO(Render, "Renderer: {0}", getRendererStr());
+        LOG_CATEGORY_INFO(Render, "Version: {0}", getVersionStr());
+
+        GLint extensionsCount = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &extensionsCount);
+
+        supportedExtensions.clear();
+        supportedExtensions.reserve(static_cast<size_t>(extensionsCount));
+
+        for (GLint i = 0; i < extensionsCount; ++i) {
+            const char *extension = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i));
+
+            if (extension) {
+                supportedExtensions.emplace_back(extension);
+            }
+        }
 
         return true;
     }
 
     void RendererOpenGL::draw(const VertexArray &vertexArray) {
         vertexArray.bind();
-        glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(vertexArray.getIndicesCount()),
-                       GL_UNSIGNED_INT, nullptr);
+        drawIndexed(vertexArray.getIndicesCount());
+    }
+
+    void RendererOpenGL::drawInstanced(const VertexArray &vertexArray, const size_t instanceCount) {
+        vertexArray.bind();
+        drawIndexed(vertexArray.getIndicesCount(), instanceCount);
+    }
+
+    void RendererOpenGL::drawIndexed(const size_t indicesCount, const size_t instanceCount) {
+        if (instanceCount == 1) {
+            glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indicesCount),
+                           GL_UNSIGNED_INT, nullptr);
+        } else {
+            glDrawElementsInstanced(GL_TRIANGLES, static_cast<GLsizei>(indicesCount),
+                                    GL_UNSIGNED_INT, nullptr, static_cast<GLsizei>(instanceCount));
+        }
+
+        FrameStats::add(FrameCounter::DrawCalls);
+        FrameStats::add(FrameCounter::Triangles, indicesCount / 3 * instanceCount);
+    }
+
+    void RendererOpenGL::multiDrawIndirect(const VertexArray &vertexArray,
+                                           const size_t indirectOffset,
+                                           const size_t drawsCount) {
+        vertexArray.bind();
+        glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT,
+                                    reinterpret_cast<const void*>(indirectOffset),
+                                    static_cast<GLsizei>(drawsCount), 0);
+    }
+
+    bool RendererOpenGL::multiDrawIndirectCount(const VertexArray &vertexArray,
+                                                const size_t indirectOffset,
+                                                const size_t drawCountOffset,
+                                                const size_t maxDrawsCount) {
+        if (!isIndirectCountSupported()) {
+            return false;
+        }
+
+        vertexArray.bind();
+        glMultiDrawElementsIndirectCount(GL_TRIANGLES, GL_UNSIGNED_INT,
+                                         reinterpret_cast<const void*>(indirectOffset),
+                                         static_cast<GLintptr>(drawCountOffset),
+                                         static_cast<GLsizei>(maxDrawsCount), 0);
+
+        return true;
+    }
+
+    bool RendererOpenGL::isIndirectCountSupported() {
+        return glMultiDrawElementsIndirectCount != nullptr;
+    }
+
+    bool RendererOpenGL::isExtensionSupported(const char *name) {
+        for (const std::string &extension : supportedExtensions) {
+            if (std::strcmp(extension.c_str(), name) == 0) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void RendererOpenGL::dispatchCompute(const unsigned int groupsCountX,
+                                         const unsigned int groupsCountY,
+                                         const unsigned int groupsCountZ) {
+        glDispatchCompute(groupsCountX, groupsCountY, groupsCountZ);
+    }
+
+    void RendererOpenGL::indirectCommandsBarrier() {
+        glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT);
     }
 
     void RendererOpenGL::setClearColor(const float red, const float green,
                                        const float blue, const float alpha) {
-        glClearColor(red, green, blue, alpha);
+        StateTrackerOpenGL::setClearColor(red, green, blue, alpha);
     }
 
     void RendererOpenGL::clear() {
@@ -46,11 +142,112 @@ namespace game_engine {
     }
 
     void RendererOpenGL::enableDepthTest() {
-        glEnable(GL_DEPTH_TEST);
+        StateTrackerOpenGL::setDepthTest(true);
     }
 
     void RendererOpenGL::disableDepthTest() {
-        glDisable(GL_DEPTH_TEST);
+        StateTrackerOpenGL::setDepthTest(false);
+    }
+
+    void RendererOpenGL::enableBlending() {
+        StateTrackerOpenGL::setBlending(true);
+    }
+
+    void RendererOpenGL::disableBlending() {
+        StateTrackerOpenGL::setBlending(false);
+    }
+
+    void RendererOpenGL::setDepthWrite(const bool enabled) {
+        StateTrackerOpenGL::setDepthWrite(enabled);
+    }
+
+    void RendererOpenGL::finish() {
+        glFinish();
+    }
+
+    size_t RendererOpenGL::getUniformBufferOffsetAlignment() {
+        static GLint alignment = 0;
+
+        if (alignment == 0) {
+            glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+        }
+
+        return static_cast<size_t>(alignment);
+    }
+
+    void RendererOpenGL::releaseBuffer(const unsigned int id) {
+        if (id == 0) {
+            return;
+        }
+
+        RenderThread::releaseResource([id]() {
+            StateTrackerOpenGL::onBufferDeleted(id);
+            glDeleteBuffers(1, &id);
+        });
+    }
+
+    void RendererOpenGL::releaseTexture(const unsigned int id) {
+        if (id == 0) {
+            return;
+        }
+
+        RenderThread::releaseResource([id]() {
+            StateTrackerOpenGL::onTextureDeleted(id);
+            glDeleteTextures(1, &id);
+        });
+    }
+
+    void RendererOpenGL::releaseSampler(const unsigned int id) {
+        if (id == 0) {
+            return;
+        }
+
+        RenderThread::releaseResource([id]() {
+            StateTrackerOpenGL::onSamplerDeleted(id);
+            glDeleteSamplers(1, &id);
+        });
+    }
+
+    void RendererOpenGL::releaseVertexArray(const unsigned int id) {
+        if (id == 0) {
+            return;
+        }
+
+        RenderThread::releaseResource([id]() {
+            StateTrackerOpenGL::onVertexArrayDeleted(id);
+            glDeleteVertexArrays(1, &id);
+        });
+    }
+
+    void RendererOpenGL::releaseProgram(const unsigned int id) {
+        if (id == 0) {
+            return;
+        }
+
+        RenderThread::releaseResource([id]() {
+            StateTrackerOpenGL::onProgramDeleted(id);
+            glDeleteProgram(id);
+        });
+    }
+
+    void RendererOpenGL::releaseFramebuffer(const unsigned int id) {
+        if (id == 0) {
+            return;
+        }
+
+        RenderThread::releaseResource([id]() {
+            glDeleteFramebuffers(1, &id);
+        });
+    }
+
+    void RendererOpenGL::releaseRenderbuffer(const unsigned int id) {
+        if (id == 0) {
+            return;
+        }
+
+        RenderThread::releaseResource([id]() {
+            glDeleteRenderbuffers(1, &id);
+        });
     }
 
     const char *RendererOpenGL::getVendorStr() {
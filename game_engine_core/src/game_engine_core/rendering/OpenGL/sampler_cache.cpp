@@ -0,0 +1,82 @@
+#include "game_engine_core/rendering/OpenGL/sampler_cache.hpp"
+#include "game_engine_core/rendering/OpenGL/state_tracker_OpenGL.hpp"
+#include "game_engine_core/rendering/OpenGL/renderer_OpenGL.hpp"
+
+#include "glad/glad.h"
+
+#include <unordered_map>
+
+namespace game_engine {
+    std::unordered_map<uint32_t, unsigned int> cachedSamplers;
+
+    GLenum getMinFilterOpenGL(const TextureFilter filter, const MipmapFilter mipmapFilter) {
+        switch (mipmapFilter) {
+            case MipmapFilter::Nearest:
+                return filter == TextureFilter::Linear ?
+                       GL_LINEAR_MIPMAP_NEAREST : GL_NEAREST_MIPMAP_NEAREST;
+            case MipmapFilter::Linear:
+                return filter == TextureFilter::Linear ?
+                       GL_LINEAR_MIPMAP_LINEAR : GL_NEAREST_MIPMAP_LINEAR;
+            case MipmapFilter::None:
+                break;
+        }
+
+        return filter == TextureFilter::Linear ? GL_LINEAR : GL_NEAREST;
+    }
+
+    GLenum getTextureWrapOpenGL(const TextureWrap wrap) {
+        switch (wrap) {
+            case TextureWrap::Repeat: return GL_REPEAT;
+            case TextureWrap::ClampToEdge: return GL_CLAMP_TO_EDGE;
+            case TextureWrap::MirroredRepeat: return GL_MIRRORED_REPEAT;
+        }
+
+        return GL_REPEAT;
+    }
+
+    uint32_t SamplerState::getKey() const {
+        return static_cast<uint32_t>(minFilter) |
+               static_cast<uint32_t>(magFilter) << 1 |
+               static_cast<uint32_t>(mipmapFilter) << 2 |
+               static_cast<uint32_t>(wrapS) << 4 |
+               static_cast<uint32_t>(wrapT) << 6;
+    }
+
+    unsigned int SamplerCache::getSampler(const SamplerState &state) {
+        const uint32_t key = state.getKey();
+        const auto found = cachedSamplers.find(key);
+
+        if (found != cachedSamplers.end()) {
+            return found->second;
+        }
+
+        unsigned int id = 0;
+        glCreateSamplers(1, &id);
+        glSamplerParameteri(id, GL_TEXTURE_MIN_FILTER,
+                            getMinFilterOpenGL(state.minFilter, state.mipmapFilter));
+        glSamplerParameteri(id, GL_TEXTURE_MAG_FILTER,
+                            state.magFilter == TextureFilter::Linear ? GL_LINEAR : GL_NEAREST);
+        glSamplerParameteri(id, GL_TEXTURE_WRAP_S, getTextureWrapOpenGL(state.wrapS));
+        glSamplerParameteri(id, GL_TEXTURE_WRAP_T, getTextureWrapOpenGL(state.wrapT));
+
+        cachedSamplers.emplace(key, id);
+
+        return id;
+    }
+
+    void SamplerCache::bind(const unsigned int unit, const SamplerState &state) {
+        StateTrackerOpenGL::bindSampler(unit, getSampler(state));
+    }
+
+    void SamplerCache::release() {
+        for (const auto &[key, id] : cachedSamplers) {
+            RendererOpenGL::releaseSampler(id);
+        }
+
+        cachedSamplers.clear();
+    }
+
+    size_t SamplerCache::getSamplersCount() {
+        return cachedSamplers.size();
+    }
+}
@@ -1,11 +1,22 @@
 #include "game_engine_core/rendering/OpenGL/shader_program.hpp"
 
+#include "game_engine_core/rendering/OpenGL/uniform_buffer.hpp"
+#include "game_engine_core/rendering/OpenGL/state_tracker_OpenGL.hpp"
+#include "game_engine_core/rendering/OpenGL/renderer_OpenGL.hpp"
 #include "game_engine_core/log.hpp"
 
 #include "glad/glad.h"
 #include "glm/gtc/type_ptr.hpp"
 
+#include <array>
+#include <cstring>
+#include <utility>
+
 namespace game_engine {
+    constexpr std::array<std::pair<const char*, UniformBlockBinding>, 1> uniformBlockBindings = {{
+        { "CameraData", UniformBlockBinding::Camera }
+    }};
+
     bool create_shader(const char *source, const GLenum shaderType, GLuint &shaderId) {
         shaderId = glCreateShader(shaderType);
         glShaderSource(shaderId, 1, &source, nullptr);
@@ -17,7 +28,7 @@ namespace game_engine {
             char infoLog[1024];
             glGetShaderInfoLog(shaderId, 1024, nullptr, infoLog);
 
-            LOG_CRITICAL("Shader compilation error:\n{}", infoLog);
+            LOG_CATEGORY_CRITICAL(Render, "Shader compilation error:\n{}", infoLog);
 
             return false;
         }
@@ -28,7 +39,7 @@ namespace game_engine {
     ShaderProgram::ShaderProgram(const char *vertexShaderSrc, const char *fragmentShaderSrc) {
         GLuint vertexShaderId = 0;
         if (!create_shader(vertexShaderSrc, GL_VERTEX_SHADER, vertexShaderId)) {
-            LOG_CRITICAL("VERTEX SHADER: compile-time error!");
+            LOG_CATEGORY_CRITICAL(Render, "VERTEX SHADER: compile-time error!");
             glDeleteShader(vertexShaderId);
 
             return;
@@ -36,7 +47,7 @@ namespace game_engine {
 
         GLuint fragmentShaderId = 0;
         if (!create_shader(fragmentShaderSrc, GL_FRAGMENT_SHADER, fragmentShaderId)) {
-            LOG_CRITICAL("FRAGMENT SHADER: compile-time error!");
+            LOG_CATEGORY_CRITICAL(Render, "FRAGMENT SHADER: compile-time error!");
             glDeleteShader(vertexShaderId);
             glDeleteShader(fragmentShaderId);
 
@@ -53,7 +64,7 @@ namespace game_engine {
         if (success == GL_FALSE) {
             GLchar info_log[1024];
             glGetProgramInfoLog(m_id, 1024, nullptr, info_log);
-            LOG_CRITICAL("SHADER PROGRAM: Link-time error:\n{0}", info_log);
+            LOG_CATEGORY_CRITICAL(Render, "SHADER PROGRAM: Link-time error:\n{0}", info_log);
             glDeleteProgram(m_id);
             m_id = 0;
             glDeleteShader(vertexShaderId);
@@ -64,28 +75,66 @@ namespace game_engine {
             m_isCompiled = true;
         }
 
+        reflect();
+
         glDetachShader(m_id, vertexShaderId);
         glDetachShader(m_id, fragmentShaderId);
         glDeleteShader(vertexShaderId);
         glDeleteShader(fragmentShaderId);
     }
 
+    ShaderProgram::ShaderProgram(const char *computeShaderSrc) {
+        GLuint computeShaderId = 0;
+        if (!create_shader(computeShaderSrc, GL_COMPUTE_SHADER, computeShaderId)) {
+            LOG_CATEGORY_CRITICAL(Render, "COMPUTE SHADER: compile-time error!");
+            glDeleteShader(computeShaderId);
+
+            return;
+        }
+
+        m_id = glCreateProgram();
+        glAttachShader(m_id, computeShaderId);
+        glLinkProgram(m_id);
+
+        GLint success;
+        glGetProgramiv(m_id, GL_LINK_STATUS, &success);
+        if (success == GL_FALSE) {
+            GLchar info_log[1024];
+            glGetProgramInfoLog(m_id, 1024, nullptr, info_log);
+            LOG_CATEGORY_CRITICAL(Render, "SHADER PROGRAM: Link-time error:\n{0}", info_log);
+            glDeleteProgram(m_id);
+            m_id = 0;
+            glDeleteShader(computeShaderId);
+
+            return;
+        } else {
+            m_isCompiled = true;
+        }
+
+        reflect();
+
+        glDetachShader(m_id, computeShaderId);
+        glDeleteShader(computeShaderId);
+    }
+
     ShaderProgram::~ShaderProgram() {
-        glDeleteProgram(m_id);
+        RendererOpenGL::releaseProgram(m_id);
     }
 
     void ShaderProgram::bind() const {
-        glUseProgram(m_id);
+        StateTrackerOpenGL::useProgram(m_id);
     }
 
     void ShaderProgram::unbind() {
-        glUseProgram(0);
+        StateTrackerOpenGL::useProgram(0);
     }
 
     ShaderProgram &ShaderProgram::operator=(ShaderProgram &&shaderProgram) {
-        glDeleteProgram(m_id);
+        RendererOpenGL::releaseProgram(m_id);
         m_id = shaderProgram.m_id;
         m_isCompiled = shaderProgram.m_isCompiled;
+        m_modelMatrixLocation = shaderProgram.m_modelMatrixLocation;
+        m_uniformLocations = std::move(shaderProgram.m_uniformLocations);
 
         shaderProgram.m_id = 0;
         shaderProgram.m_isCompiled = false;
@@ -93,19 +142,103 @@ namespace game_engine {
         return *this;
     }
 
-    ShaderProgram::ShaderProgram(ShaderProgram &&shaderProgram) {
+    ShaderProgram::ShaderProgram(ShaderProgram &&shaderProgram)
+        : m_uniformLocations{std::move(shaderProgram.m_uniformLocations)} {
         m_id = shaderProgram.m_id;
         m_isCompiled = shaderProgram.m_isCompiled;
+        m_modelMatrixLocation = shaderProgram.m_modelMatrixLocation;
 
         shaderProgram.m_id = 0;
         shaderProgram.m_isCompiled = false;
     }
 
+    void ShaderProgram::reflect() {
+        GLint uniformsCount = 0;
+        glGetProgramiv(m_id, GL_ACTIVE_UNIFORMS, &uniformsCount);
+        m_uniformLocations.reserve(static_cast<size_t>(uniformsCount));
+
+        for (GLint i = 0; i < uniformsCount; ++i) {
+            GLchar name[256];
+            GLsizei nameLength = 0;
+            GLint size = 0;
+            GLenum type = 0;
+            glGetActiveUniform(m_id, static_cast<GLuint>(i), sizeof(name), &nameLength,
+                               &size, &type, name);
+
+            const GLint location = glGetUniformLocation(m_id, name);
+
+            if (location < 0) {
+                continue;
+            }
+
+            if (nameLength >= 3 && std::strcmp(name + nameLength - 3, "[0]") == 0) {
+                name[nameLength - 3] = '\0';
+            }
+
+            m_uniformLocations.emplace(hashUniformName(name), UniformLocation{ name, location });
+        }
+
+        m_modelMatrixLocation = getUniformLocation("model_matrix");
+
+        GLint uniformBlocksCount = 0;
+        glGetProgramiv(m_id, GL_ACTIVE_UNIFORM_BLOCKS, &uniformBlocksCount);
+
+        for (GLint i = 0; i < uniformBlocksCount; ++i) {
+            GLchar name[256];
+            glGetActiveUniformBlockName(m_id, static_cast<GLuint>(i), sizeof(name), nullptr, name);
+
+            for (const auto &[blockName, binding] : uniformBlockBindings) {
+                if (std::strcmp(name, blockName) == 0) {
+                    glUniformBlockBinding(m_id, static_cast<GLuint>(i),
+                                          static_cast<GLuint>(binding));
+                }
+            }
+        }
+    }
+
+    int ShaderProgram::getUniformLocation(const char *name) const {
+        const auto [begin, end] = m_uniformLocations.equal_range(hashUniformName(name));
+
+        for (auto iterator = begin; iterator != end; ++iterator) {
+            if (iterator->second.name == name) {
+                return iterator->second.location;
+            }
+        }
+
+        return -1;
+    }
+
     void ShaderProgram::setMatrix_4(const char *name, const glm::mat4 &matrix) const {
-        glUniformMatrix4fv(glGetUniformLocation(m_id, name), 1, GL_FALSE, glm::value_ptr(matrix));
+        setMatrix_4(getUniformLocation(name), matrix);
+    }
+
+    void ShaderProgram::setMatrix_4(const int location, const glm::mat4 &matrix) const {
+        glProgramUniformMatrix4fv(m_id, location, 1, GL_FALSE, glm::value_ptr(matrix));
     }
 
     void ShaderProgram::setInt(const char *name, const int value) const {
-        glUniform1i(glGetUniformLocation(m_id, name), value);
+        setInt(getUniformLocation(name), value);
+    }
+
+    void ShaderProgram::setInt(const int location, const int value) const {
+        glProgramUniform1i(m_id, location, value);
+    }
+
+    void ShaderProgram::setFloat(const char *name, const float value) const {
+        setFloat(getUniformLocation(name), value);
+    }
+
+    void ShaderProgram::setFloat(const int location, const float value) const {
+        glProgramUniform1f(m_id, location, value);
+    }
+
+    void ShaderProgram::setVec4Array(const char *name, const glm::vec4 *values,
+                                     const size_t count) const {
+        setVec4Array(getUniformLocation(name), values, count);
+    }
+
+    void ShaderProgram::setVec4Array(const int location, const glm::vec4 *values,
+                                     const size_t count) const {
+        glProgramUniform4fv(m_id, location, static_cast<GLsizei>(count), glm::value_ptr(*values));
     }
 }
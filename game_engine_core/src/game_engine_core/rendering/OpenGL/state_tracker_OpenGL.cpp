@@ -0,0 +1,310 @@
+#include "game_engine_core/rendering/OpenGL/state_tracker_OpenGL.hpp"
+#include "game_engine_core/frame_stats.hpp"
+
+#include "glad/glad.h"
+
+#include <array>
+
+namespace game_engine {
+    constexpr unsigned int s_unknownId = ~0u;
+    constexpr size_t s_buffersTargetsCount = static_cast<size_t>(BufferTarget::TargetsCount);
+
+    enum class Toggle : signed char {
+        Unknown = -1,
+        Disabled = 0,
+        Enabled = 1
+    };
+
+    struct ShadowState {
+        unsigned int program = s_unknownId;
+        unsigned int vertexArray = s_unknownId;
+        std::array<unsigned int, s_buffersTargetsCount> buffers;
+        std::array<std::array<unsigned int, StateTrackerOpenGL::s_maxIndexedBindings>,
+                   s_buffersTargetsCount> indexedBuffers;
+        std::array<unsigned int, StateTrackerOpenGL::s_maxTextureUnits> textures;
+        std::array<unsigned int, StateTrackerOpenGL::s_maxTextureUnits> samplers;
+
+        Toggle depthTest = Toggle::Unknown;
+        Toggle depthWrite = Toggle::Unknown;
+        Toggle blending = Toggle::Unknown;
+        Toggle cullFace = Toggle::Unknown;
+        int depthFunction = -1;
+
+        bool clearColorKnown = false;
+        std::array<float, 4> clearColor{};
+
+        ShadowState() {
+            buffers.fill(s_unknownId);
+            for (auto &targetBindings : indexedBuffers) {
+                targetBindings.fill(s_unknownId);
+            }
+            textures.fill(s_unknownId);
+            samplers.fill(s_unknownId);
+        }
+    };
+
+    ShadowState shadowState;
+    StateTrackerOpenGL::Stats currentFrameStats;
+    StateTrackerOpenGL::Stats lastFrameStats;
+
+    constexpr GLenum bufferTargetToGLenum(const BufferTarget target) {
+        switch (target) {
+            case BufferTarget::Array: return GL_ARRAY_BUFFER;
+            case BufferTarget::ElementArray: return GL_ELEMENT_ARRAY_BUFFER;
+            case BufferTarget::Uniform: return GL_UNIFORM_BUFFER;
+            case BufferTarget::ShaderStorage: return GL_SHADER_STORAGE_BUFFER;
+            case BufferTarget::DrawIndirect: return GL_DRAW_INDIRECT_BUFFER;
+            case BufferTarget::Parameter: return GL_PARAMETER_BUFFER;
+            case BufferTarget::PixelUnpack: return GL_PIXEL_UNPACK_BUFFER;
+            case BufferTarget::TargetsCount: break;
+        }
+
+        return GL_ARRAY_BUFFER;
+    }
+
+    constexpr GLenum depthFunctionToGLenum(const DepthFunction function) {
+        switch (function) {
+            case DepthFunction::Less: return GL_LESS;
+            case DepthFunction::LessEqual: return GL_LEQUAL;
+            case DepthFunction::Always: return GL_ALWAYS;
+        }
+
+        return GL_LESS;
+    }
+
+    bool updateShadow(unsigned int &shadow, const unsigned int value) {
+        if (shadow == value) {
+            ++currentFrameStats.skippedCalls;
+
+            return false;
+        }
+
+        shadow = value;
+        ++currentFrameStats.issuedCalls;
+
+        return true;
+    }
+
+    bool updateShadow(Toggle &shadow, const bool enabled) {
+        const Toggle value = enabled ? Toggle::Enabled : Toggle::Disabled;
+
+        if (shadow == value) {
+            ++currentFrameStats.skippedCalls;
+
+            return false;
+        }
+
+        shadow = value;
+        ++currentFrameStats.issuedCalls;
+
+        return true;
+    }
+
+    void setCapability(Toggle &shadow, const GLenum capability, const bool enabled) {
+        if (!updateShadow(shadow, enabled)) {
+            return;
+        }
+
+        if (enabled) {
+            glEnable(capability);
+        } else {
+            glDisable(capability);
+        }
+    }
+
+    void StateTrackerOpenGL::useProgram(const unsigned int id) {
+        if (updateShadow(shadowState.program, id)) {
+            glUseProgram(id);
+        }
+    }
+
+    void StateTrackerOpenGL::bindVertexArray(const unsigned int id) {
+        if (updateShadow(shadowState.vertexArray, id)) {
+            glBindVertexArray(id);
+            shadowState.buffers[static_cast<size_t>(BufferTarget::ElementArray)] = s_unknownId;
+        }
+    }
+
+    void StateTrackerOpenGL::bindBuffer(const BufferTarget target, const unsigned int id) {
+        if (updateShadow(shadowState.buffers[static_cast<size_t>(target)], id)) {
+            glBindBuffer(bufferTargetToGLenum(target), id);
+        }
+    }
+
+    void StateTrackerOpenGL::bindBufferBase(const BufferTarget target, const unsigned int index,
+                                            const unsigned int id) {
+        if (index >= s_maxIndexedBindings) {
+            glBindBufferBase(bufferTargetToGLenum(target), index, id);
+            ++currentFrameStats.issuedCalls;
+
+            return;
+        }
+
+        if (updateShadow(shadowState.indexedBuffers[static_cast<size_t>(target)][index], id)) {
+            glBindBufferBase(bufferTargetToGLenum(target), index, id);
+            shadowState.buffers[static_cast<size_t>(target)] = id;
+        }
+    }
+
+    void StateTrackerOpenGL::bindBufferRange(const BufferTarget target, const unsigned int index,
+                                             const unsigned int id, const size_t offset,
+                                             const size_t size) {
+        glBindBufferRange(bufferTargetToGLenum(target), index, id,
+                          static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size));
+        ++currentFrameStats.issuedCalls;
+
+        if (index < s_maxIndexedBindings) {
+            shadowState.indexedBuffers[static_cast<size_t>(target)][index] = s_unknownId;
+        }
+
+        shadowState.buffers[static_cast<size_t>(target)] = id;
+    }
+
+    void StateTrackerOpenGL::bindTextureUnit(const unsigned int unit, const unsigned int id) {
+        if (unit >= s_maxTextureUnits) {
+            glBindTextureUnit(unit, id);
+            ++currentFrameStats.issuedCalls;
+
+            return;
+        }
+
+        if (updateShadow(shadowState.textures[unit], id)) {
+            glBindTextureUnit(unit, id);
+        }
+    }
+
+    void StateTrackerOpenGL::bindSampler(const unsigned int unit, const unsigned int id) {
+        if (unit >= s_maxTextureUnits) {
+            glBindSampler(unit, id);
+            ++currentFrameStats.issuedCalls;
+
+            return;
+        }
+
+        if (updateShadow(shadowState.samplers[unit], id)) {
+            glBindSampler(unit, id);
+        }
+    }
+
+    void StateTrackerOpenGL::setDepthTest(const bool enabled) {
+        setCapability(shadowState.depthTest, GL_DEPTH_TEST, enabled);
+    }
+
+    void StateTrackerOpenGL::setDepthWrite(const bool enabled) {
+        if (updateShadow(shadowState.depthWrite, enabled)) {
+            glDepthMask(enabled ? GL_TRUE : GL_FALSE);
+        }
+    }
+
+    void StateTrackerOpenGL::setDepthFunction(const DepthFunction function) {
+        if (shadowState.depthFunction == static_cast<int>(function)) {
+            ++currentFrameStats.skippedCalls;
+
+            return;
+        }
+
+        shadowState.depthFunction = static_cast<int>(function);
+        glDepthFunc(depthFunctionToGLenum(function));
+        ++currentFrameStats.issuedCalls;
+    }
+
+    void StateTrackerOpenGL::setBlending(const bool enabled) {
+        if (!updateShadow(shadowState.blending, enabled)) {
+            return;
+        }
+
+        if (enabled) {
+            glEnable(GL_BLEND);
+            glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        } else {
+            glDisable(GL_BLEND);
+        }
+    }
+
+    void StateTrackerOpenGL::setCullFace(const bool enabled) {
+        setCapability(shadowState.cullFace, GL_CULL_FACE, enabled);
+    }
+
+    void StateTrackerOpenGL::setClearColor(const float red, const float green,
+                                           const float blue, const float alpha) {
+        const std::array<float, 4> clearColor{ red, green, blue, alpha };
+
+        if (shadowState.clearColorKnown && shadowState.clearColor == clearColor) {
+            ++currentFrameStats.skippedCalls;
+
+            return;
+        }
+
+        shadowState.clearColorKnown = true;
+        shadowState.clearColor = clearColor;
+        glClearColor(red, green, blue, alpha);
+        ++currentFrameStats.issuedCalls;
+    }
+
+    void StateTrackerOpenGL::applyPipelineState(const PipelineState &state) {
+        setDepthTest(state.depthTest);
+        setDepthWrite(state.depthWrite);
+        setDepthFunction(state.depthFunction);
+        setBlending(state.blending);
+        setCullFace(state.cullFace);
+    }
+
+    void StateTrackerOpenGL::onProgramDeleted(const unsigned int id) {
+        if (shadowState.program == id) {
+            shadowState.program = 0;
+        }
+    }
+
+    void StateTrackerOpenGL::onVertexArrayDeleted(const unsigned int id) {
+        if (shadowState.vertexArray == id) {
+            shadowState.vertexArray = 0;
+        }
+    }
+
+    void StateTrackerOpenGL::onBufferDeleted(const unsigned int id) {
+        for (unsigned int &buffer : shadowState.buffers) {
+            if (buffer == id) {
+                buffer = 0;
+            }
+        }
+
+        for (auto &targetBindings : shadowState.indexedBuffers) {
+            for (unsigned int &buffer : targetBindings) {
+                if (buffer == id) {
+                    buffer = 0;
+                }
+            }
+        }
+    }
+
+    void StateTrackerOpenGL::onTextureDeleted(const unsigned int id) {
+        for (unsigned int &texture : shadowState.textures) {
+            if (texture == id) {
+                texture = 0;
+            }
+        }
+    }
+
+    void StateTrackerOpenGL::onSamplerDeleted(const unsigned int id) {
+        for (unsigned int &sampler : shadowState.samplers) {
+            if (sampler == id) {
+                sampler = 0;
+            }
+        }
+    }
+
+    void StateTrackerOpenGL::invalidate() {
+        shadowState = ShadowState{};
+    }
+
+    void StateTrackerOpenGL::beginFrame() {
+        FrameStats::add(FrameCounter::StateChanges, currentFrameStats.issuedCalls);
+
+        lastFrameStats = currentFrameStats;
+        currentFrameStats = {};
+    }
+
+    const StateTrackerOpenGL::Stats &StateTrackerOpenGL::getLastFrameStats() {
+        return lastFrameStats;
+    }
+}
@@ -0,0 +1,159 @@
+#include "game_engine_core/rendering/OpenGL/stream_buffer.hpp"
+
+#include "game_engine_core/rendering/render_thread.hpp"
+#include "game_engine_core/log.hpp"
+#include "game_engine_core/frame_stats.hpp"
+
+#include "glad/glad.h"
+
+#include <utility>
+
+namespace game_engine {
+    constexpr GLuint64 s_fenceTimeoutNanoseconds = 1'000'000'000;
+
+    StreamBuffer::StreamBuffer(const size_t regionSize, const unsigned int regionsCount)
+        : m_regionSize{regionSize}, m_regionsCount{regionsCount},
+          m_fences(regionsCount, nullptr) {
+        constexpr GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        const GLsizeiptr size = static_cast<GLsizeiptr>(m_regionSize * m_regionsCount);
+
+        glCreateBuffers(1, &m_id);
+        glNamedBufferStorage(m_id, size, nullptr, flags);
+        m_mappedData = static_cast<unsigned char*>(glMapNamedBufferRange(m_id, 0, size, flags));
+
+        FrameStats::add(FrameCounter::Allocations);
+
+        if (!m_mappedData) {
+            LOG_CATEGORY_CRITICAL(Render, "StreamBuffer: failed to map {0} bytes persistently", size);
+        }
+    }
+
+    StreamBuffer::~StreamBuffer() {
+        release();
+    }
+
+    StreamBuffer &StreamBuffer::operator=(StreamBuffer &&streamBuffer) noexcept {
+        release();
+
+        m_id = streamBuffer.m_id;
+        m_mappedData = streamBuffer.m_mappedData;
+        m_regionSize = streamBuffer.m_regionSize;
+        m_regionsCount = streamBuffer.m_regionsCount;
+        m_currentRegion = streamBuffer.m_currentRegion;
+        m_regionUsed = streamBuffer.m_regionUsed;
+        m_stallsCount = streamBuffer.m_stallsCount;
+        m_fences = std::move(streamBuffer.m_fences);
+
+        streamBuffer.m_id = 0;
+        streamBuffer.m_mappedData = nullptr;
+        streamBuffer.m_fences.clear();
+
+        return *this;
+    }
+
+    StreamBuffer::StreamBuffer(StreamBuffer &&streamBuffer) noexcept
+        : m_id{streamBuffer.m_id}, m_mappedData{streamBuffer.m_mappedData},
+          m_regionSize{streamBuffer.m_regionSize}, m_regionsCount{streamBuffer.m_regionsCount},
+          m_currentRegion{streamBuffer.m_currentRegion}, m_regionUsed{streamBuffer.m_regionUsed},
+          m_stallsCount{streamBuffer.m_stallsCount}, m_fences{std::move(streamBuffer.m_fences)} {
+        streamBuffer.m_id = 0;
+        streamBuffer.m_mappedData = nullptr;
+        streamBuffer.m_fences.clear();
+    }
+
+    void StreamBuffer::release() {
+        if (m_id != 0 || !m_fences.empty()) {
+            RenderThread::releaseResource([id = m_id, fences = std::move(m_fences)]() {
+                for (void *fence : fences) {
+                    if (fence) {
+                        glDeleteSync(static_cast<GLsync>(fence));
+                    }
+                }
+
+                if (id != 0) {
+                    glUnmapNamedBuffer(id);
+                    StateTrackerOpenGL::onBufferDeleted(id);
+                    glDeleteBuffers(1, &id);
+                }
+            });
+        }
+
+        m_fences.clear();
+
+        m_id = 0;
+        m_mappedData = nullptr;
+    }
+
+    void StreamBuffer::beginFrame() {
+        m_currentRegion = (m_currentRegion + 1) % m_regionsCount;
+        m_regionUsed = 0;
+
+        GLsync fence = static_cast<GLsync>(m_fences[m_currentRegion]);
+
+        if (!fence) {
+            return;
+        }
+
+        GLint status = GL_UNSIGNALED;
+        glGetSynciv(fence, GL_SYNC_STATUS, 1, nullptr, &status);
+
+        if (status != GL_SIGNALED) {
+            ++m_stallsCount;
+        }
+
+        GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT,
+                                         s_fenceTimeoutNanoseconds);
+
+        while (result == GL_TIMEOUT_EXPIRED) {
+            LOG_CATEGORY_WARNING(Render, "StreamBuffer: region {0} fence is still busy after "
+                                 "{1} ms", m_currentRegion, s_fenceTimeoutNanoseconds / 1'000'000);
+
+            result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, s_fenceTimeoutNanoseconds);
+        }
+
+        if (result == GL_WAIT_FAILED) {
+            LOG_CATEGORY_ERROR(Render, "StreamBuffer: waiting for region {0} fence failed", m_currentRegion);
+        }
+
+        glDeleteSync(fence);
+        m_fences[m_currentRegion] = nullptr;
+    }
+
+    void StreamBuffer::endFrame() {
+        if (m_fences[m_currentRegion]) {
+            glDeleteSync(static_cast<GLsync>(m_fences[m_currentRegion]));
+        }
+
+        m_fences[m_currentRegion] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+
+    void *StreamBuffer::allocate(const size_t size, const size_t alignment, size_t &offset) {
+        const size_t regionOffset = m_currentRegion * m_regionSize;
+        const size_t used = regionOffset + m_regionUsed;
+        const size_t alignedUsed = (alignment > 1 ?
+            (used + alignment - 1) / alignment * alignment : used) - regionOffset;
+
+        if (!m_mappedData || alignedUsed + size > m_regionSize) {
+            LOG_CATEGORY_ERROR(Render, "StreamBuffer: region overflow, requested {0} bytes with {1} of {2} used",
+                      size, m_regionUsed, m_regionSize);
+
+            return nullptr;
+        }
+
+        offset = regionOffset + alignedUsed;
+        m_regionUsed = alignedUsed + size;
+
+        FrameStats::add(FrameCounter::UploadedBytes, size);
+
+        return m_mappedData + offset;
+    }
+
+    void StreamBuffer::bind(const BufferTarget target) const {
+        StateTrackerOpenGL::bindBuffer(target, m_id);
+    }
+
+    void StreamBuffer::bindRange(const BufferTarget target, const unsigned int index,
+                                 const size_t offset, const size_t size) const {
+        StateTrackerOpenGL::bindBufferRange(target, index, m_id, offset, size);
+    }
+}
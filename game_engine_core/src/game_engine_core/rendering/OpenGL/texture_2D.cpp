@@ -1,40 +1,83 @@
 #include "game_engine_core/rendering/OpenGL/texture_2D.hpp"
+#include "game_engine_core/rendering/OpenGL/state_tracker_OpenGL.hpp"
+#include "game_engine_core/rendering/OpenGL/renderer_OpenGL.hpp"
+#include "game_engine_core/rendering/OpenGL/texture_format_OpenGL.hpp"
+#include "game_engine_core/rendering/texture_container.hpp"
+#include "game_engine_core/frame_stats.hpp"
+#include "game_engine_core/log.hpp"
 
 #include <algorithm>
-#include <cmath>
 
 #include "glad/glad.h"
 
 namespace game_engine {
+    constexpr size_t s_textureBytesPerTexel = 3;
+
+    unsigned int getContainerLevelsCount(const TextureContainer &container,
+                                         const unsigned int firstLevel) {
+        return container.getLevelsCount() > firstLevel ?
+               static_cast<unsigned int>(container.getLevelsCount()) - firstLevel : 0;
+    }
+
     Texture2D::Texture2D(const unsigned char *data,
                          const unsigned int width, const unsigned int height)
-        : m_width{width}, m_height{height} {
+        : Texture2D(width, height) {
+        glTextureSubImage2D(m_id, 0, 0, 0, m_width, m_height,
+                            GL_RGB, GL_UNSIGNED_BYTE, data);
+        generateMipmaps();
+
+        FrameStats::add(FrameCounter::UploadedBytes,
+                        static_cast<size_t>(m_width) * m_height * s_textureBytesPerTexel);
+    }
+
+    Texture2D::Texture2D(const unsigned int width, const unsigned int height,
+                         const TextureFormat format, const unsigned int levelsCount)
+        : m_width{width}, m_height{height}, m_format{format} {
         glCreateTextures(GL_TEXTURE_2D, 1, &m_id);
 
-        const GLsizei mipLevels = static_cast<GLsizei>(std::log2(
-            std::max(m_width, m_height))) + 1;
+        const unsigned int maxLevelsCount = calculateMipLevelsCount(m_width, m_height);
+        m_levelsCount = levelsCount > 0 ? std::min(levelsCount, maxLevelsCount) : maxLevelsCount;
 
-        glTextureStorage2D(m_id, mipLevels, GL_RGB8, m_width, m_height);
-        glTextureSubImage2D(m_id, 0, 0, 0, m_width, m_height,
-                            GL_RGB, GL_UNSIGNED_BYTE, data);
-        glTextureParameteri(m_id, GL_TEXTURE_WRAP_S, GL_REPEAT);
-        glTextureParameteri(m_id, GL_TEXTURE_WRAP_T, GL_REPEAT);
-        glTextureParameteri(m_id, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-        glTextureParameteri(m_id, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glGenerateTextureMipmap(m_id);
+        glTextureStorage2D(m_id, static_cast<GLsizei>(m_levelsCount),
+                           getTextureFormatOpenGL(m_format).internalFormat, m_width, m_height);
+        glTextureParameteri(m_id, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(m_levelsCount) - 1);
+
+        m_memorySize = calculateTextureMemorySize(m_format, m_width, m_height, m_levelsCount);
+
+        FrameStats::add(FrameCounter::Allocations);
+        FrameStats::addTextureMemory(static_cast<int64_t>(m_memorySize));
+    }
+
+    Texture2D::Texture2D(const TextureContainer &container, const unsigned int firstLevel)
+        : m_format{container.getFormat()} {
+        if (firstLevel >= container.getLevelsCount()) {
+            LOG_CATEGORY_ERROR(Render, "Texture2D: first level {0} is out of {1} container levels",
+                               firstLevel, container.getLevelsCount());
+
+            return;
+        }
+
+        reallocateLevels(container, firstLevel);
     }
 
     Texture2D::~Texture2D() {
-        glDeleteTextures(1, &m_id);
+        RendererOpenGL::releaseTexture(m_id);
+        FrameStats::addTextureMemory(-static_cast<int64_t>(m_memorySize));
     }
 
     Texture2D &Texture2D::operator=(Texture2D &&texture) noexcept {
-        glDeleteTextures(1, &m_id);
+        RendererOpenGL::releaseTexture(m_id);
+        FrameStats::addTextureMemory(-static_cast<int64_t>(m_memorySize));
 
         m_id = texture.m_id;
         m_width = texture.m_width;
         m_height = texture.m_height;
+        m_format = texture.m_format;
+        m_levelsCount = texture.m_levelsCount;
+        m_firstLevel = texture.m_firstLevel;
+        m_memorySize = texture.m_memorySize;
         texture.m_id = 0;
+        texture.m_memorySize = 0;
 
         return *this;
     }
@@ -43,10 +86,104 @@ namespace game_engine {
         m_id = texture.m_id;
         m_width = texture.m_width;
         m_height = texture.m_height;
+        m_format = texture.m_format;
+        m_levelsCount = texture.m_levelsCount;
+        m_firstLevel = texture.m_firstLevel;
+        m_memorySize = texture.m_memorySize;
         texture.m_id = 0;
+        texture.m_memorySize = 0;
+    }
+
+    void Texture2D::uploadRows(const unsigned int firstRow, const unsigned int rowsCount,
+                               const unsigned int pixelUnpackBuffer, const size_t offset) {
+        StateTrackerOpenGL::bindBuffer(BufferTarget::PixelUnpack, pixelUnpackBuffer);
+        glTextureSubImage2D(m_id, 0, 0, firstRow, m_width, rowsCount, GL_RGB, GL_UNSIGNED_BYTE,
+                            reinterpret_cast<const void*>(offset));
+        StateTrackerOpenGL::bindBuffer(BufferTarget::PixelUnpack, 0);
+
+        FrameStats::add(FrameCounter::UploadedBytes, getRowPitch(m_width) * rowsCount);
+    }
+
+    void Texture2D::uploadLevel(const unsigned int level, const void *data, const size_t size) {
+        const GLsizei width = static_cast<GLsizei>(std::max(m_width >> level, 1u));
+        const GLsizei height = static_cast<GLsizei>(std::max(m_height >> level, 1u));
+        const TextureFormatOpenGL &formatOpenGL = getTextureFormatOpenGL(m_format);
+
+        if (level >= m_levelsCount || size != calculateTextureLevelSize(m_format, width, height)) {
+            LOG_CATEGORY_ERROR(Render, "Texture2D: level {0} upload of {1} bytes doesn't match {2}",
+                               level, size, getTextureFormatInfo(m_format).name);
+
+            return;
+        }
+
+        if (getTextureFormatInfo(m_format).isCompressed) {
+            glCompressedTextureSubImage2D(m_id, static_cast<GLint>(level), 0, 0, width, height,
+                                          formatOpenGL.internalFormat,
+                                          static_cast<GLsizei>(size), data);
+        } else {
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+            glTextureSubImage2D(m_id, static_cast<GLint>(level), 0, 0, width, height,
+                                formatOpenGL.uploadFormat, formatOpenGL.uploadType, data);
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        }
+
+        FrameStats::add(FrameCounter::UploadedBytes, size);
+    }
+
+    void Texture2D::reallocateLevels(const TextureContainer &container,
+                                     const unsigned int firstLevel) {
+        if ((m_id != 0 && firstLevel == m_firstLevel) ||
+            firstLevel >= container.getLevelsCount()) {
+            return;
+        }
+
+        Texture2D texture(container.getLevel(firstLevel).width,
+                          container.getLevel(firstLevel).height, container.getFormat(),
+                          getContainerLevelsCount(container, firstLevel));
+        texture.m_firstLevel = firstLevel;
+
+        for (unsigned int level = 0; level < texture.m_levelsCount; ++level) {
+            const unsigned int containerLevel = firstLevel + level;
+            const TextureLevel &textureLevel = container.getLevel(containerLevel);
+
+            if (containerLevel >= m_firstLevel && containerLevel - m_firstLevel < m_levelsCount) {
+                glCopyImageSubData(m_id, GL_TEXTURE_2D,
+                                   static_cast<GLint>(containerLevel - m_firstLevel), 0, 0, 0,
+                                   texture.m_id, GL_TEXTURE_2D, static_cast<GLint>(level), 0, 0, 0,
+                                   static_cast<GLsizei>(textureLevel.width),
+                                   static_cast<GLsizei>(textureLevel.height), 1);
+            } else {
+                texture.uploadLevel(level, textureLevel.data.data(), textureLevel.data.size());
+            }
+        }
+
+        *this = std::move(texture);
+    }
+
+    void Texture2D::generateMipmaps() {
+        glGenerateTextureMipmap(m_id);
+    }
+
+    size_t Texture2D::getRowPitch(const unsigned int width) {
+        return (static_cast<size_t>(width) * s_textureBytesPerTexel + 3) / 4 * 4;
+    }
+
+    bool Texture2D::isFormatSupported(const TextureFormat format) {
+        switch (format) {
+            case TextureFormat::BC1:
+            case TextureFormat::BC3:
+                return RendererOpenGL::isExtensionSupported("GL_EXT_texture_compression_s3tc");
+            case TextureFormat::BC1_SRGB:
+            case TextureFormat::BC3_SRGB:
+                return RendererOpenGL::isExtensionSupported("GL_EXT_texture_compression_s3tc") &&
+                       (RendererOpenGL::isExtensionSupported("GL_EXT_texture_sRGB") ||
+                        RendererOpenGL::isExtensionSupported("GL_EXT_texture_compression_s3tc_srgb"));
+            default:
+                return format < TextureFormat::FormatsCount;
+        }
     }
 
     void Texture2D::bind(const unsigned int unit) const {
-        glBindTextureUnit(unit, m_id);
+        StateTrackerOpenGL::bindTextureUnit(unit, m_id);
     }
 }
@@ -0,0 +1,166 @@
+#include "game_engine_core/rendering/OpenGL/texture_2D_array.hpp"
+#include "game_engine_core/rendering/OpenGL/texture_2D.hpp"
+#include "game_engine_core/rendering/OpenGL/texture_format_OpenGL.hpp"
+#include "game_engine_core/rendering/OpenGL/state_tracker_OpenGL.hpp"
+#include "game_engine_core/rendering/OpenGL/renderer_OpenGL.hpp"
+#include "game_engine_core/rendering/texture_container.hpp"
+#include "game_engine_core/frame_stats.hpp"
+#include "game_engine_core/log.hpp"
+
+#include <algorithm>
+
+#include "glad/glad.h"
+
+namespace game_engine {
+    Texture2DArray::Texture2DArray(const unsigned int width, const unsigned int height,
+                                   const unsigned int layersCount, const TextureFormat format,
+                                   const unsigned int levelsCount)
+        : m_width{width}, m_height{height}, m_layersCount{layersCount}, m_format{format} {
+        glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &m_id);
+
+        const unsigned int maxLevelsCount = calculateMipLevelsCount(m_width, m_height);
+        m_levelsCount = levelsCount > 0 ? std::min(levelsCount, maxLevelsCount) : maxLevelsCount;
+
+        glTextureStorage3D(m_id, static_cast<GLsizei>(m_levelsCount),
+                           getTextureFormatOpenGL(m_format).internalFormat,
+                           m_width, m_height, m_layersCount);
+        glTextureParameteri(m_id, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(m_levelsCount) - 1);
+
+        m_memorySize = calculateTextureMemorySize(m_format, m_width, m_height, m_levelsCount) *
+                       m_layersCount;
+
+        FrameStats::add(FrameCounter::Allocations);
+        FrameStats::addTextureMemory(static_cast<int64_t>(m_memorySize));
+    }
+
+    Texture2DArray::~Texture2DArray() {
+        RendererOpenGL::releaseTexture(m_id);
+        FrameStats::addTextureMemory(-static_cast<int64_t>(m_memorySize));
+    }
+
+    Texture2DArray &Texture2DArray::operator=(Texture2DArray &&textureArray) noexcept {
+        RendererOpenGL::releaseTexture(m_id);
+        FrameStats::addTextureMemory(-static_cast<int64_t>(m_memorySize));
+
+        m_id = textureArray.m_id;
+        m_width = textureArray.m_width;
+        m_height = textureArray.m_height;
+        m_layersCount = textureArray.m_layersCount;
+        m_format = textureArray.m_format;
+        m_levelsCount = textureArray.m_levelsCount;
+        m_memorySize = textureArray.m_memorySize;
+        textureArray.m_id = 0;
+        textureArray.m_memorySize = 0;
+
+        return *this;
+    }
+
+    Texture2DArray::Texture2DArray(Texture2DArray &&textureArray) noexcept {
+        m_id = textureArray.m_id;
+        m_width = textureArray.m_width;
+        m_height = textureArray.m_height;
+        m_layersCount = textureArray.m_layersCount;
+        m_format = textureArray.m_format;
+        m_levelsCount = textureArray.m_levelsCount;
+        m_memorySize = textureArray.m_memorySize;
+        textureArray.m_id = 0;
+        textureArray.m_memorySize = 0;
+    }
+
+    bool Texture2DArray::uploadLayer(const unsigned int layer, const unsigned int level,
+                                     const void *data, const size_t size) {
+        const GLsizei width = static_cast<GLsizei>(std::max(m_width >> level, 1u));
+        const GLsizei height = static_cast<GLsizei>(std::max(m_height >> level, 1u));
+        const TextureFormatOpenGL &formatOpenGL = getTextureFormatOpenGL(m_format);
+
+        if (layer >= m_layersCount || level >= m_levelsCount ||
+            size != calculateTextureLevelSize(m_format, width, height)) {
+            LOG_CATEGORY_ERROR(Render,
+                               "Texture2DArray: can't upload {0} bytes to layer {1} level {2}",
+                               size, layer, level);
+
+            return false;
+        }
+
+        if (getTextureFormatInfo(m_format).isCompressed) {
+            glCompressedTextureSubImage3D(m_id, static_cast<GLint>(level), 0, 0,
+                                          static_cast<GLint>(layer), width, height, 1,
+                                          formatOpenGL.internalFormat,
+                                          static_cast<GLsizei>(size), data);
+        } else {
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+            glTextureSubImage3D(m_id, static_cast<GLint>(level), 0, 0, static_cast<GLint>(layer),
+                                width, height, 1, formatOpenGL.uploadFormat,
+                                formatOpenGL.uploadType, data);
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        }
+
+        FrameStats::add(FrameCounter::UploadedBytes, size);
+
+        return true;
+    }
+
+    bool Texture2DArray::uploadLayer(const unsigned int layer, const TextureContainer &container) {
+        if (container.getFormat() != m_format || container.getWidth() != m_width ||
+            container.getHeight() != m_height || container.getLevelsCount() < m_levelsCount) {
+            LOG_CATEGORY_ERROR(Render, "Texture2DArray: container {0}x{1} doesn't match layer {2}",
+                               container.getWidth(), container.getHeight(), layer);
+
+            return false;
+        }
+
+        for (unsigned int level = 0; level < m_levelsCount; ++level) {
+            const TextureLevel &textureLevel = container.getLevel(level);
+
+            if (!uploadLayer(layer, level, textureLevel.data.data(), textureLevel.data.size())) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool Texture2DArray::copyLayer(const unsigned int layer, const Texture2D &texture) {
+        if (layer >= m_layersCount || texture.getFormat() != m_format ||
+            texture.getWidth() != m_width || texture.getHeight() != m_height ||
+            texture.getLevelsCount() < m_levelsCount) {
+            LOG_CATEGORY_ERROR(Render, "Texture2DArray: texture {0}x{1} doesn't match layer {2}",
+                               texture.getWidth(), texture.getHeight(), layer);
+
+            return false;
+        }
+
+        for (unsigned int level = 0; level < m_levelsCount; ++level) {
+            glCopyImageSubData(texture.getId(), GL_TEXTURE_2D, static_cast<GLint>(level), 0, 0, 0,
+                               m_id, GL_TEXTURE_2D_ARRAY, static_cast<GLint>(level),
+                               0, 0, static_cast<GLint>(layer),
+                               static_cast<GLsizei>(std::max(m_width >> level, 1u)),
+                               static_cast<GLsizei>(std::max(m_height >> level, 1u)), 1);
+        }
+
+        return true;
+    }
+
+    bool Texture2DArray::clear(const glm::vec4 &color) {
+        if (getTextureFormatInfo(m_format).isCompressed) {
+            LOG_CATEGORY_ERROR(Render, "Texture2DArray: can't clear compressed format {0}",
+                               getTextureFormatInfo(m_format).name);
+
+            return false;
+        }
+
+        for (unsigned int level = 0; level < m_levelsCount; ++level) {
+            glClearTexImage(m_id, static_cast<GLint>(level), GL_RGBA, GL_FLOAT, &color[0]);
+        }
+
+        return true;
+    }
+
+    void Texture2DArray::generateMipmaps() {
+        glGenerateTextureMipmap(m_id);
+    }
+
+    void Texture2DArray::bind(const unsigned int unit) const {
+        StateTrackerOpenGL::bindTextureUnit(unit, m_id);
+    }
+}
@@ -0,0 +1,42 @@
+#include "game_engine_core/rendering/OpenGL/texture_format_OpenGL.hpp"
+
+#include "glad/glad.h"
+
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+    #define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+    #define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+#ifndef GL_COMPRESSED_SRGB_S3TC_DXT1_EXT
+    #define GL_COMPRESSED_SRGB_S3TC_DXT1_EXT 0x8C4C
+#endif
+#ifndef GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT
+    #define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT 0x8C4F
+#endif
+
+namespace game_engine {
+    constexpr TextureFormatOpenGL s_textureFormatsOpenGL[] = {
+        { GL_R8,                                   GL_RED,  GL_UNSIGNED_BYTE },
+        { GL_RG8,                                  GL_RG,   GL_UNSIGNED_BYTE },
+        { GL_RGB8,                                 GL_RGB,  GL_UNSIGNED_BYTE },
+        { GL_RGBA8,                                GL_RGBA, GL_UNSIGNED_BYTE },
+        { GL_SRGB8_ALPHA8,                         GL_RGBA, GL_UNSIGNED_BYTE },
+        { GL_RGBA16F,                              GL_RGBA, GL_HALF_FLOAT },
+        { GL_COMPRESSED_RGB_S3TC_DXT1_EXT,         0,       0 },
+        { GL_COMPRESSED_SRGB_S3TC_DXT1_EXT,        0,       0 },
+        { GL_COMPRESSED_RGBA_S3TC_DXT5_EXT,        0,       0 },
+        { GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT,  0,       0 },
+        { GL_COMPRESSED_RED_RGTC1,                 0,       0 },
+        { GL_COMPRESSED_RG_RGTC2,                  0,       0 },
+        { GL_COMPRESSED_RGBA_BPTC_UNORM,           0,       0 },
+        { GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM,     0,       0 }
+    };
+
+    static_assert(sizeof(s_textureFormatsOpenGL) / sizeof(s_textureFormatsOpenGL[0]) ==
+                  static_cast<size_t>(TextureFormat::FormatsCount));
+
+    const TextureFormatOpenGL &getTextureFormatOpenGL(const TextureFormat format) {
+        return s_textureFormatsOpenGL[static_cast<size_t>(format)];
+    }
+}
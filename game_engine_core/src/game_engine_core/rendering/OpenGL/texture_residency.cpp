@@ -0,0 +1,345 @@
+#include "game_engine_core/rendering/OpenGL/texture_residency.hpp"
+#include "game_engine_core/rendering/render_thread.hpp"
+#include "game_engine_core/frame_stats.hpp"
+#include "game_engine_core/profiler.hpp"
+#include "game_engine_core/log.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <unordered_map>
+
+namespace game_engine {
+    constexpr float s_residencyMinDistance = 0.01f;
+
+    struct ResidentTexture {
+        std::shared_ptr<const TextureContainer> container;
+        std::unique_ptr<Texture2D> texture;
+        std::vector<size_t> residentSizes;
+        unsigned int tailLevel = 0;
+        unsigned int targetLevel = 0;
+        uint64_t lastUsedFrame = 0;
+        uint64_t lastFinestUseFrame = 0;
+        float screenSize = 0.0f;
+    };
+
+    std::vector<std::shared_ptr<ResidentTexture>> residentTextures;
+    std::unordered_map<const Texture2D*, ResidentTexture*> residentTexturesLookup;
+    std::vector<ResidentTexture*> residencyOrder;
+
+    std::atomic<bool> isTextureResidencyActive{false};
+    std::atomic<size_t> residencyBudget{TextureResidency::s_defaultBudget};
+    std::atomic<size_t> residencyUploadBudget{TextureResidency::s_defaultUploadBudget};
+    std::atomic<size_t> residentTexturesBytes{0};
+    std::atomic<size_t> residentTexturesCount{0};
+    uint64_t residencyFrameIndex = 0;
+
+    unsigned int getLastResidentLevel(const ResidentTexture &residentTexture) {
+        return static_cast<unsigned int>(residentTexture.residentSizes.size()) - 1;
+    }
+
+    size_t getResidentSize(const ResidentTexture &residentTexture, const unsigned int firstLevel) {
+        return residentTexture.residentSizes[firstLevel];
+    }
+
+    unsigned int chooseTargetLevel(ResidentTexture &residentTexture) {
+        const unsigned int currentLevel = residentTexture.texture->getFirstLevel();
+
+        if (residentTexture.lastUsedFrame != residencyFrameIndex) {
+            const uint64_t unusedFrames = residencyFrameIndex - residentTexture.lastUsedFrame;
+
+            return unusedFrames < TextureResidency::s_releaseDelayFrames ?
+                   currentLevel : std::max(currentLevel, residentTexture.tailLevel);
+        }
+
+        const unsigned int requiredLevel = std::min(TextureResidency::calculateRequiredLevel(
+            residentTexture.container->getWidth(), residentTexture.container->getHeight(),
+            static_cast<unsigned int>(residentTexture.residentSizes.size()),
+            residentTexture.screenSize), residentTexture.tailLevel);
+
+        if (requiredLevel <= currentLevel) {
+            residentTexture.lastFinestUseFrame = residencyFrameIndex;
+
+            return requiredLevel;
+        }
+
+        const uint64_t coarserFrames = residencyFrameIndex - residentTexture.lastFinestUseFrame;
+
+        return coarserFrames < TextureResidency::s_releaseDelayFrames ?
+               currentLevel : requiredLevel;
+    }
+
+    void TextureResidency::initialize(const size_t budgetBytes) {
+        residencyBudget = budgetBytes;
+        residencyFrameIndex = 0;
+    }
+
+    void TextureResidency::shutdown() {
+        isTextureResidencyActive = false;
+
+        residentTexturesLookup.clear();
+        residencyOrder.clear();
+        residentTextures.clear();
+        residentTexturesBytes = 0;
+        residentTexturesCount = 0;
+
+        FrameStats::setResidentTextureBytes(0);
+    }
+
+    bool TextureResidency::isActive() {
+        return isTextureResidencyActive.load(std::memory_order_relaxed);
+    }
+
+    void registerResidentTexture(const std::shared_ptr<ResidentTexture> &residentTexture) {
+        residentTexture->texture->reallocateLevels(*residentTexture->container,
+                                                   residentTexture->tailLevel);
+        residentTexture->targetLevel = residentTexture->tailLevel;
+        residentTexture->lastUsedFrame = residencyFrameIndex;
+        residentTexture->lastFinestUseFrame = residencyFrameIndex;
+
+        residentTexturesBytes += getResidentSize(*residentTexture, residentTexture->tailLevel);
+
+        residentTexturesLookup.emplace(residentTexture->texture.get(), residentTexture.get());
+        residencyOrder.push_back(residentTexture.get());
+        residentTextures.push_back(residentTexture);
+        residentTexturesCount = residentTextures.size();
+
+        isTextureResidencyActive = true;
+    }
+
+    void unregisterResidentTexture(const Texture2D *texture) {
+        const auto found = residentTexturesLookup.find(texture);
+
+        if (found == residentTexturesLookup.end()) {
+            return;
+        }
+
+        ResidentTexture *residentTexture = found->second;
+        residentTexturesBytes -= getResidentSize(*residentTexture,
+                                                 residentTexture->texture->getFirstLevel());
+
+        residentTexturesLookup.erase(found);
+        residencyOrder.erase(std::find(residencyOrder.begin(), residencyOrder.end(),
+                                       residentTexture));
+        residentTextures.erase(std::find_if(residentTextures.begin(), residentTextures.end(),
+            [residentTexture](const std::shared_ptr<ResidentTexture> &candidate) {
+                return candidate.get() == residentTexture;
+            }));
+        residentTexturesCount = residentTextures.size();
+
+        isTextureResidencyActive = !residentTextures.empty();
+    }
+
+    const Texture2D *TextureResidency::add(std::shared_ptr<const TextureContainer> container) {
+        if (!container || container->isEmpty()) {
+            LOG_CATEGORY_ERROR(Render, "TextureResidency: can't manage an empty texture");
+
+            return nullptr;
+        }
+
+        if (!Texture2D::isFormatSupported(container->getFormat())) {
+            LOG_CATEGORY_ERROR(Render, "TextureResidency: format {0} isn't supported",
+                               getTextureFormatInfo(container->getFormat()).name);
+
+            return nullptr;
+        }
+
+        auto residentTexture = std::make_shared<ResidentTexture>();
+        const unsigned int levelsCount = static_cast<unsigned int>(container->getLevelsCount());
+
+        residentTexture->residentSizes.resize(levelsCount);
+        size_t residentSize = 0;
+        for (unsigned int level = levelsCount; level-- > 0;) {
+            residentSize += container->getLevel(level).data.size();
+            residentTexture->residentSizes[level] = residentSize;
+        }
+
+        residentTexture->tailLevel = levelsCount - 1;
+        while (residentTexture->tailLevel > 0) {
+            const TextureLevel &level = container->getLevel(residentTexture->tailLevel - 1);
+
+            if (std::max(level.width, level.height) > s_minResidentSize) {
+                break;
+            }
+
+            --residentTexture->tailLevel;
+        }
+
+        residentTexture->container = std::move(container);
+        residentTexture->texture = std::make_unique<Texture2D>();
+
+        const Texture2D *texture = residentTexture->texture.get();
+
+        RenderThread::enqueue([residentTexture]() {
+            registerResidentTexture(residentTexture);
+        });
+
+        return texture;
+    }
+
+    void TextureResidency::remove(const Texture2D *texture) {
+        RenderThread::enqueue([texture]() {
+            unregisterResidentTexture(texture);
+        });
+    }
+
+    void TextureResidency::update(const std::vector<TextureResidencyRequest> &requests) {
+        PROFILE_SCOPE("TextureResidency::update");
+
+        if (residentTextures.empty()) {
+            return;
+        }
+
+        ++residencyFrameIndex;
+
+        for (const TextureResidencyRequest &request : requests) {
+            const auto found = residentTexturesLookup.find(request.texture);
+
+            if (found == residentTexturesLookup.end()) {
+                continue;
+            }
+
+            ResidentTexture &residentTexture = *found->second;
+
+            if (residentTexture.lastUsedFrame != residencyFrameIndex) {
+                residentTexture.lastUsedFrame = residencyFrameIndex;
+                residentTexture.screenSize = 0.0f;
+            }
+
+            residentTexture.screenSize = std::max(residentTexture.screenSize, request.screenSize);
+        }
+
+        const size_t budget = residencyBudget.load(std::memory_order_relaxed);
+        const size_t uploadBudget = residencyUploadBudget.load(std::memory_order_relaxed);
+        size_t requiredBytes = 0;
+
+        for (const std::shared_ptr<ResidentTexture> &residentTexture : residentTextures) {
+            residentTexture->targetLevel = chooseTargetLevel(*residentTexture);
+            requiredBytes += getResidentSize(*residentTexture, residentTexture->targetLevel);
+        }
+
+        std::sort(residencyOrder.begin(), residencyOrder.end(),
+                  [](const ResidentTexture *left, const ResidentTexture *right) {
+            if (left->lastUsedFrame != right->lastUsedFrame) {
+                return left->lastUsedFrame < right->lastUsedFrame;
+            }
+
+            return left->screenSize < right->screenSize;
+        });
+
+        for (ResidentTexture *residentTexture : residencyOrder) {
+            while (requiredBytes > budget &&
+                   residentTexture->targetLevel < getLastResidentLevel(*residentTexture)) {
+                const unsigned int level = residentTexture->targetLevel++;
+
+                requiredBytes -= getResidentSize(*residentTexture, level) -
+                                 getResidentSize(*residentTexture, level + 1);
+            }
+
+            if (requiredBytes <= budget) {
+                break;
+            }
+        }
+
+        uint64_t evictedLevels = 0;
+
+        for (ResidentTexture *residentTexture : residencyOrder) {
+            const unsigned int currentLevel = residentTexture->texture->getFirstLevel();
+            const unsigned int targetLevel = residentTexture->targetLevel;
+
+            if (targetLevel > currentLevel) {
+                evictedLevels += targetLevel - currentLevel;
+                residentTexturesBytes -= getResidentSize(*residentTexture, currentLevel) -
+                                         getResidentSize(*residentTexture, targetLevel);
+
+                residentTexture->texture->reallocateLevels(*residentTexture->container, targetLevel);
+            }
+        }
+
+        size_t uploadedBytes = 0;
+
+        for (auto it = residencyOrder.rbegin(); it != residencyOrder.rend(); ++it) {
+            ResidentTexture *residentTexture = *it;
+            const unsigned int currentLevel = residentTexture->texture->getFirstLevel();
+
+            if (residentTexture->targetLevel >= currentLevel) {
+                continue;
+            }
+
+            unsigned int level = currentLevel;
+            while (level > residentTexture->targetLevel) {
+                const size_t levelSize = getResidentSize(*residentTexture, level - 1) -
+                                         getResidentSize(*residentTexture, level);
+
+                if (uploadedBytes > 0 && uploadedBytes + levelSize > uploadBudget) {
+                    break;
+                }
+
+                uploadedBytes += levelSize;
+                --level;
+            }
+
+            if (level < currentLevel) {
+                residentTexturesBytes += getResidentSize(*residentTexture, level) -
+                                         getResidentSize(*residentTexture, currentLevel);
+
+                residentTexture->texture->reallocateLevels(*residentTexture->container, level);
+            }
+        }
+
+        FrameStats::add(FrameCounter::TextureEvictions, evictedLevels);
+        FrameStats::setResidentTextureBytes(residentTexturesBytes);
+    }
+
+    void TextureResidency::setBudget(const size_t budgetBytes) {
+        residencyBudget = budgetBytes;
+    }
+
+    size_t TextureResidency::getBudget() {
+        return residencyBudget;
+    }
+
+    void TextureResidency::setUploadBudget(const size_t bytesPerFrame) {
+        residencyUploadBudget = bytesPerFrame;
+    }
+
+    size_t TextureResidency::getUploadBudget() {
+        return residencyUploadBudget;
+    }
+
+    size_t TextureResidency::getResidentBytes() {
+        return residentTexturesBytes;
+    }
+
+    size_t TextureResidency::getTexturesCount() {
+        return residentTexturesCount;
+    }
+
+    float TextureResidency::calculateScreenSize(const float worldSize, const float distance,
+                                                const float projectionScale,
+                                                const float viewportHeight) {
+        return worldSize * projectionScale * viewportHeight * 0.5f /
+               std::max(distance, s_residencyMinDistance);
+    }
+
+    unsigned int TextureResidency::calculateRequiredLevel(const unsigned int width,
+                                                          const unsigned int height,
+                                                          const unsigned int levelsCount,
+                                                          const float screenSize) {
+        if (levelsCount == 0) {
+            return 0;
+        }
+
+        if (screenSize <= 0.0f) {
+            return levelsCount - 1;
+        }
+
+        const float texelsPerPixel = static_cast<float>(std::max(width, height)) / screenSize;
+
+        if (texelsPerPixel <= 1.0f) {
+            return 0;
+        }
+
+        return std::min(static_cast<unsigned int>(std::log2(texelsPerPixel)), levelsCount - 1);
+    }
+}
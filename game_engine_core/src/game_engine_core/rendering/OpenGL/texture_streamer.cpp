@@ -0,0 +1,392 @@
+#include "game_engine_core/rendering/OpenGL/texture_streamer.hpp"
+#include "game_engine_core/rendering/OpenGL/renderer_OpenGL.hpp"
+#include "game_engine_core/frame_stats.hpp"
+#include "game_engine_core/profiler.hpp"
+#include "game_engine_core/log.hpp"
+
+#include "glad/glad.h"
+
+#include <algorithm>
+#include <deque>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace game_engine {
+    constexpr unsigned int s_placeholderTextureSize = 8;
+    constexpr unsigned int s_placeholderCellSize = 4;
+
+    struct TextureStreamRequest {
+        StreamedTextureHandle handle;
+        TextureDecoder decoder;
+        size_t stagingOffset = 0;
+        size_t stagingSize = 0;
+        unsigned int uploadedRows = 0;
+        GLsync fence = nullptr;
+        bool isDecodeSucceeded = false;
+        std::atomic<bool> isDecoded{false};
+    };
+
+    std::mutex queuedStreamRequestsMutex;
+    std::deque<std::unique_ptr<TextureStreamRequest>> queuedStreamRequests;
+    std::deque<std::unique_ptr<TextureStreamRequest>> activeStreamRequests;
+
+    std::mutex decodeQueueMutex;
+    std::condition_variable decodeQueueCondition;
+    std::deque<TextureStreamRequest*> decodeQueue;
+    std::vector<std::thread> decodeThreads;
+
+    std::atomic<bool> isTextureStreamerRunning{false};
+    std::atomic<bool> isTextureStreamerStopping{false};
+    std::atomic<size_t> pendingStreamsCount{0};
+    std::atomic<size_t> uploadBudgetPerFrame{TextureStreamer::s_defaultUploadBudget};
+
+    GLuint stagingBufferId = 0;
+    unsigned char *stagingData = nullptr;
+    size_t stagingCapacity = 0;
+    size_t stagingHead = 0;
+
+    std::unique_ptr<Texture2D> placeholderTexture;
+
+    StreamedTexture::StreamedTexture(const unsigned int width, const unsigned int height,
+                                     const Texture2D *placeholder)
+        : m_placeholder{placeholder}, m_width{width}, m_height{height} {}
+
+    bool StreamedTexture::isDone() const {
+        const TextureStreamState state = getState();
+
+        return state == TextureStreamState::Ready || state == TextureStreamState::Failed;
+    }
+
+    const Texture2D *StreamedTexture::getTexture() const {
+        return isReady() ? m_texture.get() : m_placeholder;
+    }
+
+    void runTextureDecodeLoop() {
+        for (;;) {
+            TextureStreamRequest *request = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(decodeQueueMutex);
+                decodeQueueCondition.wait(lock, []() {
+                    return !decodeQueue.empty() || isTextureStreamerStopping.load();
+                });
+
+                if (isTextureStreamerStopping.load()) {
+                    break;
+                }
+
+                request = decodeQueue.front();
+                decodeQueue.pop_front();
+            }
+
+            PROFILE_SCOPE("TextureStreamer::decode");
+
+            const StreamedTexture &texture = *request->handle;
+            const ImageView image{ stagingData + request->stagingOffset,
+                                   texture.getWidth(), texture.getHeight(), 3,
+                                   Texture2D::getRowPitch(texture.getWidth()) };
+
+            request->isDecodeSucceeded = request->decoder && request->decoder(image);
+            request->decoder = nullptr;
+            request->isDecoded.store(true, std::memory_order_release);
+        }
+    }
+
+    void TextureStreamer::finishStream(TextureStreamRequest &request,
+                                       const TextureStreamState state) {
+        if (state != TextureStreamState::Ready) {
+            request.handle->m_texture = nullptr;
+        }
+
+        request.handle->m_state.store(state, std::memory_order_release);
+        --pendingStreamsCount;
+    }
+
+    bool allocateTextureStaging(const size_t size, size_t &offset) {
+        if (activeStreamRequests.empty()) {
+            stagingHead = 0;
+        }
+
+        const size_t tail = activeStreamRequests.empty() ?
+                            0 : activeStreamRequests.front()->stagingOffset;
+
+        if (activeStreamRequests.empty() || stagingHead > tail) {
+            if (stagingHead + size <= stagingCapacity) {
+                offset = stagingHead;
+                stagingHead += size;
+
+                return true;
+            }
+
+            if (size <= tail) {
+                offset = 0;
+                stagingHead = size;
+
+                return true;
+            }
+
+            return false;
+        }
+
+        if (stagingHead + size <= tail) {
+            offset = stagingHead;
+            stagingHead += size;
+
+            return true;
+        }
+
+        return false;
+    }
+
+    void retireTextureStreams() {
+        while (!activeStreamRequests.empty()) {
+            TextureStreamRequest &request = *activeStreamRequests.front();
+
+            if (request.fence == nullptr ||
+                glClientWaitSync(request.fence, 0, 0) == GL_TIMEOUT_EXPIRED) {
+                return;
+            }
+
+            glDeleteSync(request.fence);
+            activeStreamRequests.pop_front();
+        }
+    }
+
+    void TextureStreamer::startStreams() {
+        std::lock_guard<std::mutex> lock(queuedStreamRequestsMutex);
+
+        while (!queuedStreamRequests.empty()) {
+            std::unique_ptr<TextureStreamRequest> &request = queuedStreamRequests.front();
+            size_t offset = 0;
+
+            if (!allocateTextureStaging(request->stagingSize, offset)) {
+                return;
+            }
+
+            request->stagingOffset = offset;
+            request->handle->m_texture = std::make_unique<Texture2D>(request->handle->getWidth(),
+                                                                     request->handle->getHeight());
+            request->handle->m_state.store(TextureStreamState::Decoding,
+                                           std::memory_order_release);
+
+            {
+                std::lock_guard<std::mutex> decodeLock(decodeQueueMutex);
+                decodeQueue.push_back(request.get());
+            }
+            decodeQueueCondition.notify_one();
+
+            activeStreamRequests.push_back(std::move(request));
+            queuedStreamRequests.pop_front();
+        }
+    }
+
+    void TextureStreamer::uploadStreams() {
+        size_t budget = uploadBudgetPerFrame.load();
+
+        for (const std::unique_ptr<TextureStreamRequest> &request : activeStreamRequests) {
+            if (budget == 0) {
+                return;
+            }
+
+            if (request->fence != nullptr ||
+                !request->isDecoded.load(std::memory_order_acquire)) {
+                continue;
+            }
+
+            StreamedTexture &texture = *request->handle;
+
+            if (!request->isDecodeSucceeded) {
+                LOG_CATEGORY_ERROR(Render, "TextureStreamer: failed to decode {0}x{1} texture",
+                                   texture.getWidth(), texture.getHeight());
+
+                finishStream(*request, TextureStreamState::Failed);
+                request->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+                continue;
+            }
+
+            texture.m_state.store(TextureStreamState::Uploading, std::memory_order_release);
+
+            const size_t rowPitch = Texture2D::getRowPitch(texture.getWidth());
+            const unsigned int remainingRows = texture.getHeight() - request->uploadedRows;
+            const unsigned int rowsCount = static_cast<unsigned int>(std::clamp<size_t>(
+                budget / rowPitch, 1, remainingRows));
+
+            texture.m_texture->uploadRows(request->uploadedRows, rowsCount, stagingBufferId,
+                                          request->stagingOffset +
+                                          rowPitch * request->uploadedRows);
+
+            request->uploadedRows += rowsCount;
+            budget -= std::min(budget, rowPitch * rowsCount);
+
+            if (request->uploadedRows == texture.getHeight()) {
+                texture.m_texture->generateMipmaps();
+                request->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+                finishStream(*request, TextureStreamState::Ready);
+            }
+        }
+    }
+
+    bool TextureStreamer::initialize(const size_t stagingSize, const size_t decodeThreadsCount) {
+        if (isTextureStreamerRunning.load()) {
+            LOG_CATEGORY_WARNING(Render, "TextureStreamer: already initialized");
+
+            return false;
+        }
+
+        constexpr GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+        glCreateBuffers(1, &stagingBufferId);
+        glNamedBufferStorage(stagingBufferId, static_cast<GLsizeiptr>(stagingSize), nullptr, flags);
+        stagingData = static_cast<unsigned char*>(glMapNamedBufferRange(
+            stagingBufferId, 0, static_cast<GLsizeiptr>(stagingSize), flags));
+
+        FrameStats::add(FrameCounter::Allocations);
+
+        if (!stagingData) {
+            LOG_CATEGORY_CRITICAL(Render, "TextureStreamer: failed to map {0} bytes of staging memory",
+                                  stagingSize);
+
+            RendererOpenGL::releaseBuffer(stagingBufferId);
+            stagingBufferId = 0;
+
+            return false;
+        }
+
+        stagingCapacity = stagingSize;
+        stagingHead = 0;
+
+        std::vector<unsigned char> placeholderPixels(
+            Texture2D::getRowPitch(s_placeholderTextureSize) * s_placeholderTextureSize);
+
+        ProceduralImage placeholderImage;
+        placeholderImage.addChecker(s_placeholderCellSize, s_placeholderCellSize,
+                                    ImageColor{ 255, 0, 255 }, ImageColor{ 64, 64, 64 });
+        placeholderImage.generate(ImageView{ placeholderPixels.data(), s_placeholderTextureSize,
+                                             s_placeholderTextureSize, 3 });
+
+        placeholderTexture = std::make_unique<Texture2D>(placeholderPixels.data(),
+                                                         s_placeholderTextureSize,
+                                                         s_placeholderTextureSize);
+
+        isTextureStreamerStopping = false;
+        isTextureStreamerRunning = true;
+
+        for (size_t i = 0; i < std::max<size_t>(1, decodeThreadsCount); ++i) {
+            decodeThreads.emplace_back(runTextureDecodeLoop);
+        }
+
+        LOG_CATEGORY_INFO(Render, "TextureStreamer: {0} bytes of staging, {1} decode threads",
+                          stagingSize, decodeThreads.size());
+
+        return true;
+    }
+
+    void TextureStreamer::shutdown() {
+        if (!isTextureStreamerRunning.load()) {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(decodeQueueMutex);
+            isTextureStreamerStopping = true;
+            decodeQueue.clear();
+        }
+        decodeQueueCondition.notify_all();
+
+        for (std::thread &thread : decodeThreads) {
+            thread.join();
+        }
+        decodeThreads.clear();
+
+        for (const std::unique_ptr<TextureStreamRequest> &request : activeStreamRequests) {
+            if (request->fence != nullptr) {
+                glDeleteSync(request->fence);
+            } else {
+                finishStream(*request, TextureStreamState::Failed);
+            }
+        }
+        activeStreamRequests.clear();
+
+        {
+            std::lock_guard<std::mutex> lock(queuedStreamRequestsMutex);
+
+            for (const std::unique_ptr<TextureStreamRequest> &request : queuedStreamRequests) {
+                finishStream(*request, TextureStreamState::Failed);
+            }
+            queuedStreamRequests.clear();
+        }
+
+        glUnmapNamedBuffer(stagingBufferId);
+        RendererOpenGL::releaseBuffer(stagingBufferId);
+
+        stagingBufferId = 0;
+        stagingData = nullptr;
+        stagingCapacity = 0;
+        stagingHead = 0;
+        placeholderTexture = nullptr;
+
+        isTextureStreamerRunning = false;
+    }
+
+    bool TextureStreamer::isInitialized() {
+        return isTextureStreamerRunning.load();
+    }
+
+    StreamedTextureHandle TextureStreamer::load(const unsigned int width, const unsigned int height,
+                                                TextureDecoder decoder) {
+        auto handle = std::make_shared<StreamedTexture>(width, height, placeholderTexture.get());
+
+        auto request = std::make_unique<TextureStreamRequest>();
+        request->handle = handle;
+        request->decoder = std::move(decoder);
+        request->stagingSize = Texture2D::getRowPitch(width) * height;
+
+        if (!isTextureStreamerRunning.load() || request->stagingSize == 0 ||
+            request->stagingSize > stagingCapacity) {
+            LOG_CATEGORY_ERROR(Render, "TextureStreamer: can't stream {0}x{1} texture with {2} bytes of staging",
+                               width, height, stagingCapacity);
+
+            handle->m_state = TextureStreamState::Failed;
+
+            return handle;
+        }
+
+        ++pendingStreamsCount;
+
+        std::lock_guard<std::mutex> lock(queuedStreamRequestsMutex);
+        queuedStreamRequests.push_back(std::move(request));
+
+        return handle;
+    }
+
+    void TextureStreamer::update() {
+        if (!isTextureStreamerRunning.load()) {
+            return;
+        }
+
+        PROFILE_SCOPE("TextureStreamer::update");
+
+        retireTextureStreams();
+        startStreams();
+        uploadStreams();
+    }
+
+    void TextureStreamer::setUploadBudget(const size_t bytesPerFrame) {
+        uploadBudgetPerFrame = bytesPerFrame;
+    }
+
+    size_t TextureStreamer::getUploadBudget() {
+        return uploadBudgetPerFrame.load();
+    }
+
+    size_t TextureStreamer::getPendingCount() {
+        return pendingStreamsCount.load();
+    }
+
+    const Texture2D *TextureStreamer::getPlaceholder() {
+        return placeholderTexture.get();
+    }
+}
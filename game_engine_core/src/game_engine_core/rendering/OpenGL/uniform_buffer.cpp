@@ -0,0 +1,62 @@
+#include "game_engine_core/rendering/OpenGL/uniform_buffer.hpp"
+
+#include "game_engine_core/rendering/OpenGL/state_tracker_OpenGL.hpp"
+#include "game_engine_core/rendering/OpenGL/renderer_OpenGL.hpp"
+#include "game_engine_core/log.hpp"
+#include "game_engine_core/frame_stats.hpp"
+
+#include "glad/glad.h"
+
+namespace game_engine {
+    UniformBuffer::UniformBuffer(const size_t size, const UniformBlockBinding binding)
+        : m_size{size}, m_binding{binding} {
+        glCreateBuffers(1, &m_id);
+        glNamedBufferStorage(m_id, static_cast<GLsizeiptr>(size), nullptr,
+                             GL_DYNAMIC_STORAGE_BIT);
+        bind();
+
+        FrameStats::add(FrameCounter::Allocations);
+    }
+
+    UniformBuffer::~UniformBuffer() {
+        RendererOpenGL::releaseBuffer(m_id);
+    }
+
+    UniformBuffer &UniformBuffer::operator=(UniformBuffer &&uniformBuffer) noexcept {
+        RendererOpenGL::releaseBuffer(m_id);
+
+        m_id = uniformBuffer.m_id;
+        m_size = uniformBuffer.m_size;
+        m_binding = uniformBuffer.m_binding;
+        uniformBuffer.m_id = 0;
+        uniformBuffer.m_size = 0;
+
+        return *this;
+    }
+
+    UniformBuffer::UniformBuffer(UniformBuffer &&uniformBuffer) noexcept
+        : m_id{uniformBuffer.m_id}, m_size{uniformBuffer.m_size},
+          m_binding{uniformBuffer.m_binding} {
+        uniformBuffer.m_id = 0;
+        uniformBuffer.m_size = 0;
+    }
+
+    void UniformBuffer::setData(const void *data, const size_t size, const size_t offset) const {
+        if (offset + size > m_size) {
+            LOG_CATEGORY_ERROR(Render, "UniformBuffer: write of {0} bytes at offset {1} exceeds size {2}",
+                      size, offset, m_size);
+
+            return;
+        }
+
+        glNamedBufferSubData(m_id, static_cast<GLintptr>(offset),
+                             static_cast<GLsizeiptr>(size), data);
+
+        FrameStats::add(FrameCounter::UploadedBytes, size);
+    }
+
+    void UniformBuffer::bind() const {
+        StateTrackerOpenGL::bindBufferBase(BufferTarget::Uniform,
+                                           static_cast<unsigned int>(m_binding), m_id);
+    }
+}
@@ -1,4 +1,6 @@
 #include "game_engine_core/rendering/OpenGL/vertex_array.hpp"
+#include "game_engine_core/rendering/OpenGL/state_tracker_OpenGL.hpp"
+#include "game_engine_core/rendering/OpenGL/renderer_OpenGL.hpp"
 
 #include "game_engine_core/log.hpp"
 
@@ -6,55 +8,72 @@
 
 namespace game_engine {
     VertexArray::VertexArray() {
-        glGenVertexArrays(1, &m_id);
+        glCreateVertexArrays(1, &m_id);
     }
 
     VertexArray::~VertexArray() {
-        glDeleteVertexArrays(1, &m_id);
+        RendererOpenGL::releaseVertexArray(m_id);
     }
 
     VertexArray &VertexArray::operator=(VertexArray &&vertexArray) noexcept {
+        RendererOpenGL::releaseVertexArray(m_id);
+
         m_id = vertexArray.m_id;
-        m_elementsCount = vertexArray.m_id;
+        m_elementsCount = vertexArray.m_elementsCount;
+        m_bindingsCount = vertexArray.m_bindingsCount;
+        m_indicesCount = vertexArray.m_indicesCount;
         vertexArray.m_id = 0;
         vertexArray.m_elementsCount = 0;
+        vertexArray.m_bindingsCount = 0;
+        vertexArray.m_indicesCount = 0;
 
         return *this;
     }
 
     VertexArray::VertexArray(VertexArray &&vertexArray) noexcept
-        : m_id(vertexArray.m_id), m_elementsCount(vertexArray.m_elementsCount) {
+        : m_id(vertexArray.m_id), m_elementsCount(vertexArray.m_elementsCount),
+          m_bindingsCount(vertexArray.m_bindingsCount),
+          m_indicesCount(vertexArray.m_indicesCount) {
         vertexArray.m_id = 0;
         vertexArray.m_elementsCount = 0;
+        vertexArray.m_bindingsCount = 0;
+        vertexArray.m_indicesCount = 0;
     }
 
     void VertexArray::bind() const {
-        glBindVertexArray(m_id);
+        StateTrackerOpenGL::bindVertexArray(m_id);
     }
 
     void VertexArray::unbind() {
-        glBindVertexArray(0);
+        StateTrackerOpenGL::bindVertexArray(0);
     }
 
     void VertexArray::addVertexBuffer(const VertexBuffer &vertexBuffer) {
-        bind();
-        vertexBuffer.bind();
+        const GLsizei stride = static_cast<GLsizei>(vertexBuffer.getLayout().getStride());
 
         for (const BufferElement &currentElement : vertexBuffer.getLayout().getElements()) {
-            glEnableVertexAttribArray(m_elementsCount);
-            glVertexAttribPointer(m_elementsCount,
-                                  static_cast<GLint>(currentElement.m_componentsCount),
-                                  currentElement.m_componentType, GL_FALSE,
-                                  static_cast<GLsizei>(vertexBuffer.getLayout().getStride()),
-                                  reinterpret_cast<const void*>(currentElement.m_offset));
-
-            ++m_elementsCount;
+            const GLuint bindingIndex = m_bindingsCount++;
+            const size_t slotSize = currentElement.m_size / currentElement.m_slotsCount;
+
+            glVertexArrayVertexBuffer(m_id, bindingIndex, vertexBuffer.getId(),
+                                      static_cast<GLintptr>(currentElement.m_offset), stride);
+            glVertexArrayBindingDivisor(m_id, bindingIndex, currentElement.m_divisor);
+
+            for (size_t slot = 0; slot < currentElement.m_slotsCount; ++slot) {
+                glEnableVertexArrayAttrib(m_id, m_elementsCount);
+                glVertexArrayAttribFormat(m_id, m_elementsCount,
+                                          static_cast<GLint>(currentElement.m_componentsCount),
+                                          currentElement.m_componentType, GL_FALSE,
+                                          static_cast<GLuint>(slot * slotSize));
+                glVertexArrayAttribBinding(m_id, m_elementsCount, bindingIndex);
+
+                ++m_elementsCount;
+            }
         }
     }
 
     void VertexArray::setIndexBuffer(const IndexBuffer &indexBuffer) {
-        bind();
-        indexBuffer.bind();
+        glVertexArrayElementBuffer(m_id, indexBuffer.getId());
         m_indicesCount = indexBuffer.getCount();
     }
 }
@@ -1,5 +1,8 @@
 #include "game_engine_core/rendering/OpenGL/vertex_buffer.hpp"
+#include "game_engine_core/rendering/OpenGL/state_tracker_OpenGL.hpp"
+#include "game_engine_core/rendering/OpenGL/renderer_OpenGL.hpp"
 #include "game_engine_core/log.hpp"
+#include "game_engine_core/frame_stats.hpp"
 
 #include "glad/glad.h"
 
@@ -20,14 +23,25 @@ namespace game_engine {
 
             case ShaderDataType::Float4:
             case ShaderDataType::Int4:
+            case ShaderDataType::Mat4:
                 return 4;
         }
 
-        LOG_ERROR("shaderDataTypeToComponentType: unknown ShaderDataType!");
+        LOG_CATEGORY_ERROR(Render, "shaderDataTypeToComponentType: unknown ShaderDataType!");
 
         return 0;
     }
 
+    constexpr size_t shaderDataTypeToSlotsCount(const ShaderDataType type) {
+        switch (type) {
+            case ShaderDataType::Mat4:
+                return 4;
+
+            default:
+                return 1;
+        }
+    }
+
     constexpr size_t shaderDataTypeSize(const ShaderDataType type) {
         switch (type) {
             case ShaderDataType::Float:
@@ -41,9 +55,13 @@ namespace game_engine {
             case ShaderDataType::Int3:
             case ShaderDataType::Int4:
                 return sizeof(GLint) * shaderDataTypeToComponentsCount(type);
+
+            case ShaderDataType::Mat4:
+                return sizeof(GLfloat) * shaderDataTypeToComponentsCount(type) *
+                    shaderDataTypeToSlotsCount(type);
         }
 
-        LOG_ERROR("shaderDataTypeSize: unknown ShaderDataType!");
+        LOG_CATEGORY_ERROR(Render, "shaderDataTypeSize: unknown ShaderDataType!");
 
         return 0;
     }
@@ -54,6 +72,7 @@ namespace game_engine {
             case ShaderDataType::Float2:
             case ShaderDataType::Float3:
             case ShaderDataType::Float4:
+            case ShaderDataType::Mat4:
                 return GL_FLOAT;
 
             case ShaderDataType::Int:
@@ -63,7 +82,7 @@ namespace game_engine {
                 return GL_INT;
         }
 
-        LOG_ERROR("shaderDataTypeToComponentType: unknown ShaderDataType!");
+        LOG_CATEGORY_ERROR(Render, "shaderDataTypeToComponentType: unknown ShaderDataType!");
 
         return GL_FLOAT;
     }
@@ -75,47 +94,72 @@ namespace game_engine {
             case VertexBuffer::TypeDrawUsage::Stream: return GL_STREAM_DRAW;
         }
 
-        LOG_ERROR("Unknown VertexBuffer usage");
+        LOG_CATEGORY_ERROR(Render, "Unknown VertexBuffer usage");
 
         return GL_STREAM_DRAW;
     }
 
-    BufferElement::BufferElement(const ShaderDataType type)
+    BufferElement::BufferElement(const ShaderDataType type, const unsigned int divisor)
         : m_type{type}, m_componentType{shaderDataTypeToComponentType(type)},
           m_componentsCount{shaderDataTypeToComponentsCount(type)},
+          m_slotsCount{shaderDataTypeToSlotsCount(type)},
           m_size{shaderDataTypeSize(type)},
-          m_offset{0} {}
+          m_offset{0}, m_divisor{divisor} {}
 
     VertexBuffer::VertexBuffer(const void *data, const size_t size,
                                 BufferLayout bufferLayout, const TypeDrawUsage usage)
-        : m_bufferLayout{std::move(bufferLayout)} {
-        glGenBuffers(1, &m_id);
-        glBindBuffer(GL_ARRAY_BUFFER, m_id);
-        glBufferData(GL_ARRAY_BUFFER, size, data, usageToGLenum(usage));
+        : m_size{size}, m_bufferLayout{std::move(bufferLayout)} {
+        glCreateBuffers(1, &m_id);
+        glNamedBufferData(m_id, size, data, usageToGLenum(usage));
+
+        FrameStats::add(FrameCounter::Allocations);
+        if (data != nullptr) {
+            FrameStats::add(FrameCounter::UploadedBytes, size);
+        }
     }
 
     VertexBuffer::~VertexBuffer() {
-        glDeleteBuffers(1, &m_id);
+        RendererOpenGL::releaseBuffer(m_id);
     }
 
     VertexBuffer &VertexBuffer::operator=(VertexBuffer &&vertexBuffer) noexcept {
+        RendererOpenGL::releaseBuffer(m_id);
+
         m_id = vertexBuffer.m_id;
+        m_size = vertexBuffer.m_size;
+        m_bufferLayout = std::move(vertexBuffer.m_bufferLayout);
         vertexBuffer.m_id = 0;
+        vertexBuffer.m_size = 0;
 
         return *this;
     }
 
     VertexBuffer::VertexBuffer(VertexBuffer &&vertexBuffer) noexcept
-        : m_id{vertexBuffer.m_id},
+        : m_id{vertexBuffer.m_id}, m_size{vertexBuffer.m_size},
           m_bufferLayout{std::move(vertexBuffer.m_bufferLayout)} {
         vertexBuffer.m_id = 0;
+        vertexBuffer.m_size = 0;
+    }
+
+    void VertexBuffer::setData(const void *data, const size_t size, const size_t offset) const {
+        if (offset + size > m_size) {
+            LOG_CATEGORY_ERROR(Render, "VertexBuffer: update of {0} bytes at {1} exceeds size {2}",
+                               size, offset, m_size);
+
+            return;
+        }
+
+        glNamedBufferSubData(m_id, static_cast<GLintptr>(offset),
+                             static_cast<GLsizeiptr>(size), data);
+
+        FrameStats::add(FrameCounter::UploadedBytes, size);
     }
 
     void VertexBuffer::bind() const {
-        glBindBuffer(GL_ARRAY_BUFFER, m_id);
+        StateTrackerOpenGL::bindBuffer(BufferTarget::Array, m_id);
     }
 
     void VertexBuffer::unbind() {
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        StateTrackerOpenGL::bindBuffer(BufferTarget::Array, 0);
     }
 }
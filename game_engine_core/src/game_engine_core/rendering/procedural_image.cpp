@@ -0,0 +1,333 @@
+#include "game_engine_core/rendering/procedural_image.hpp"
+#include "game_engine_core/jobs/job_system.hpp"
+#include "game_engine_core/profiler.hpp"
+#include "game_engine_core/log.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define GAME_ENGINE_PROCEDURAL_SSE2
+    #include <emmintrin.h>
+#endif
+
+namespace game_engine {
+    namespace {
+        constexpr unsigned int s_proceduralMaxOctaves = 8;
+
+        struct RowSpan {
+            int64_t begin;
+            int64_t end;
+        };
+
+        bool isProceduralChannelsSupported(const unsigned int channels) {
+            return channels == 1 || channels == 3 || channels == 4;
+        }
+
+        void fillClippedSpan(unsigned char *row, const ImageView &image, const RowSpan &span,
+                             const ImageColor &color) {
+            const int64_t begin = std::max<int64_t>(span.begin, 0);
+            const int64_t end = std::min<int64_t>(span.end, image.width);
+
+            if (begin < end) {
+                ProceduralImage::fillSpan(row, static_cast<unsigned int>(begin),
+                                          static_cast<unsigned int>(end), image.channels, color);
+            }
+        }
+
+        bool getCircleRowSpan(const ProceduralLayer &layer, const unsigned int y, RowSpan &span) {
+            const int64_t radius = layer.width;
+            const int64_t deltaY = static_cast<int64_t>(y) - layer.y;
+            const int64_t remaining = radius * radius - deltaY * deltaY;
+
+            if (remaining <= 0) {
+                return false;
+            }
+
+            int64_t halfWidth = static_cast<int64_t>(std::sqrt(static_cast<double>(remaining)));
+            while (halfWidth > 0 && halfWidth * halfWidth >= remaining) {
+                --halfWidth;
+            }
+            while ((halfWidth + 1) * (halfWidth + 1) < remaining) {
+                ++halfWidth;
+            }
+
+            span.begin = layer.x - halfWidth;
+            span.end = layer.x + halfWidth + 1;
+
+            return true;
+        }
+
+        uint32_t hashProceduralLattice(const int32_t x, const int32_t y, const uint32_t seed) {
+            uint32_t hash = seed ^ (static_cast<uint32_t>(x) * 0x8da6b343u) ^
+                            (static_cast<uint32_t>(y) * 0xd8163841u);
+            hash ^= hash >> 13;
+            hash *= 0x5bd1e995u;
+            hash ^= hash >> 15;
+
+            return hash;
+        }
+
+        float getLatticeValue(const int32_t x, const int32_t y, const uint32_t seed) {
+            return static_cast<float>(hashProceduralLattice(x, y, seed) & 0xffffffu) /
+                   static_cast<float>(0xffffffu);
+        }
+
+        float smoothProceduralStep(const float t) {
+            return t * t * (3.0f - 2.0f * t);
+        }
+
+        float sampleValueNoise(const float x, const float y, const uint32_t seed) {
+            const float cellX = std::floor(x);
+            const float cellY = std::floor(y);
+            const int32_t x0 = static_cast<int32_t>(cellX);
+            const int32_t y0 = static_cast<int32_t>(cellY);
+            const float tx = smoothProceduralStep(x - cellX);
+            const float ty = smoothProceduralStep(y - cellY);
+
+            const float top = getLatticeValue(x0, y0, seed) +
+                              (getLatticeValue(x0 + 1, y0, seed) -
+                               getLatticeValue(x0, y0, seed)) * tx;
+            const float bottom = getLatticeValue(x0, y0 + 1, seed) +
+                                 (getLatticeValue(x0 + 1, y0 + 1, seed) -
+                                  getLatticeValue(x0, y0 + 1, seed)) * tx;
+
+            return top + (bottom - top) * ty;
+        }
+
+        unsigned char lerpColorChannel(const unsigned char low, const unsigned char high,
+                                       const float t) {
+            return static_cast<unsigned char>(static_cast<float>(low) +
+                                              (static_cast<float>(high) - low) * t + 0.5f);
+        }
+
+        void generateNoiseRow(unsigned char *row, const ImageView &image,
+                              const ProceduralLayer &layer, const unsigned int y) {
+            const unsigned int octaves = std::clamp(layer.octaves, 1u, s_proceduralMaxOctaves);
+            const float cellSize = static_cast<float>(std::max(layer.width, 1u));
+
+            float totalAmplitude = 0.0f;
+            for (unsigned int octave = 0; octave < octaves; ++octave) {
+                totalAmplitude += 1.0f / static_cast<float>(1u << octave);
+            }
+
+            const ImageColor &low = layer.colors[0];
+            const ImageColor &high = layer.colors[1];
+
+            for (unsigned int x = 0; x < image.width; ++x) {
+                float value = 0.0f;
+
+                for (unsigned int octave = 0; octave < octaves; ++octave) {
+                    const float frequency = static_cast<float>(1u << octave) / cellSize;
+
+                    value += sampleValueNoise((static_cast<float>(x) + 0.5f) * frequency,
+                                              (static_cast<float>(y) + 0.5f) * frequency,
+                                              layer.seed + octave) / static_cast<float>(1u << octave);
+                }
+
+                value /= totalAmplitude;
+
+                const ImageColor color{
+                    lerpColorChannel(low.red, high.red, value),
+                    lerpColorChannel(low.green, high.green, value),
+                    lerpColorChannel(low.blue, high.blue, value),
+                    lerpColorChannel(low.alpha, high.alpha, value)
+                };
+
+                ProceduralImage::fillSpan(row, x, x + 1, image.channels, color);
+            }
+        }
+    }
+
+    void ProceduralImage::addFill(const ImageColor &color) {
+        ProceduralLayer layer;
+        layer.type = ProceduralLayerType::Fill;
+        layer.colors[0] = color;
+
+        m_layers.push_back(layer);
+    }
+
+    void ProceduralImage::addRectangle(const int x, const int y,
+                                       const unsigned int width, const unsigned int height,
+                                       const ImageColor &color) {
+        ProceduralLayer layer;
+        layer.type = ProceduralLayerType::Rectangle;
+        layer.x = x;
+        layer.y = y;
+        layer.width = width;
+        layer.height = height;
+        layer.colors[0] = color;
+
+        m_layers.push_back(layer);
+    }
+
+    void ProceduralImage::addCircle(const int centerX, const int centerY,
+                                    const unsigned int radius, const ImageColor &color) {
+        ProceduralLayer layer;
+        layer.type = ProceduralLayerType::Circle;
+        layer.x = centerX;
+        layer.y = centerY;
+        layer.width = radius;
+        layer.height = radius;
+        layer.colors[0] = color;
+
+        m_layers.push_back(layer);
+    }
+
+    void ProceduralImage::addChecker(const unsigned int cellWidth, const unsigned int cellHeight,
+                                     const ImageColor &evenColor, const ImageColor &oddColor) {
+        ProceduralLayer layer;
+        layer.type = ProceduralLayerType::Checker;
+        layer.width = std::max(cellWidth, 1u);
+        layer.height = std::max(cellHeight, 1u);
+        layer.colors[0] = evenColor;
+        layer.colors[1] = oddColor;
+
+        m_layers.push_back(layer);
+    }
+
+    void ProceduralImage::addNoise(const unsigned int cellSize, const unsigned int octaves,
+                                   const uint32_t seed, const ImageColor &lowColor,
+                                   const ImageColor &highColor) {
+        ProceduralLayer layer;
+        layer.type = ProceduralLayerType::Noise;
+        layer.width = std::max(cellSize, 1u);
+        layer.height = layer.width;
+        layer.octaves = octaves;
+        layer.seed = seed;
+        layer.colors[0] = lowColor;
+        layer.colors[1] = highColor;
+
+        m_layers.push_back(layer);
+    }
+
+    void ProceduralImage::clear() {
+        m_layers.clear();
+    }
+
+    bool ProceduralImage::generate(const ImageView &image, const unsigned int tileRows) const {
+        PROFILE_SCOPE("ProceduralImage::generate");
+
+        if (image.data == nullptr || !isProceduralChannelsSupported(image.channels)) {
+            LOG_CATEGORY_ERROR(Render, "ProceduralImage: can't generate {0}x{1} image with {2} channels",
+                               image.width, image.height, image.channels);
+
+            return false;
+        }
+
+        const unsigned int rowsPerTile = std::max(tileRows, 1u);
+        const size_t tilesCount = (static_cast<size_t>(image.height) + rowsPerTile - 1) /
+                                  rowsPerTile;
+
+        JobSystem::parallelFor(tilesCount, 1, [this, &image, rowsPerTile](const size_t beginTile,
+                                                                          const size_t endTile) {
+            const size_t endRow = std::min<size_t>(endTile * rowsPerTile, image.height);
+
+            generateRows(image, static_cast<unsigned int>(beginTile * rowsPerTile),
+                         static_cast<unsigned int>(endRow));
+        });
+
+        return true;
+    }
+
+    void ProceduralImage::generateRows(const ImageView &image,
+                                       const unsigned int beginRow,
+                                       const unsigned int endRow) const {
+        const size_t rowPitch = image.getRowPitch();
+
+        for (unsigned int y = beginRow; y < endRow; ++y) {
+            unsigned char *row = image.data + rowPitch * y;
+
+            for (const ProceduralLayer &layer : m_layers) {
+                switch (layer.type) {
+                    case ProceduralLayerType::Fill:
+                        fillSpan(row, 0, image.width, image.channels, layer.colors[0]);
+                        break;
+                    case ProceduralLayerType::Rectangle:
+                        if (static_cast<int64_t>(y) >= layer.y &&
+                            static_cast<int64_t>(y) < static_cast<int64_t>(layer.y) + layer.height) {
+                            fillClippedSpan(row, image,
+                                            RowSpan{ layer.x,
+                                                     static_cast<int64_t>(layer.x) + layer.width },
+                                            layer.colors[0]);
+                        }
+                        break;
+                    case ProceduralLayerType::Circle: {
+                        RowSpan span{};
+
+                        if (getCircleRowSpan(layer, y, span)) {
+                            fillClippedSpan(row, image, span, layer.colors[0]);
+                        }
+                        break;
+                    }
+                    case ProceduralLayerType::Checker: {
+                        const unsigned int cellRow = y / layer.height;
+
+                        for (unsigned int x = 0; x < image.width; x += layer.width) {
+                            const unsigned int parity = (x / layer.width + cellRow) & 1u;
+
+                            fillSpan(row, x, std::min(x + layer.width, image.width),
+                                     image.channels, layer.colors[parity]);
+                        }
+                        break;
+                    }
+                    case ProceduralLayerType::Noise:
+                        generateNoiseRow(row, image, layer, y);
+                        break;
+                }
+            }
+        }
+    }
+
+    void ProceduralImage::fillSpan(unsigned char *row, const unsigned int begin,
+                                   const unsigned int end, const unsigned int channels,
+                                   const ImageColor &color) {
+        if (begin >= end) {
+            return;
+        }
+
+        unsigned char *destination = row + static_cast<size_t>(begin) * channels;
+        size_t count = end - begin;
+
+        if (channels == 1) {
+            std::memset(destination, color.red, count);
+
+            return;
+        }
+
+        const unsigned char pixel[4] = { color.red, color.green, color.blue, color.alpha };
+
+#if defined(GAME_ENGINE_PROCEDURAL_SSE2)
+        if (channels == 4) {
+            uint32_t packedPixel = 0;
+            std::memcpy(&packedPixel, pixel, sizeof(packedPixel));
+
+            const __m128i pattern = _mm_set1_epi32(static_cast<int>(packedPixel));
+
+            for (; count >= 4; count -= 4, destination += 16) {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), pattern);
+            }
+        } else if (channels == 3 && count >= 16) {
+            alignas(16) unsigned char pattern[48];
+            for (size_t i = 0; i < 16; ++i) {
+                std::memcpy(pattern + 3 * i, pixel, 3);
+            }
+
+            const __m128i pattern0 = _mm_load_si128(reinterpret_cast<const __m128i*>(pattern));
+            const __m128i pattern1 = _mm_load_si128(reinterpret_cast<const __m128i*>(pattern + 16));
+            const __m128i pattern2 = _mm_load_si128(reinterpret_cast<const __m128i*>(pattern + 32));
+
+            for (; count >= 16; count -= 16, destination += 48) {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), pattern0);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 16), pattern1);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 32), pattern2);
+            }
+        }
+#endif
+
+        for (; count > 0; --count, destination += channels) {
+            std::memcpy(destination, pixel, channels);
+        }
+    }
+}
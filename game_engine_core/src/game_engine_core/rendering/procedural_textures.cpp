@@ -0,0 +1,67 @@
+#include "game_engine_core/rendering/procedural_textures.hpp"
+
+namespace game_engine {
+    void generateCircle(unsigned char *data,
+                        const unsigned int width,
+                        const unsigned int height,
+                        const unsigned int centerX,
+                        const unsigned int centerY,
+                        const unsigned int radius,
+                        const unsigned char colorRed,
+                        const unsigned char colorGreen,
+                        const unsigned char colorBlue) {
+        ProceduralImage image;
+        image.addCircle(static_cast<int>(centerX), static_cast<int>(centerY), radius,
+                        ImageColor{ colorRed, colorGreen, colorBlue });
+
+        image.generate(ImageView{ data, width, height, 3 });
+    }
+
+    void generateSmileTexture(unsigned char *data,
+                              const unsigned int width,
+                              const unsigned int height) {
+        generateSmileTexture(ImageView{ data, width, height, 3 });
+    }
+
+    void generateQuadsTexture(unsigned char *data,
+                              const unsigned int width,
+                              const unsigned int height) {
+        generateQuadsTexture(ImageView{ data, width, height, 3 });
+    }
+
+    bool generateSmileTexture(const ImageView &image) {
+        const auto scaleX = [&image](const double scale) {
+            return static_cast<int>(image.width * scale);
+        };
+        const auto scaleY = [&image](const double scale) {
+            return static_cast<int>(image.height * scale);
+        };
+
+        ProceduralImage smileImage;
+        smileImage.addFill(ImageColor{ 200, 191, 231 });
+
+        smileImage.addCircle(scaleX(0.5), scaleY(0.5), scaleX(0.4), ImageColor{ 255, 255, 0 });
+
+        smileImage.addCircle(scaleX(0.5), scaleY(0.4), scaleX(0.2), ImageColor{ 0, 0, 0 });
+        smileImage.addCircle(scaleX(0.5), scaleY(0.45), scaleX(0.2), ImageColor{ 255, 255, 0 });
+
+        smileImage.addCircle(scaleX(0.35), scaleY(0.6), scaleX(0.07), ImageColor{ 255, 0, 255 });
+        smileImage.addCircle(scaleX(0.65), scaleY(0.6), scaleX(0.07), ImageColor{ 0, 0, 255 });
+
+        return smileImage.generate(image);
+    }
+
+    bool generateQuadsTexture(const ImageView &image) {
+        const unsigned int halfWidth = image.width / 2;
+        const unsigned int halfHeight = image.height / 2;
+        const ImageColor black{ 0, 0, 0 };
+
+        ProceduralImage quadsImage;
+        quadsImage.addFill(ImageColor{ 255, 255, 255 });
+        quadsImage.addRectangle(0, 0, halfWidth, halfHeight, black);
+        quadsImage.addRectangle(static_cast<int>(halfWidth), static_cast<int>(halfHeight),
+                                image.width - halfWidth, image.height - halfHeight, black);
+
+        return quadsImage.generate(image);
+    }
+}
@@ -0,0 +1,245 @@
+#include "game_engine_core/rendering/render_thread.hpp"
+#include "game_engine_core/jobs/spsc_queue.hpp"
+#include "game_engine_core/window.hpp"
+#include "game_engine_core/log.hpp"
+#include "game_engine_core/profiler.hpp"
+
+#include <array>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace game_engine {
+    struct FramePacket {
+        std::vector<std::function<void()>> commands;
+    };
+
+    std::array<FramePacket, RenderThread::s_framesInFlightCount> framePackets;
+    SpscQueue<FramePacket*, RenderThread::s_framesInFlightCount> submittedPackets;
+    SpscQueue<FramePacket*, RenderThread::s_framesInFlightCount> freePackets;
+    std::vector<std::function<void()>> recordedCommands;
+
+    std::mutex packetsMutex;
+    std::condition_variable packetsCondition;
+
+    std::mutex foreignCommandsMutex;
+    std::vector<std::function<void()>> foreignCommands;
+
+    std::mutex pendingReleasesMutex;
+    std::vector<std::function<void()>> pendingReleases;
+    std::atomic<std::thread::id> contextThreadId;
+
+    std::thread renderThread;
+    std::thread::id ownerThreadId;
+    Window *renderWindow = nullptr;
+    std::atomic<bool> isRenderThreadRunning{false};
+    std::atomic<bool> isRenderThreadStopping{false};
+
+    thread_local bool isCurrentThreadRenderThread = false;
+
+    void notifyPackets() {
+        {
+            std::lock_guard<std::mutex> lock(packetsMutex);
+        }
+
+        packetsCondition.notify_all();
+    }
+
+    void runForeignCommands() {
+        std::vector<std::function<void()>> commands;
+        {
+            std::lock_guard<std::mutex> lock(foreignCommandsMutex);
+            commands.swap(foreignCommands);
+        }
+
+        for (const std::function<void()> &command : commands) {
+            command();
+        }
+    }
+
+    void runPendingReleases() {
+        if (std::this_thread::get_id() != contextThreadId.load()) {
+            return;
+        }
+
+        std::vector<std::function<void()>> releases;
+        {
+            std::lock_guard<std::mutex> lock(pendingReleasesMutex);
+            releases.swap(pendingReleases);
+        }
+
+        for (const std::function<void()> &release : releases) {
+            release();
+        }
+    }
+
+    void renderLoop() {
+        isCurrentThreadRenderThread = true;
+        renderWindow->makeContextCurrent();
+
+        PROFILE_THREAD("Render thread");
+
+        for (;;) {
+            FramePacket *packet = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(packetsMutex);
+                packetsCondition.wait(lock, [&packet]() {
+                    return submittedPackets.pop(packet) || isRenderThreadStopping.load();
+                });
+            }
+
+            if (packet == nullptr) {
+                break;
+            }
+
+            {
+                PROFILE_SCOPE("RenderThread::executePacket");
+
+                for (const std::function<void()> &command : packet->commands) {
+                    command();
+                }
+                packet->commands.clear();
+
+                runForeignCommands();
+            }
+
+            freePackets.push(packet);
+            notifyPackets();
+        }
+
+        runForeignCommands();
+
+        renderWindow->releaseContext();
+        isCurrentThreadRenderThread = false;
+    }
+
+    bool RenderThread::start(Window &window) {
+        if (isRenderThreadRunning.load()) {
+            LOG_CATEGORY_WARNING(Render, "RenderThread: already running");
+
+            return false;
+        }
+
+        FramePacket *packet = nullptr;
+        while (freePackets.pop(packet)) {
+        }
+
+        for (FramePacket &framePacket : framePackets) {
+            framePacket.commands.clear();
+            freePackets.push(&framePacket);
+        }
+
+        recordedCommands.clear();
+        runPendingReleases();
+        ownerThreadId = std::this_thread::get_id();
+        renderWindow = &window;
+
+        window.releaseContext();
+
+        isRenderThreadStopping = false;
+        isRenderThreadRunning = true;
+        renderThread = std::thread(renderLoop);
+
+        LOG_CATEGORY_INFO(Render, "RenderThread: started, up to {0} frames in flight", s_framesInFlightCount);
+
+        return true;
+    }
+
+    void RenderThread::stop() {
+        if (!isRenderThreadRunning.load()) {
+            return;
+        }
+
+        flush();
+
+        isRenderThreadStopping = true;
+        notifyPackets();
+        renderThread.join();
+
+        isRenderThreadRunning = false;
+        renderWindow->makeContextCurrent();
+        renderWindow = nullptr;
+
+        runForeignCommands();
+        runPendingReleases();
+    }
+
+    bool RenderThread::isRunning() {
+        return isRenderThreadRunning.load();
+    }
+
+    bool RenderThread::isRenderThread() {
+        return isCurrentThreadRenderThread;
+    }
+
+    void RenderThread::setContextThread() {
+        contextThreadId = std::this_thread::get_id();
+    }
+
+    void RenderThread::enqueue(std::function<void()> command) {
+        if (!isRenderThreadRunning.load() || isCurrentThreadRenderThread) {
+            command();
+
+            return;
+        }
+
+        if (std::this_thread::get_id() == ownerThreadId) {
+            recordedCommands.push_back(std::move(command));
+
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(foreignCommandsMutex);
+        foreignCommands.push_back(std::move(command));
+    }
+
+    void RenderThread::releaseResource(std::function<void()> release) {
+        if (isRenderThreadRunning.load() || std::this_thread::get_id() == contextThreadId.load()) {
+            enqueue(std::move(release));
+
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(pendingReleasesMutex);
+        pendingReleases.push_back(std::move(release));
+    }
+
+    void RenderThread::endFrame() {
+        if (!isRenderThreadRunning.load()) {
+            runPendingReleases();
+
+            return;
+        }
+
+        FramePacket *packet = nullptr;
+        {
+            PROFILE_SCOPE("RenderThread::waitFreePacket");
+
+            std::unique_lock<std::mutex> lock(packetsMutex);
+            packetsCondition.wait(lock, [&packet]() {
+                return freePackets.pop(packet);
+            });
+        }
+
+        packet->commands.swap(recordedCommands);
+        submittedPackets.push(packet);
+        notifyPackets();
+    }
+
+    void RenderThread::flush() {
+        if (!isRenderThreadRunning.load()) {
+            runPendingReleases();
+
+            return;
+        }
+
+        endFrame();
+
+        std::unique_lock<std::mutex> lock(packetsMutex);
+        packetsCondition.wait(lock, []() {
+            return freePackets.getSize() == s_framesInFlightCount;
+        });
+    }
+}
@@ -0,0 +1,824 @@
+#include "game_engine_core/rendering/texture_compression.hpp"
+#include "game_engine_core/jobs/job_system.hpp"
+#include "game_engine_core/profiler.hpp"
+#include "game_engine_core/log.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define GAME_ENGINE_COMPRESSION_SSE2
+    #include <emmintrin.h>
+#endif
+
+namespace game_engine {
+    namespace {
+        constexpr unsigned int s_blockPixelsCount = 16;
+        constexpr int s_bc7Weights[16] = { 0, 4, 9, 13, 17, 21, 26, 30,
+                                           34, 38, 43, 47, 51, 55, 60, 64 };
+
+        using BlockPixels = std::array<std::array<int, 4>, s_blockPixelsCount>;
+
+        struct BlockBitWriter {
+            uint64_t bits[2] = {};
+            unsigned int position = 0;
+
+            void write(const uint32_t value, const unsigned int bitsCount) {
+                for (unsigned int i = 0; i < bitsCount; ++i, ++position) {
+                    bits[position / 64] |= static_cast<uint64_t>((value >> i) & 1u) << (position % 64);
+                }
+            }
+
+            void store(unsigned char *output) const {
+                for (unsigned int i = 0; i < 16; ++i) {
+                    output[i] = static_cast<unsigned char>(bits[i / 8] >> (8 * (i % 8)));
+                }
+            }
+        };
+
+        struct BlockBitReader {
+            const unsigned char *data = nullptr;
+            unsigned int position = 0;
+
+            uint32_t read(const unsigned int bitsCount) {
+                uint32_t value = 0;
+
+                for (unsigned int i = 0; i < bitsCount; ++i, ++position) {
+                    const uint32_t bit = (data[position / 8] >> (position % 8)) & 1u;
+                    value |= bit << i;
+                }
+
+                return value;
+            }
+        };
+
+        const float *getSRGBToLinearTable() {
+            static const std::array<float, 256> table = []() {
+                std::array<float, 256> values{};
+
+                for (size_t i = 0; i < values.size(); ++i) {
+                    const float value = static_cast<float>(i) / 255.0f;
+                    values[i] = value <= 0.04045f ? value / 12.92f :
+                                std::pow((value + 0.055f) / 1.055f, 2.4f);
+                }
+
+                return values;
+            }();
+
+            return table.data();
+        }
+
+        unsigned char convertLinearToSRGB(const float value) {
+            const float srgb = value <= 0.0031308f ? value * 12.92f :
+                               1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+
+            return static_cast<unsigned char>(std::clamp(srgb * 255.0f + 0.5f, 0.0f, 255.0f));
+        }
+
+        uint16_t convertFloatToHalf(const float value) {
+            uint32_t bits = 0;
+            std::memcpy(&bits, &value, sizeof(bits));
+
+            const uint32_t sign = (bits >> 16) & 0x8000u;
+            const int exponent = static_cast<int>((bits >> 23) & 0xffu) - 127 + 15;
+            const uint32_t mantissa = bits & 0x7fffffu;
+
+            if (exponent <= 0) {
+                return static_cast<uint16_t>(sign);
+            }
+
+            if (exponent >= 31) {
+                return static_cast<uint16_t>(sign | 0x7c00u);
+            }
+
+            uint32_t half = sign | (static_cast<uint32_t>(exponent) << 10) | (mantissa >> 13);
+            if ((mantissa & 0x1000u) != 0) {
+                ++half;
+            }
+
+            return static_cast<uint16_t>(half);
+        }
+
+        void downsampleRowScalar(const unsigned char *row0, const unsigned char *row1,
+                                 unsigned char *destination, const unsigned int sourceWidth,
+                                 const unsigned int beginX, const unsigned int endX) {
+            for (unsigned int x = beginX; x < endX; ++x) {
+                const unsigned int x0 = std::min(2 * x, sourceWidth - 1);
+                const unsigned int x1 = std::min(2 * x + 1, sourceWidth - 1);
+
+                for (unsigned int channel = 0; channel < 4; ++channel) {
+                    const unsigned int sum = row0[4 * x0 + channel] + row0[4 * x1 + channel] +
+                                             row1[4 * x0 + channel] + row1[4 * x1 + channel];
+
+                    destination[4 * x + channel] = static_cast<unsigned char>((sum + 2) / 4);
+                }
+            }
+        }
+
+        unsigned int downsampleRowSIMD(const unsigned char *row0, const unsigned char *row1,
+                                       unsigned char *destination, const unsigned int sourceWidth,
+                                       const unsigned int destinationWidth) {
+            unsigned int x = 0;
+
+#if defined(GAME_ENGINE_COMPRESSION_SSE2)
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i rounding = _mm_set1_epi16(2);
+
+            for (; x + 2 <= destinationWidth && 2 * x + 4 <= sourceWidth; x += 2) {
+                const __m128i top = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + 8 * x));
+                const __m128i bottom = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + 8 * x));
+
+                const __m128i low = _mm_add_epi16(_mm_unpacklo_epi8(top, zero),
+                                                  _mm_unpacklo_epi8(bottom, zero));
+                const __m128i high = _mm_add_epi16(_mm_unpackhi_epi8(top, zero),
+                                                   _mm_unpackhi_epi8(bottom, zero));
+
+                __m128i sum = _mm_unpacklo_epi64(_mm_add_epi16(low, _mm_srli_si128(low, 8)),
+                                                 _mm_add_epi16(high, _mm_srli_si128(high, 8)));
+                sum = _mm_srli_epi16(_mm_add_epi16(sum, rounding), 2);
+
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(destination + 4 * x),
+                                 _mm_packus_epi16(sum, sum));
+            }
+#endif
+
+            return x;
+        }
+
+        void downsampleRowSRGB(const unsigned char *row0, const unsigned char *row1,
+                               unsigned char *destination, const unsigned int sourceWidth,
+                               const unsigned int destinationWidth) {
+            const float *toLinear = getSRGBToLinearTable();
+
+            for (unsigned int x = 0; x < destinationWidth; ++x) {
+                const unsigned int x0 = std::min(2 * x, sourceWidth - 1);
+                const unsigned int x1 = std::min(2 * x + 1, sourceWidth - 1);
+
+                for (unsigned int channel = 0; channel < 3; ++channel) {
+                    const float sum = toLinear[row0[4 * x0 + channel]] +
+                                      toLinear[row0[4 * x1 + channel]] +
+                                      toLinear[row1[4 * x0 + channel]] +
+                                      toLinear[row1[4 * x1 + channel]];
+
+                    destination[4 * x + channel] = convertLinearToSRGB(sum * 0.25f);
+                }
+
+                const unsigned int alphaSum = row0[4 * x0 + 3] + row0[4 * x1 + 3] +
+                                              row1[4 * x0 + 3] + row1[4 * x1 + 3];
+                destination[4 * x + 3] = static_cast<unsigned char>((alphaSum + 2) / 4);
+            }
+        }
+
+        void loadBlockPixels(const ImageView &source, const unsigned int blockX,
+                             const unsigned int blockY, BlockPixels &pixels) {
+            const size_t rowPitch = source.getRowPitch();
+
+            for (unsigned int y = 0; y < 4; ++y) {
+                const unsigned int sourceY = std::min(blockY * 4 + y, source.height - 1);
+                const unsigned char *row = source.data + rowPitch * sourceY;
+
+                for (unsigned int x = 0; x < 4; ++x) {
+                    const unsigned int sourceX = std::min(blockX * 4 + x, source.width - 1);
+
+                    for (unsigned int channel = 0; channel < 4; ++channel) {
+                        pixels[4 * y + x][channel] = row[4 * sourceX + channel];
+                    }
+                }
+            }
+        }
+
+        void findPrincipalEndpoints(const BlockPixels &pixels, const unsigned int channels,
+                                    std::array<float, 4> &endpoint0,
+                                    std::array<float, 4> &endpoint1) {
+            std::array<float, 4> mean{};
+            for (const std::array<int, 4> &pixel : pixels) {
+                for (unsigned int c = 0; c < channels; ++c) {
+                    mean[c] += static_cast<float>(pixel[c]) / s_blockPixelsCount;
+                }
+            }
+
+            float covariance[4][4] = {};
+            for (const std::array<int, 4> &pixel : pixels) {
+                for (unsigned int i = 0; i < channels; ++i) {
+                    for (unsigned int j = 0; j < channels; ++j) {
+                        covariance[i][j] += (pixel[i] - mean[i]) * (pixel[j] - mean[j]);
+                    }
+                }
+            }
+
+            std::array<float, 4> axis{ 1.0f, 1.0f, 1.0f, 1.0f };
+            for (int iteration = 0; iteration < 8; ++iteration) {
+                std::array<float, 4> next{};
+                float length = 0.0f;
+
+                for (unsigned int i = 0; i < channels; ++i) {
+                    for (unsigned int j = 0; j < channels; ++j) {
+                        next[i] += covariance[i][j] * axis[j];
+                    }
+                    length = std::max(length, std::fabs(next[i]));
+                }
+
+                if (length <= 0.0f) {
+                    break;
+                }
+
+                for (unsigned int i = 0; i < channels; ++i) {
+                    axis[i] = next[i] / length;
+                }
+            }
+
+            float axisLengthSquared = 0.0f;
+            for (unsigned int c = 0; c < channels; ++c) {
+                axisLengthSquared += axis[c] * axis[c];
+            }
+
+            float minimum = 0.0f;
+            float maximum = 0.0f;
+            for (const std::array<int, 4> &pixel : pixels) {
+                float projection = 0.0f;
+
+                for (unsigned int c = 0; c < channels; ++c) {
+                    projection += (pixel[c] - mean[c]) * axis[c];
+                }
+
+                minimum = std::min(minimum, projection);
+                maximum = std::max(maximum, projection);
+            }
+
+            for (unsigned int c = 0; c < 4; ++c) {
+                const float direction = axisLengthSquared > 0.0f && c < channels ?
+                                        axis[c] / axisLengthSquared : 0.0f;
+
+                endpoint0[c] = std::clamp(mean[c] + direction * maximum, 0.0f, 255.0f);
+                endpoint1[c] = std::clamp(mean[c] + direction * minimum, 0.0f, 255.0f);
+            }
+        }
+
+        uint16_t packColor565(const std::array<float, 4> &color) {
+            const auto red = static_cast<uint16_t>(std::lround(color[0] * 31.0f / 255.0f));
+            const auto green = static_cast<uint16_t>(std::lround(color[1] * 63.0f / 255.0f));
+            const auto blue = static_cast<uint16_t>(std::lround(color[2] * 31.0f / 255.0f));
+
+            return static_cast<uint16_t>((red << 11) | (green << 5) | blue);
+        }
+
+        std::array<int, 3> unpackColor565(const uint16_t color) {
+            const int red = (color >> 11) & 31;
+            const int green = (color >> 5) & 63;
+            const int blue = color & 31;
+
+            return { (red << 3) | (red >> 2), (green << 2) | (green >> 4), (blue << 3) | (blue >> 2) };
+        }
+
+        void encodeBlockBC1(const BlockPixels &pixels, unsigned char *output) {
+            std::array<float, 4> endpoint0{};
+            std::array<float, 4> endpoint1{};
+            findPrincipalEndpoints(pixels, 3, endpoint0, endpoint1);
+
+            uint16_t color0 = packColor565(endpoint0);
+            uint16_t color1 = packColor565(endpoint1);
+            if (color0 < color1) {
+                std::swap(color0, color1);
+            }
+
+            uint32_t indices = 0;
+
+            if (color0 != color1) {
+                const std::array<int, 3> decoded0 = unpackColor565(color0);
+                const std::array<int, 3> decoded1 = unpackColor565(color1);
+                std::array<std::array<int, 3>, 4> palette{ decoded0, decoded1 };
+
+                for (int c = 0; c < 3; ++c) {
+                    palette[2][c] = (2 * decoded0[c] + decoded1[c]) / 3;
+                    palette[3][c] = (decoded0[c] + 2 * decoded1[c]) / 3;
+                }
+
+                for (unsigned int i = 0; i < s_blockPixelsCount; ++i) {
+                    int bestError = INT32_MAX;
+                    uint32_t bestIndex = 0;
+
+                    for (uint32_t index = 0; index < 4; ++index) {
+                        int error = 0;
+                        for (int c = 0; c < 3; ++c) {
+                            const int delta = pixels[i][c] - palette[index][c];
+                            error += delta * delta;
+                        }
+
+                        if (error < bestError) {
+                            bestError = error;
+                            bestIndex = index;
+                        }
+                    }
+
+                    indices |= bestIndex << (2 * i);
+                }
+            }
+
+            output[0] = static_cast<unsigned char>(color0);
+            output[1] = static_cast<unsigned char>(color0 >> 8);
+            output[2] = static_cast<unsigned char>(color1);
+            output[3] = static_cast<unsigned char>(color1 >> 8);
+            for (int i = 0; i < 4; ++i) {
+                output[4 + i] = static_cast<unsigned char>(indices >> (8 * i));
+            }
+        }
+
+        void encodeBlockBC4(const BlockPixels &pixels, const unsigned int channel,
+                            unsigned char *output) {
+            int minimum = 255;
+            int maximum = 0;
+            for (const std::array<int, 4> &pixel : pixels) {
+                minimum = std::min(minimum, pixel[channel]);
+                maximum = std::max(maximum, pixel[channel]);
+            }
+
+            output[0] = static_cast<unsigned char>(maximum);
+            output[1] = static_cast<unsigned char>(minimum);
+
+            std::array<int, 8> palette{ maximum, minimum };
+            for (int i = 2; i < 8; ++i) {
+                palette[i] = ((8 - i) * maximum + (i - 1) * minimum) / 7;
+            }
+
+            uint64_t indices = 0;
+
+            if (maximum != minimum) {
+                for (unsigned int i = 0; i < s_blockPixelsCount; ++i) {
+                    int bestError = INT32_MAX;
+                    uint64_t bestIndex = 0;
+
+                    for (uint64_t index = 0; index < palette.size(); ++index) {
+                        const int error = std::abs(pixels[i][channel] - palette[index]);
+
+                        if (error < bestError) {
+                            bestError = error;
+                            bestIndex = index;
+                        }
+                    }
+
+                    indices |= bestIndex << (3 * i);
+                }
+            }
+
+            for (int i = 0; i < 6; ++i) {
+                output[2 + i] = static_cast<unsigned char>(indices >> (8 * i));
+            }
+        }
+
+        void quantizeEndpointBC7(const std::array<float, 4> &endpoint,
+                                 std::array<int, 4> &quantized, int &pBit) {
+            float bestError = -1.0f;
+
+            for (int candidate = 0; candidate < 2; ++candidate) {
+                std::array<int, 4> values{};
+                float error = 0.0f;
+
+                for (int c = 0; c < 4; ++c) {
+                    values[c] = std::clamp(static_cast<int>(std::lround((endpoint[c] - candidate) * 0.5f)),
+                                           0, 127);
+
+                    const float delta = static_cast<float>((values[c] << 1) | candidate) - endpoint[c];
+                    error += delta * delta;
+                }
+
+                if (bestError < 0.0f || error < bestError) {
+                    bestError = error;
+                    quantized = values;
+                    pBit = candidate;
+                }
+            }
+        }
+
+        void encodeBlockBC7(const BlockPixels &pixels, unsigned char *output) {
+            std::array<float, 4> endpoint0{};
+            std::array<float, 4> endpoint1{};
+            findPrincipalEndpoints(pixels, 4, endpoint0, endpoint1);
+
+            std::array<std::array<int, 4>, 2> quantized{};
+            std::array<int, 2> pBits{};
+            quantizeEndpointBC7(endpoint0, quantized[0], pBits[0]);
+            quantizeEndpointBC7(endpoint1, quantized[1], pBits[1]);
+
+            std::array<std::array<int, 4>, 16> palette{};
+            for (int index = 0; index < 16; ++index) {
+                for (int c = 0; c < 4; ++c) {
+                    const int value0 = (quantized[0][c] << 1) | pBits[0];
+                    const int value1 = (quantized[1][c] << 1) | pBits[1];
+
+                    palette[index][c] = ((64 - s_bc7Weights[index]) * value0 +
+                                         s_bc7Weights[index] * value1 + 32) >> 6;
+                }
+            }
+
+            std::array<uint32_t, s_blockPixelsCount> indices{};
+            for (unsigned int i = 0; i < s_blockPixelsCount; ++i) {
+                int bestError = INT32_MAX;
+
+                for (uint32_t index = 0; index < 16; ++index) {
+                    int error = 0;
+                    for (int c = 0; c < 4; ++c) {
+                        const int delta = pixels[i][c] - palette[index][c];
+                        error += delta * delta;
+                    }
+
+                    if (error < bestError) {
+                        bestError = error;
+                        indices[i] = index;
+                    }
+                }
+            }
+
+            if (indices[0] >= 8) {
+                std::swap(quantized[0], quantized[1]);
+                std::swap(pBits[0], pBits[1]);
+
+                for (uint32_t &index : indices) {
+                    index = 15 - index;
+                }
+            }
+
+            BlockBitWriter writer;
+            writer.write(1u << 6, 7);
+
+            for (int c = 0; c < 4; ++c) {
+                writer.write(static_cast<uint32_t>(quantized[0][c]), 7);
+                writer.write(static_cast<uint32_t>(quantized[1][c]), 7);
+            }
+
+            writer.write(static_cast<uint32_t>(pBits[0]), 1);
+            writer.write(static_cast<uint32_t>(pBits[1]), 1);
+
+            for (unsigned int i = 0; i < s_blockPixelsCount; ++i) {
+                writer.write(indices[i], i == 0 ? 3 : 4);
+            }
+
+            writer.store(output);
+        }
+
+        void encodeBlock(const BlockPixels &pixels, const TextureFormat format,
+                         unsigned char *output) {
+            switch (format) {
+                case TextureFormat::BC1:
+                case TextureFormat::BC1_SRGB:
+                    encodeBlockBC1(pixels, output);
+                    break;
+                case TextureFormat::BC3:
+                case TextureFormat::BC3_SRGB:
+                    encodeBlockBC4(pixels, 3, output);
+                    encodeBlockBC1(pixels, output + 8);
+                    break;
+                case TextureFormat::BC4:
+                    encodeBlockBC4(pixels, 0, output);
+                    break;
+                case TextureFormat::BC5:
+                    encodeBlockBC4(pixels, 0, output);
+                    encodeBlockBC4(pixels, 1, output + 8);
+                    break;
+                default:
+                    encodeBlockBC7(pixels, output);
+                    break;
+            }
+        }
+
+        void decodeBlockBC1(const unsigned char *input, const bool hasAlphaMode,
+                            BlockPixels &pixels) {
+            const uint16_t color0 = static_cast<uint16_t>(input[0] | (input[1] << 8));
+            const uint16_t color1 = static_cast<uint16_t>(input[2] | (input[3] << 8));
+            const std::array<int, 3> decoded0 = unpackColor565(color0);
+            const std::array<int, 3> decoded1 = unpackColor565(color1);
+
+            std::array<std::array<int, 4>, 4> palette{};
+            for (int c = 0; c < 3; ++c) {
+                palette[0][c] = decoded0[c];
+                palette[1][c] = decoded1[c];
+
+                if (color0 > color1 || !hasAlphaMode) {
+                    palette[2][c] = (2 * decoded0[c] + decoded1[c]) / 3;
+                    palette[3][c] = (decoded0[c] + 2 * decoded1[c]) / 3;
+                } else {
+                    palette[2][c] = (decoded0[c] + decoded1[c]) / 2;
+                }
+            }
+
+            palette[0][3] = palette[1][3] = palette[2][3] = 255;
+            palette[3][3] = color0 > color1 || !hasAlphaMode ? 255 : 0;
+
+            const uint32_t indices = static_cast<uint32_t>(input[4]) |
+                                     static_cast<uint32_t>(input[5]) << 8 |
+                                     static_cast<uint32_t>(input[6]) << 16 |
+                                     static_cast<uint32_t>(input[7]) << 24;
+
+            for (unsigned int i = 0; i < s_blockPixelsCount; ++i) {
+                pixels[i] = palette[(indices >> (2 * i)) & 3u];
+            }
+        }
+
+        void decodeBlockBC4(const unsigned char *input, const unsigned int channel,
+                            BlockPixels &pixels) {
+            const int value0 = input[0];
+            const int value1 = input[1];
+
+            std::array<int, 8> palette{ value0, value1 };
+            if (value0 > value1) {
+                for (int i = 2; i < 8; ++i) {
+                    palette[i] = ((8 - i) * value0 + (i - 1) * value1) / 7;
+                }
+            } else {
+                for (int i = 2; i < 6; ++i) {
+                    palette[i] = ((6 - i) * value0 + (i - 1) * value1) / 5;
+                }
+
+                palette[6] = 0;
+                palette[7] = 255;
+            }
+
+            uint64_t indices = 0;
+            for (int i = 0; i < 6; ++i) {
+                indices |= static_cast<uint64_t>(input[2 + i]) << (8 * i);
+            }
+
+            for (unsigned int i = 0; i < s_blockPixelsCount; ++i) {
+                pixels[i][channel] = palette[(indices >> (3 * i)) & 7u];
+            }
+        }
+
+        bool decodeBlockBC7(const unsigned char *input, BlockPixels &pixels) {
+            BlockBitReader reader{ input };
+
+            unsigned int mode = 0;
+            while (mode < 8 && reader.read(1) == 0) {
+                ++mode;
+            }
+
+            if (mode != 6) {
+                LOG_CATEGORY_ERROR(Render, "TextureCompression: BC7 mode {0} can't be decoded",
+                                   mode);
+
+                return false;
+            }
+
+            std::array<std::array<int, 4>, 2> endpoints{};
+            for (int c = 0; c < 4; ++c) {
+                endpoints[0][c] = static_cast<int>(reader.read(7)) << 1;
+                endpoints[1][c] = static_cast<int>(reader.read(7)) << 1;
+            }
+
+            for (std::array<int, 4> &endpoint : endpoints) {
+                const int pBit = static_cast<int>(reader.read(1));
+
+                for (int &value : endpoint) {
+                    value |= pBit;
+                }
+            }
+
+            for (unsigned int i = 0; i < s_blockPixelsCount; ++i) {
+                const int weight = s_bc7Weights[reader.read(i == 0 ? 3 : 4)];
+
+                for (int c = 0; c < 4; ++c) {
+                    pixels[i][c] = ((64 - weight) * endpoints[0][c] +
+                                    weight * endpoints[1][c] + 32) >> 6;
+                }
+            }
+
+            return true;
+        }
+
+        bool decodeBlock(const unsigned char *input, const TextureFormat format,
+                         BlockPixels &pixels) {
+            for (std::array<int, 4> &pixel : pixels) {
+                pixel = { 0, 0, 0, 255 };
+            }
+
+            switch (format) {
+                case TextureFormat::BC1:
+                case TextureFormat::BC1_SRGB:
+                    decodeBlockBC1(input, true, pixels);
+                    return true;
+                case TextureFormat::BC3:
+                case TextureFormat::BC3_SRGB:
+                    decodeBlockBC1(input + 8, false, pixels);
+                    decodeBlockBC4(input, 3, pixels);
+                    return true;
+                case TextureFormat::BC4:
+                    decodeBlockBC4(input, 0, pixels);
+                    return true;
+                case TextureFormat::BC5:
+                    decodeBlockBC4(input, 0, pixels);
+                    decodeBlockBC4(input + 8, 1, pixels);
+                    return true;
+                default:
+                    return decodeBlockBC7(input, pixels);
+            }
+        }
+
+        void convertTexelsRow(const unsigned char *source, unsigned char *destination,
+                              const unsigned int width, const TextureFormat format) {
+            const TextureFormatInfo &info = getTextureFormatInfo(format);
+
+            if (format == TextureFormat::RGBA16F) {
+                for (unsigned int i = 0; i < width * 4; ++i) {
+                    const uint16_t half = convertFloatToHalf(static_cast<float>(source[i]) / 255.0f);
+                    std::memcpy(destination + 2 * i, &half, sizeof(half));
+                }
+
+                return;
+            }
+
+            for (unsigned int x = 0; x < width; ++x) {
+                std::memcpy(destination + x * info.channels, source + 4 * x, info.channels);
+            }
+        }
+    }
+
+    bool downsampleTextureLevel(const ImageView &source, const ImageView &destination,
+                                const bool isSRGB) {
+        if (source.channels != 4 || destination.channels != 4 ||
+            destination.width != std::max(source.width / 2, 1u) ||
+            destination.height != std::max(source.height / 2, 1u)) {
+            LOG_CATEGORY_ERROR(Render, "TextureCompression: can't downsample {0}x{1} into {2}x{3}",
+                               source.width, source.height, destination.width, destination.height);
+
+            return false;
+        }
+
+        const size_t sourcePitch = source.getRowPitch();
+        const size_t destinationPitch = destination.getRowPitch();
+
+        JobSystem::parallelFor(destination.height, 16, [&](const size_t begin, const size_t end) {
+            for (size_t y = begin; y < end; ++y) {
+                const unsigned char *row0 = source.data +
+                    sourcePitch * std::min<size_t>(2 * y, source.height - 1);
+                const unsigned char *row1 = source.data +
+                    sourcePitch * std::min<size_t>(2 * y + 1, source.height - 1);
+                unsigned char *destinationRow = destination.data + destinationPitch * y;
+
+                if (isSRGB) {
+                    downsampleRowSRGB(row0, row1, destinationRow, source.width, destination.width);
+                } else {
+                    const unsigned int simdEnd = downsampleRowSIMD(row0, row1, destinationRow,
+                                                                   source.width, destination.width);
+                    downsampleRowScalar(row0, row1, destinationRow, source.width, simdEnd,
+                                        destination.width);
+                }
+            }
+        });
+
+        return true;
+    }
+
+    bool encodeTextureLevel(const ImageView &source, const TextureFormat format,
+                            std::vector<unsigned char> &output) {
+        PROFILE_SCOPE("encodeTextureLevel");
+
+        if (source.channels != 4 || source.data == nullptr ||
+            format >= TextureFormat::FormatsCount) {
+            LOG_CATEGORY_ERROR(Render, "TextureCompression: can't encode {0}x{1} image with {2} channels",
+                               source.width, source.height, source.channels);
+
+            return false;
+        }
+
+        const TextureFormatInfo &info = getTextureFormatInfo(format);
+        output.resize(calculateTextureLevelSize(format, source.width, source.height));
+
+        if (!info.isCompressed) {
+            const size_t destinationPitch = static_cast<size_t>(source.width) * info.bytesPerBlock;
+
+            for (unsigned int y = 0; y < source.height; ++y) {
+                convertTexelsRow(source.data + source.getRowPitch() * y,
+                                 output.data() + destinationPitch * y, source.width, format);
+            }
+
+            return true;
+        }
+
+        const unsigned int blocksX = (source.width + 3) / 4;
+        const unsigned int blocksY = (source.height + 3) / 4;
+
+        JobSystem::parallelFor(blocksY, 4, [&](const size_t begin, const size_t end) {
+            BlockPixels pixels{};
+
+            for (size_t blockY = begin; blockY < end; ++blockY) {
+                for (unsigned int blockX = 0; blockX < blocksX; ++blockX) {
+                    loadBlockPixels(source, blockX, static_cast<unsigned int>(blockY), pixels);
+                    encodeBlock(pixels, format, output.data() +
+                                (blockY * blocksX + blockX) * info.bytesPerBlock);
+                }
+            }
+        });
+
+        return true;
+    }
+
+    bool cookTexture(const ImageView &source, const TextureFormat format,
+                     const bool generateMipmaps, TextureContainer &container) {
+        PROFILE_SCOPE("cookTexture");
+
+        if (source.channels != 4 || source.width == 0 || source.height == 0) {
+            LOG_CATEGORY_ERROR(Render, "TextureCompression: cooking needs an RGBA8 source");
+
+            return false;
+        }
+
+        const bool isSRGB = getTextureFormatInfo(format).isSRGB;
+        const unsigned int levelsCount = generateMipmaps ?
+            calculateMipLevelsCount(source.width, source.height) : 1;
+
+        container.reset(format, source.width, source.height);
+
+        std::vector<unsigned char> levelPixels;
+        std::vector<unsigned char> nextLevelPixels;
+        ImageView level = source;
+
+        for (unsigned int i = 0; i < levelsCount; ++i) {
+            std::vector<unsigned char> encoded;
+
+            if (!encodeTextureLevel(level, format, encoded) ||
+                !container.addLevel(std::move(encoded))) {
+                return false;
+            }
+
+            if (i + 1 == levelsCount) {
+                break;
+            }
+
+            const unsigned int nextWidth = std::max(level.width / 2, 1u);
+            const unsigned int nextHeight = std::max(level.height / 2, 1u);
+            nextLevelPixels.resize(static_cast<size_t>(nextWidth) * nextHeight * 4);
+
+            const ImageView nextLevel{ nextLevelPixels.data(), nextWidth, nextHeight, 4 };
+            if (!downsampleTextureLevel(level, nextLevel, isSRGB)) {
+                return false;
+            }
+
+            levelPixels.swap(nextLevelPixels);
+            level = ImageView{ levelPixels.data(), nextWidth, nextHeight, 4 };
+        }
+
+        return true;
+    }
+
+    bool decodeTextureLevel(const TextureLevel &level, const TextureFormat format,
+                            const ImageView &destination) {
+        const TextureFormatInfo &info = getTextureFormatInfo(format);
+
+        if (destination.channels != 4 || destination.width != level.width ||
+            destination.height != level.height || format == TextureFormat::RGBA16F ||
+            level.data.size() != calculateTextureLevelSize(format, level.width, level.height)) {
+            LOG_CATEGORY_ERROR(Render, "TextureCompression: can't decode {0} level {1}x{2}",
+                               info.name, level.width, level.height);
+
+            return false;
+        }
+
+        const size_t rowPitch = destination.getRowPitch();
+
+        if (!info.isCompressed) {
+            for (unsigned int y = 0; y < level.height; ++y) {
+                for (unsigned int x = 0; x < level.width; ++x) {
+                    const unsigned char *texel = level.data.data() +
+                        (static_cast<size_t>(y) * level.width + x) * info.channels;
+                    unsigned char *pixel = destination.data + rowPitch * y + 4 * x;
+
+                    for (unsigned int channel = 0; channel < 4; ++channel) {
+                        pixel[channel] = channel < info.channels ? texel[channel] :
+                                         channel == 3 ? 255 : 0;
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        const unsigned int blocksX = (level.width + 3) / 4;
+        const unsigned int blocksY = (level.height + 3) / 4;
+        BlockPixels pixels{};
+
+        for (unsigned int blockY = 0; blockY < blocksY; ++blockY) {
+            for (unsigned int blockX = 0; blockX < blocksX; ++blockX) {
+                const size_t blockOffset = (static_cast<size_t>(blockY) * blocksX + blockX) *
+                                           info.bytesPerBlock;
+
+                if (!decodeBlock(level.data.data() + blockOffset, format, pixels)) {
+                    return false;
+                }
+
+                for (unsigned int y = 0; y < 4 && blockY * 4 + y < level.height; ++y) {
+                    for (unsigned int x = 0; x < 4 && blockX * 4 + x < level.width; ++x) {
+                        unsigned char *pixel = destination.data + rowPitch * (blockY * 4 + y) +
+                                               4 * (blockX * 4 + x);
+
+                        for (unsigned int channel = 0; channel < 4; ++channel) {
+                            pixel[channel] = static_cast<unsigned char>(pixels[4 * y + x][channel]);
+                        }
+                    }
+                }
+            }
+        }
+
+        return true;
+    }
+}
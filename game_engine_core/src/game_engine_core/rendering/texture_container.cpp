@@ -0,0 +1,206 @@
+#include "game_engine_core/rendering/texture_container.hpp"
+#include "game_engine_core/log.hpp"
+
+#include <algorithm>
+#include <fstream>
+
+namespace game_engine {
+    struct TextureContainerFileHeader {
+        uint32_t magic = 0;
+        uint32_t version = 0;
+        uint32_t format = 0;
+        uint32_t width = 0;
+        uint32_t height = 0;
+        uint32_t levelsCount = 0;
+    };
+
+    struct TextureContainerLevelIndex {
+        uint64_t offset = 0;
+        uint64_t size = 0;
+    };
+
+    template<typename T>
+    void writeTextureContainerValue(std::ofstream &file, const T &value) {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template<typename T>
+    bool readTextureContainerValue(std::ifstream &file, T &value) {
+        return static_cast<bool>(file.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+
+    size_t alignTextureContainerOffset(const size_t offset) {
+        return (offset + TextureContainer::s_levelAlignment - 1) /
+               TextureContainer::s_levelAlignment * TextureContainer::s_levelAlignment;
+    }
+
+    void TextureContainer::reset(const TextureFormat format,
+                                 const unsigned int width, const unsigned int height) {
+        m_format = format;
+        m_width = width;
+        m_height = height;
+        m_levels.clear();
+    }
+
+    bool TextureContainer::addLevel(std::vector<unsigned char> data) {
+        const unsigned int level = static_cast<unsigned int>(m_levels.size());
+        const unsigned int width = std::max(m_width >> std::min(level, 31u), 1u);
+        const unsigned int height = std::max(m_height >> std::min(level, 31u), 1u);
+        const size_t expectedSize = calculateTextureLevelSize(m_format, width, height);
+
+        if (level >= calculateMipLevelsCount(m_width, m_height) || data.size() != expectedSize) {
+            LOG_CATEGORY_ERROR(Render, "TextureContainer: level {0} has {1} bytes, expected {2}",
+                               level, data.size(), expectedSize);
+
+            return false;
+        }
+
+        m_levels.push_back(TextureLevel{ width, height, std::move(data) });
+
+        return true;
+    }
+
+    size_t TextureContainer::getDataSize() const {
+        size_t dataSize = 0;
+
+        for (const TextureLevel &level : m_levels) {
+            dataSize += level.data.size();
+        }
+
+        return dataSize;
+    }
+
+    bool TextureContainer::save(const std::string &path) const {
+        std::ofstream file(path, std::ios::binary);
+
+        if (!file) {
+            LOG_CATEGORY_ERROR(Render, "TextureContainer: can't open {0} for writing", path);
+
+            return false;
+        }
+
+        writeTextureContainerValue(file, s_fileMagic);
+        writeTextureContainerValue(file, s_fileVersion);
+        writeTextureContainerValue(file, static_cast<uint32_t>(m_format));
+        writeTextureContainerValue(file, static_cast<uint32_t>(m_width));
+        writeTextureContainerValue(file, static_cast<uint32_t>(m_height));
+        writeTextureContainerValue(file, static_cast<uint32_t>(m_levels.size()));
+
+        size_t offset = alignTextureContainerOffset(sizeof(TextureContainerFileHeader) +
+                                                    sizeof(TextureContainerLevelIndex) *
+                                                    m_levels.size());
+
+        for (const TextureLevel &level : m_levels) {
+            writeTextureContainerValue(file, static_cast<uint64_t>(offset));
+            writeTextureContainerValue(file, static_cast<uint64_t>(level.data.size()));
+
+            offset = alignTextureContainerOffset(offset + level.data.size());
+        }
+
+        for (const TextureLevel &level : m_levels) {
+            const size_t position = static_cast<size_t>(file.tellp());
+            const size_t padding = alignTextureContainerOffset(position) - position;
+            const char zeros[s_levelAlignment] = {};
+
+            file.write(zeros, static_cast<std::streamsize>(padding));
+            file.write(reinterpret_cast<const char*>(level.data.data()),
+                       static_cast<std::streamsize>(level.data.size()));
+        }
+
+        LOG_CATEGORY_INFO(Render, "TextureContainer: saved {0}x{1} {2} with {3} levels to {4}",
+                          m_width, m_height, getTextureFormatInfo(m_format).name,
+                          m_levels.size(), path);
+
+        return static_cast<bool>(file);
+    }
+
+    bool TextureContainer::load(const std::string &path) {
+        std::ifstream file(path, std::ios::binary);
+
+        if (!file) {
+            LOG_CATEGORY_ERROR(Render, "TextureContainer: can't open {0}", path);
+
+            return false;
+        }
+
+        TextureContainerFileHeader header;
+        if (!readTextureContainerValue(file, header.magic) ||
+            !readTextureContainerValue(file, header.version) ||
+            header.magic != s_fileMagic || header.version != s_fileVersion) {
+            LOG_CATEGORY_ERROR(Render, "TextureContainer: {0} is not a supported texture", path);
+
+            return false;
+        }
+
+        readTextureContainerValue(file, header.format);
+        readTextureContainerValue(file, header.width);
+        readTextureContainerValue(file, header.height);
+        readTextureContainerValue(file, header.levelsCount);
+
+        if (!file || header.format >= static_cast<uint32_t>(TextureFormat::FormatsCount) ||
+            header.width == 0 || header.height == 0 || header.levelsCount == 0 ||
+            header.levelsCount > calculateMipLevelsCount(header.width, header.height)) {
+            LOG_CATEGORY_ERROR(Render, "TextureContainer: {0} has an invalid header", path);
+
+            return false;
+        }
+
+        const std::streamoff indicesOffset = file.tellg();
+        file.seekg(0, std::ios::end);
+        const uint64_t fileSize = static_cast<uint64_t>(file.tellg());
+        file.seekg(indicesOffset);
+
+        std::vector<TextureContainerLevelIndex> levelIndices(header.levelsCount);
+
+        for (TextureContainerLevelIndex &levelIndex : levelIndices) {
+            readTextureContainerValue(file, levelIndex.offset);
+            readTextureContainerValue(file, levelIndex.size);
+        }
+
+        if (!file) {
+            LOG_CATEGORY_ERROR(Render, "TextureContainer: {0} is truncated or corrupted", path);
+
+            return false;
+        }
+
+        const TextureFormat format = static_cast<TextureFormat>(header.format);
+
+        for (unsigned int level = 0; level < levelIndices.size(); ++level) {
+            const TextureContainerLevelIndex &levelIndex = levelIndices[level];
+            const unsigned int width = std::max(header.width >> std::min(level, 31u), 1u);
+            const unsigned int height = std::max(header.height >> std::min(level, 31u), 1u);
+
+            if (levelIndex.size != calculateTextureLevelSize(format, width, height) ||
+                levelIndex.offset > fileSize || levelIndex.size > fileSize - levelIndex.offset) {
+                LOG_CATEGORY_ERROR(Render, "TextureContainer: {0} has an invalid level {1}",
+                                   path, level);
+
+                return false;
+            }
+        }
+
+        TextureContainer container;
+        container.reset(format, header.width, header.height);
+
+        for (const TextureContainerLevelIndex &levelIndex : levelIndices) {
+            std::vector<unsigned char> data(static_cast<size_t>(levelIndex.size));
+
+            file.seekg(static_cast<std::streamoff>(levelIndex.offset));
+            file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()));
+
+            if (!file || !container.addLevel(std::move(data))) {
+                LOG_CATEGORY_ERROR(Render, "TextureContainer: {0} is truncated or corrupted", path);
+
+                return false;
+            }
+        }
+
+        *this = std::move(container);
+
+        LOG_CATEGORY_INFO(Render, "TextureContainer: loaded {0}x{1} {2} with {3} levels from {4}",
+                          m_width, m_height, getTextureFormatInfo(m_format).name,
+                          m_levels.size(), path);
+
+        return true;
+    }
+}
@@ -0,0 +1,76 @@
+#include "game_engine_core/rendering/texture_format.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace game_engine {
+    constexpr TextureFormatInfo s_textureFormatInfos[] = {
+        { "r8",           1, 1,  1, false, false },
+        { "rg8",          1, 2,  2, false, false },
+        { "rgb8",         1, 3,  3, false, false },
+        { "rgba8",        1, 4,  4, false, false },
+        { "srgb8_alpha8", 1, 4,  4, false, true  },
+        { "rgba16f",      1, 8,  4, false, false },
+        { "bc1",          4, 8,  3, true,  false },
+        { "bc1_srgb",     4, 8,  3, true,  true  },
+        { "bc3",          4, 16, 4, true,  false },
+        { "bc3_srgb",     4, 16, 4, true,  true  },
+        { "bc4",          4, 8,  1, true,  false },
+        { "bc5",          4, 16, 2, true,  false },
+        { "bc7",          4, 16, 4, true,  false },
+        { "bc7_srgb",     4, 16, 4, true,  true  }
+    };
+
+    static_assert(sizeof(s_textureFormatInfos) / sizeof(s_textureFormatInfos[0]) ==
+                  static_cast<size_t>(TextureFormat::FormatsCount));
+
+    const TextureFormatInfo &getTextureFormatInfo(const TextureFormat format) {
+        return s_textureFormatInfos[std::min(static_cast<size_t>(format),
+                                             static_cast<size_t>(TextureFormat::FormatsCount) - 1)];
+    }
+
+    bool findTextureFormat(const char *name, TextureFormat &format) {
+        for (size_t i = 0; i < static_cast<size_t>(TextureFormat::FormatsCount); ++i) {
+            if (std::strcmp(s_textureFormatInfos[i].name, name) == 0) {
+                format = static_cast<TextureFormat>(i);
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    unsigned int calculateMipLevelsCount(const unsigned int width, const unsigned int height) {
+        unsigned int levelsCount = 1;
+
+        for (unsigned int size = std::max(width, height); size > 1; size /= 2) {
+            ++levelsCount;
+        }
+
+        return levelsCount;
+    }
+
+    size_t calculateTextureLevelSize(const TextureFormat format,
+                                     const unsigned int width, const unsigned int height) {
+        const TextureFormatInfo &info = getTextureFormatInfo(format);
+        const size_t blocksX = (static_cast<size_t>(width) + info.blockSize - 1) / info.blockSize;
+        const size_t blocksY = (static_cast<size_t>(height) + info.blockSize - 1) / info.blockSize;
+
+        return blocksX * blocksY * info.bytesPerBlock;
+    }
+
+    size_t calculateTextureMemorySize(const TextureFormat format,
+                                      unsigned int width, unsigned int height,
+                                      const unsigned int levelsCount) {
+        size_t memorySize = 0;
+
+        for (unsigned int level = 0; level < levelsCount; ++level) {
+            memorySize += calculateTextureLevelSize(format, width, height);
+            width = std::max(width / 2, 1u);
+            height = std::max(height / 2, 1u);
+        }
+
+        return memorySize;
+    }
+}
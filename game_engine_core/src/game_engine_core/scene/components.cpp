@@ -0,0 +1,51 @@
+#include "game_engine_core/scene/components.hpp"
+
+#include "glm/trigonometric.hpp"
+
+#include <cmath>
+
+namespace game_engine {
+    glm::mat4 TransformComponent::getModelMatrix() const {
+        const glm::mat4 scaleMatrix(scale.x, 0, 0, 0,
+                                    0, scale.y, 0, 0,
+                                    0, 0, scale.z, 0,
+                                    0, 0, 0, 1);
+
+        const float rollInRadians = glm::radians(rotation.x);
+        const float pitchInRadians = glm::radians(rotation.y);
+        const float yawInRadians = glm::radians(rotation.z);
+
+        const glm::mat4 rotateMatrixX(1, 0, 0, 0,
+                                      0, cos(rollInRadians), sin(rollInRadians), 0,
+                                      0, -sin(rollInRadians), cos(rollInRadians), 0,
+                                      0, 0, 0, 1);
+
+        const glm::mat4 rotateMatrixY(cos(pitchInRadians), 0, -sin(pitchInRadians), 0,
+                                      0, 1, 0, 0,
+                                      sin(pitchInRadians), 0, cos(pitchInRadians), 0,
+                                      0, 0, 0, 1);
+
+        const glm::mat4 rotateMatrixZ(cos(yawInRadians), sin(yawInRadians), 0, 0,
+                                      -sin(yawInRadians), cos(yawInRadians), 0, 0,
+                                      0, 0, 1, 0,
+                                      0, 0, 0, 1);
+
+        const glm::mat4 translateMatrix(1, 0, 0, 0,
+                                        0, 1, 0, 0,
+                                        0, 0, 1, 0,
+                                        position.x, position.y, position.z, 1);
+
+        return translateMatrix * rotateMatrixZ * rotateMatrixY * rotateMatrixX * scaleMatrix;
+    }
+
+    TransformComponent interpolateTransform(const TransformComponent &previous,
+                                            const TransformComponent &current,
+                                            const float alpha) {
+        TransformComponent transform;
+        transform.position = previous.position + (current.position - previous.position) * alpha;
+        transform.rotation = previous.rotation + (current.rotation - previous.rotation) * alpha;
+        transform.scale = previous.scale + (current.scale - previous.scale) * alpha;
+
+        return transform;
+    }
+}
@@ -1,8 +1,11 @@
 #include "game_engine_core/window.hpp"
 #include "game_engine_core/log.hpp"
+#include "game_engine_core/profiler.hpp"
 #include "game_engine_core/modules/UI_module.hpp"
 
 #include "game_engine_core/rendering/OpenGL/renderer_OpenGL.hpp"
+#include "game_engine_core/rendering/OpenGL/headless_context_EGL.hpp"
+#include "game_engine_core/rendering/render_thread.hpp"
 
 #include "GLFW/glfw3.h"
 
@@ -11,9 +14,11 @@
 #include "imgui/backends/imgui_impl_glfw.h"
 
 namespace game_engine {
-    Window::Window(std::string title, const unsigned int width, const unsigned int height)
-        : m_data{{std::move(title)}, width, height} {
-        int code = init();
+    Window::Window(std::string title, const unsigned int width, const unsigned int height,
+                   const WindowBackend backend)
+        : m_data{{std::move(title)}, width, height}, m_backend{backend} {
+        const int code = isHeadless() ? initHeadless() : init();
+        m_isInitialized = code == 0;
     }
 
     Window::~Window() {
@@ -21,14 +26,14 @@ namespace game_engine {
     }
 
     int Window::init() {
-        LOG_INFO("Creating window {0} with size {1}x{2}", m_data.title, m_data.width, m_data.height);
+        LOG_CATEGORY_INFO(Window, "Creating window {0} with size {1}x{2}", m_data.title, m_data.width, m_data.height);
 
         glfwSetErrorCallback([](int errorCode, const char *description) {
-            LOG_CRITICAL("GLFW error: {0}", description);
+            LOG_CATEGORY_CRITICAL(Window, "GLFW error: {0}", description);
         });
 
         if (!glfwInit()) {
-            LOG_CRITICAL("Can't initialize GLFW!");
+            LOG_CATEGORY_CRITICAL(Window, "Can't initialize GLFW!");
 
             return -1;
         }
@@ -37,17 +42,21 @@ namespace game_engine {
                                     nullptr, nullptr);
 
         if (!m_window) {
-            LOG_CRITICAL("Can't create window {0} with size {1}x{2}", m_data.title, m_data.width, m_data.height);
+            LOG_CATEGORY_CRITICAL(Window, "Can't create window {0} with size {1}x{2}", m_data.title, m_data.width, m_data.height);
 
             return -2;
         }
 
         if (!RendererOpenGL::init(m_window)) {
-            LOG_CRITICAL("Failed to initialize OpenGL renderer");
+            LOG_CATEGORY_CRITICAL(Window, "Failed to initialize OpenGL renderer");
 
             return -3;
         }
 
+        m_isAdaptiveVSyncSupported = glfwExtensionSupported("WGL_EXT_swap_control_tear") ||
+                                     glfwExtensionSupported("GLX_EXT_swap_control_tear");
+        setVSyncMode(m_vSyncMode);
+
         glfwSetWindowUserPointer(m_window, &m_data);
 
         glfwSetKeyCallback(m_window,
@@ -57,21 +66,21 @@ namespace game_engine {
             switch (action) {
                 case GLFW_PRESS: {
                     EventKeyPressed event{static_cast<KeyCode>(key), false};
-                    data.eventCallbackFunction(event);
+                    data.eventDispatcher->post(event);
 
                     break;
                 }
 
                 case GLFW_RELEASE: {
                     EventKeyReleased event(static_cast<KeyCode>(key));
-                    data.eventCallbackFunction(event);
+                    data.eventDispatcher->post(event);
 
                     break;
                 }
 
                 case GLFW_REPEAT: {
                     EventKeyPressed event(static_cast<KeyCode>(key), true);
-                    data.eventCallbackFunction(event);
+                    data.eventDispatcher->post(event);
                     break;
                 }
             }
@@ -89,14 +98,14 @@ namespace game_engine {
             switch (action) {
                 case GLFW_PRESS: {
                     EventMouseButtonPressed event(static_cast<MouseButton>(button), positionX, positionY);
-                    data.eventCallbackFunction(event);
+                    data.eventDispatcher->post(event);
 
                     break;
                 }
 
                 case GLFW_RELEASE: {
                     EventMouseButtonReleased event(static_cast<MouseButton>(button), positionX, positionY);
-                    data.eventCallbackFunction(event);
+                    data.eventDispatcher->post(event);
 
                     break;
                 }
@@ -109,26 +118,28 @@ namespace game_engine {
             data.height = height;
 
             EventWindowResize event{width, height};
-            data.eventCallbackFunction(event);
+            data.eventDispatcher->post(event);
         });
 
         glfwSetCursorPosCallback(m_window, [](GLFWwindow *window, double x, double y) {
             WindowData &data = *static_cast<WindowData*>(glfwGetWindowUserPointer(window));
 
             EventMouseMoved event{x, y};
-            data.eventCallbackFunction(event);
+            data.eventDispatcher->post(event);
         });
 
         glfwSetWindowCloseCallback(m_window, [](GLFWwindow *window) {
             WindowData &data = *static_cast<WindowData*>(glfwGetWindowUserPointer(window));
 
             EventWindowClose event;
-            data.eventCallbackFunction(event);
+            data.eventDispatcher->post(event);
         });
 
         glfwSetFramebufferSizeCallback(m_window,
                                        [](GLFWwindow *window, int width, int height) {
-            RendererOpenGL::setViewport(width, height);
+            RenderThread::enqueue([width, height]() {
+                RendererOpenGL::setViewport(width, height);
+            });
         });
 
         UIModule::onWindowCreate(m_window);
@@ -136,18 +147,146 @@ namespace game_engine {
         return 0;
     }
 
+    int Window::initHeadless() {
+        LOG_CATEGORY_INFO(Window, "Creating headless surface {0} with size {1}x{2}", m_data.title, m_data.width, m_data.height);
+
+        if (!HeadlessContextEGL::create()) {
+            LOG_CATEGORY_CRITICAL(Window, "Can't create headless EGL context");
+
+            return -1;
+        }
+
+        if (!RendererOpenGL::init(HeadlessContextEGL::getProcAddress)) {
+            LOG_CATEGORY_CRITICAL(Window, "Failed to initialize OpenGL renderer");
+
+            return -3;
+        }
+
+        UIModule::onHeadlessCreate(m_data.width, m_data.height);
+
+        return 0;
+    }
+
     void Window::shutdown() {
-        UIModule::onWindowClose();
+        if (m_isInitialized) {
+            UIModule::onWindowClose();
+        }
+
+        if (isHeadless()) {
+            HeadlessContextEGL::destroy();
+
+            return;
+        }
+
         glfwDestroyWindow(m_window);
         glfwTerminate();
     }
 
     void Window::onUpdate() {
+        PROFILE_SCOPE("Window::onUpdate");
+
+        swapBuffers();
+        pollEvents();
+    }
+
+    void Window::swapBuffers() {
+        PROFILE_SCOPE("Present");
+
+        if (isHeadless()) {
+            RendererOpenGL::finish();
+
+            return;
+        }
+
         glfwSwapBuffers(m_window);
+    }
+
+    void Window::pollEvents() {
+        PROFILE_SCOPE("Window::pollEvents");
+
+        if (isHeadless()) {
+            return;
+        }
+
         glfwPollEvents();
     }
 
+    void Window::waitEvents(const double timeout) {
+        if (isHeadless()) {
+            return;
+        }
+
+        glfwWaitEventsTimeout(timeout);
+    }
+
+    void Window::postEmptyEvent() {
+        if (isHeadless()) {
+            return;
+        }
+
+        glfwPostEmptyEvent();
+    }
+
+    void Window::makeContextCurrent() {
+        RenderThread::setContextThread();
+
+        if (isHeadless()) {
+            HeadlessContextEGL::makeCurrent();
+
+            return;
+        }
+
+        glfwMakeContextCurrent(m_window);
+    }
+
+    void Window::releaseContext() {
+        if (isHeadless()) {
+            HeadlessContextEGL::releaseCurrent();
+
+            return;
+        }
+
+        glfwMakeContextCurrent(nullptr);
+    }
+
+    void Window::setVSyncMode(const VSyncMode mode) {
+        m_vSyncMode = mode;
+
+        if (m_vSyncMode == VSyncMode::Adaptive && !m_isAdaptiveVSyncSupported) {
+            LOG_CATEGORY_WARNING(Window, "Adaptive vsync is not supported, falling back to vsync");
+
+            m_vSyncMode = VSyncMode::On;
+        }
+
+        if (isHeadless()) {
+            return;
+        }
+
+        int swapInterval = 0;
+        switch (m_vSyncMode) {
+            case VSyncMode::Off:
+                swapInterval = 0;
+                break;
+
+            case VSyncMode::On:
+                swapInterval = 1;
+                break;
+
+            case VSyncMode::Adaptive:
+                swapInterval = -1;
+                break;
+        }
+
+        RenderThread::enqueue([swapInterval]() {
+            glfwSwapInterval(swapInterval);
+        });
+    }
+
     glm::vec2 Window::getCurrentCursorPosition() const {
+        if (isHeadless()) {
+            return {0.0f, 0.0f};
+        }
+
         double positionX;
         double positionY;
 
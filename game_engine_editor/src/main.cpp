@@ -1,48 +1,66 @@
 #include <iostream>
 #include <memory>
+#include <cstring>
+#include <cstdlib>
 
 #include "game_engine_core/input.hpp"
+#include "game_engine_core/log.hpp"
+#include "game_engine_core/profiler.hpp"
 #include "game_engine_core/app.hpp"
+#include "game_engine_core/scene/components.hpp"
+#include "game_engine_core/ecs/entity_command_buffer.hpp"
 
 #include "imgui/imgui.h"
 #include "imgui/imgui_internal.h"
 
+constexpr const char *s_inputRecordingPath = "input_recording.bin";
+
 class GameEngineEditor : public game_engine::App {
     using KeyCode_t = game_engine::KeyCode;
     using Input_t = game_engine::Input;
 
 private:
+    static constexpr float s_cameraMovementSpeed = 3.0f;
+    static constexpr float s_cameraRotationSpeed = 0.6f;
+
     double m_initialMousePositionX = 0.0;
     double m_initialMousePositionY = 0.0;
 
-    virtual void onUpdate() override {
+    float m_targetFrameRate = 0.0f;
+    int m_profileCaptureFramesCount = 60;
+    bool m_isProfileCaptureExported = true;
+
+    virtual void onUpdate(const double deltaTime) override {
         glm::vec3 movementDelta{ 0, 0, 0 };
         glm::vec3 rotationDelta{ 0, 0, 0 };
 
+        const float movementStep = s_cameraMovementSpeed * static_cast<float>(deltaTime);
+        const float rotationStep = s_cameraRotationSpeed * static_cast<float>(deltaTime);
+
         if (Input_t::isKeyPressed(KeyCode_t::KEY_W)) {
-            movementDelta.x += 0.005f;
+            movementDelta.x += movementStep;
         } else if (Input_t::isKeyPressed(KeyCode_t::KEY_S)) {
-            movementDelta.x -= 0.005f;
+            movementDelta.x -= movementStep;
         } else if (Input_t::isKeyPressed(KeyCode_t::KEY_A)) {
-            movementDelta.y -= 0.005f;
+            movementDelta.y -= movementStep;
         } else if (Input_t::isKeyPressed(KeyCode_t::KEY_D)) {
-            movementDelta.y += 0.005f;
+            movementDelta.y += movementStep;
         } else if (Input_t::isKeyPressed(KeyCode_t::KEY_E)) {
-            movementDelta.z += 0.005f;
+            movementDelta.z += movementStep;
         } else if (Input_t::isKeyPressed(KeyCode_t::KEY_Q)) {
-            movementDelta.z -= 0.005f;
+            movementDelta.z -= movementStep;
         } else if (Input_t::isKeyPressed(KeyCode_t::KEY_UP)) {
-            rotationDelta.y -= 0.001f;
+            rotationDelta.y -= rotationStep;
         } else if (Input_t::isKeyPressed(KeyCode_t::KEY_DOWN)) {
-            rotationDelta.y += 0.001f;
+            rotationDelta.y += rotationStep;
         } else if (Input_t::isKeyPressed(KeyCode_t::KEY_RIGHT)) {
-            rotationDelta.z -= 0.001f;
+            rotationDelta.z -= rotationStep;
         } else if (Input_t::isKeyPressed(KeyCode_t::KEY_LEFT)) {
-            rotationDelta.z += 0.001f;
+            rotationDelta.z += rotationStep;
         } else if (Input_t::isKeyPressed(KeyCode_t::KEY_P)) {
-            rotationDelta.x += 0.001f;
+            rotationDelta.x += rotationStep;
         } else if (Input_t::isKeyPressed(KeyCode_t::KEY_O)) {
-            rotationDelta.x -= 0.001f;
+            rotationDelta.x -= rotationStep;
         }
 
         if (game_engine::Input::isMouseButtonPressed(game_engine::MouseButton::MOUSE_BUTTON_RIGHT)) {
@@ -114,6 +132,123 @@ private:
         m_initialMousePositionY = positionY;
     }
 
+    void drawSceneEditor() {
+        game_engine::EntityCommandBuffer commandBuffer;
+
+        ImGui::Text("Scene entities: %zu", scene.getEntitiesCount());
+
+        scene.each<game_engine::TransformComponent, game_engine::MeshComponent>(
+            [&commandBuffer](const game_engine::Entity entity,
+                             game_engine::TransformComponent &transform,
+                             const game_engine::MeshComponent &mesh) {
+                ImGui::PushID(static_cast<int>(entity.index));
+
+                if (ImGui::TreeNode("Entity", "Entity %u", entity.index)) {
+                    ImGui::DragFloat3("position", &transform.position.x, 0.1f);
+                    ImGui::DragFloat3("rotation", &transform.rotation.x, 1.0f, 0.0f, 360.0f);
+                    ImGui::DragFloat3("scale", &transform.scale.x, 0.05f, 0.01f, 100.0f);
+
+                    if (ImGui::Button("Duplicate")) {
+                        commandBuffer.createEntity(transform,
+                                                   game_engine::PreviousTransformComponent{transform},
+                                                   mesh);
+                    }
+                    ImGui::SameLine();
+                    if (ImGui::Button("Remove")) {
+                        commandBuffer.destroyEntity(entity);
+                    }
+
+                    ImGui::TreePop();
+                }
+
+                ImGui::PopID();
+            });
+
+        commandBuffer.execute(scene);
+    }
+
+    void drawLoggingSettings() {
+        const char *logLevels[] = { "Trace", "Info", "Warning", "Error", "Critical", "Off" };
+
+        for (size_t i = 0; i < static_cast<size_t>(game_engine::LogCategory::CategoriesCount); ++i) {
+            const auto category = static_cast<game_engine::LogCategory>(i);
+            int level = static_cast<int>(game_engine::Log::getLevel(category));
+
+            if (ImGui::Combo(game_engine::Log::getCategoryName(category), &level, logLevels,
+                             IM_ARRAYSIZE(logLevels))) {
+                game_engine::Log::setLevel(category, static_cast<game_engine::LogLevel>(level));
+            }
+        }
+
+        bool binaryLogging = game_engine::Log::isBinaryMode();
+        if (ImGui::Checkbox("Binary logging", &binaryLogging)) {
+            game_engine::Log::setBinaryMode(binaryLogging);
+        }
+
+        ImGui::Text("Log messages dropped / suppressed: %llu / %llu",
+                    static_cast<unsigned long long>(game_engine::Log::getDroppedMessagesCount()),
+                    static_cast<unsigned long long>(game_engine::Log::getSuppressedMessagesCount()));
+    }
+
+    void drawProfilerSettings() {
+        ImGui::SliderInt("Capture frames", &m_profileCaptureFramesCount, 1,
+                         static_cast<int>(game_engine::Profiler::s_maxCaptureFramesCount));
+
+        if (game_engine::Profiler::isCapturing()) {
+            ImGui::Text("Capturing...");
+        } else if (ImGui::Button("Capture profile")) {
+            m_isProfileCaptureExported = !game_engine::Profiler::captureFrames(
+                static_cast<size_t>(m_profileCaptureFramesCount));
+        }
+
+        if (game_engine::Profiler::hasCapture() && !m_isProfileCaptureExported) {
+            game_engine::Profiler::exportChromeTrace("profile_trace.json");
+            m_isProfileCaptureExported = true;
+        }
+
+        ImGui::Text("Captured frames / events: %zu / %zu",
+                    game_engine::Profiler::getCapturedFramesCount(),
+                    game_engine::Profiler::getCapturedEventsCount());
+        ImGui::Text("Dropped profile events: %llu",
+                    static_cast<unsigned long long>(game_engine::Profiler::getDroppedEventsCount()));
+    }
+
+    void drawInputRecordingSettings() {
+        switch (getInputRecordingMode()) {
+            case game_engine::InputRecordingMode::None:
+                if (ImGui::Button("Record input")) {
+                    startInputRecording();
+                }
+
+                ImGui::SameLine();
+
+                if (ImGui::Button("Replay input")) {
+                    startInputReplay(std::string{s_inputRecordingPath});
+                }
+
+                break;
+
+            case game_engine::InputRecordingMode::Recording:
+                ImGui::Text("Recording frames: %zu", getInputRecording().getFramesCount());
+
+                if (ImGui::Button("Stop recording")) {
+                    stopInputRecording(s_inputRecordingPath);
+                }
+
+                break;
+
+            case game_engine::InputRecordingMode::Replaying:
+                ImGui::Text("Replaying frame %zu / %zu", getInputReplayFrameIndex(),
+                            getInputRecording().getFramesCount());
+
+                if (ImGui::Button("Stop replay")) {
+                    stopInputReplay();
+                }
+
+                break;
+        }
+    }
+
     virtual void onUIDraw() override {
         setupDockspaceMenu();
         cameraPosition[0] = camera.getPosition().x;
@@ -157,14 +292,100 @@ private:
                                      game_engine::Camera::ProjectionMode::Orthographic);
         }
 
+        ImGui::Separator();
+
+        drawSceneEditor();
+
+        ImGui::Separator();
+
+        ImGui::Checkbox("Benchmark scene", &benchmarkScene);
+        const char *renderModeNames[] = { "Per object", "Instanced", "Multi-draw indirect",
+                                          "GPU culled", "CPU culled" };
+        const char *renderModes[IM_ARRAYSIZE(renderModeNames)];
+        game_engine::BenchmarkRenderMode supportedRenderModes[IM_ARRAYSIZE(renderModeNames)];
+        int renderModesCount = 0;
+        int renderMode = 0;
+        for (int i = 0; i < IM_ARRAYSIZE(renderModeNames); ++i) {
+            const auto mode = static_cast<game_engine::BenchmarkRenderMode>(i);
+
+            if (isBenchmarkRenderModeSupported(mode)) {
+                if (mode == benchmarkRenderMode) {
+                    renderMode = renderModesCount;
+                }
+
+                renderModes[renderModesCount] = renderModeNames[i];
+                supportedRenderModes[renderModesCount++] = mode;
+            }
+        }
+        if (ImGui::Combo("Render mode", &renderMode, renderModes, renderModesCount)) {
+            benchmarkRenderMode = supportedRenderModes[renderMode];
+        }
+        ImGui::SliderInt("Benchmark objects", &benchmarkObjectsCount, 1,
+                         s_benchmarkMaxObjectsCount);
+        ImGui::Text("Frame time: %.3f ms (%.1f FPS)", 1000.0f / ImGui::GetIO().Framerate,
+                    ImGui::GetIO().Framerate);
+
+        ImGui::Separator();
+
+        const game_engine::FrameTimeStats frameTimeStats = getFrameTimer().getFrameTimeStats();
+        ImGui::Text("Frame time p50 / p95 / p99: %.3f / %.3f / %.3f ms",
+                    frameTimeStats.percentile50Ms, frameTimeStats.percentile95Ms,
+                    frameTimeStats.percentile99Ms);
+        ImGui::Text("Frame time min / max: %.3f / %.3f ms",
+                    frameTimeStats.minimumMs, frameTimeStats.maximumMs);
+
+        if (ImGui::SliderFloat("Frame rate limit", &m_targetFrameRate, 0.0f, 240.0f, "%.0f")) {
+            getFrameLimiter().setTargetFrameRate(m_targetFrameRate);
+        }
+
+        const char *vSyncModes[] = { "Off", "On", "Adaptive" };
+        int vSyncMode = static_cast<int>(getVSyncMode());
+        if (ImGui::Combo("VSync", &vSyncMode, vSyncModes, IM_ARRAYSIZE(vSyncModes))) {
+            setVSyncMode(static_cast<game_engine::VSyncMode>(vSyncMode));
+        }
+
+        ImGui::Checkbox("Performance overlay", &showPerformanceOverlay);
+        ImGui::Checkbox("Idle rendering", &idleRendering);
+        ImGui::Text("Rendered / skipped frames: %llu / %llu",
+                    static_cast<unsigned long long>(getRenderedFramesCount()),
+                    static_cast<unsigned long long>(getSkippedFramesCount()));
+
+        ImGui::Separator();
+
+        drawLoggingSettings();
+
+        ImGui::Separator();
+
+        drawProfilerSettings();
+
+        ImGui::Separator();
+
+        drawInputRecordingSettings();
+
         ImGui::End();
     }
 };
 
-int main() {
+int main(int argc, char **argv) {
     auto gameEngineEditor = std::make_unique<GameEngineEditor>();
+    game_engine::WindowBackend windowBackend = game_engine::WindowBackend::Glfw;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--render-thread") == 0) {
+            gameEngineEditor->useRenderThread = true;
+        } else if (std::strcmp(argv[i], "--headless") == 0) {
+            windowBackend = game_engine::WindowBackend::HeadlessEGL;
+        } else if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            gameEngineEditor->maxFramesCount = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--replay") == 0) {
+            const char *recordingPath = i + 1 < argc && argv[i + 1][0] != '-' ?
+                                        argv[++i] : s_inputRecordingPath;
+
+            gameEngineEditor->startInputReplay(std::string{recordingPath});
+        }
+    }
 
-    int returnCode = gameEngineEditor->start(1800, 1000, "GameEngine Editor");
+    int returnCode = gameEngineEditor->start(1800, 1000, "GameEngine Editor", windowBackend);
 
     return returnCode;
 }
@@ -0,0 +1,313 @@
+#include "game_engine_core/rendering/texture_compression.hpp"
+#include "game_engine_core/rendering/texture_container.hpp"
+#include "game_engine_core/rendering/procedural_textures.hpp"
+#include "game_engine_core/rendering/procedural_image.hpp"
+#include "game_engine_core/jobs/job_system.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <chrono>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cctype>
+#include <cstdlib>
+#include <cstddef>
+
+namespace game_engine_tools {
+    using game_engine::ImageView;
+    using game_engine::TextureContainer;
+    using game_engine::TextureFormat;
+
+    constexpr unsigned int s_cookerDefaultSize = 256;
+    constexpr unsigned int s_cookerMaxSize = 16384;
+
+    struct CookerOptions {
+        std::string inputPath;
+        std::string outputPath;
+        std::string proceduralName;
+        unsigned int proceduralSize = s_cookerDefaultSize;
+        TextureFormat format = TextureFormat::BC7;
+        bool generateMipmaps = true;
+    };
+
+    struct CookerImage {
+        unsigned int width = 0;
+        unsigned int height = 0;
+        std::vector<unsigned char> pixels;
+
+        ImageView getView() { return ImageView{ pixels.data(), width, height, 4 }; }
+    };
+
+    void printCookerUsage() {
+        std::cout << "Usage: game_engine_texture_cooker (<input.ppm|input.pam> | "
+                     "--procedural smile|quads|noise [--size N])\n"
+                     "                                  --output <file.gtex> [--format NAME] "
+                     "[--no-mips]\n"
+                     "Formats:";
+
+        for (size_t i = 0; i < static_cast<size_t>(TextureFormat::FormatsCount); ++i) {
+            std::cout << " " << game_engine::getTextureFormatInfo(static_cast<TextureFormat>(i)).name;
+        }
+
+        std::cout << std::endl;
+    }
+
+    bool parseCookerOptions(const int argc, char **argv, CookerOptions &options) {
+        for (int i = 1; i < argc; ++i) {
+            const bool hasValue = i + 1 < argc;
+
+            if (std::strcmp(argv[i], "--output") == 0 && hasValue) {
+                options.outputPath = argv[++i];
+            } else if (std::strcmp(argv[i], "--procedural") == 0 && hasValue) {
+                options.proceduralName = argv[++i];
+            } else if (std::strcmp(argv[i], "--size") == 0 && hasValue) {
+                options.proceduralSize = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+            } else if (std::strcmp(argv[i], "--format") == 0 && hasValue) {
+                const char *formatName = argv[++i];
+
+                if (!game_engine::findTextureFormat(formatName, options.format)) {
+                    std::cerr << "Unknown texture format: " << formatName << std::endl;
+
+                    return false;
+                }
+            } else if (std::strcmp(argv[i], "--no-mips") == 0) {
+                options.generateMipmaps = false;
+            } else if (argv[i][0] != '-' && options.inputPath.empty()) {
+                options.inputPath = argv[i];
+            } else {
+                std::cerr << "Unknown argument: " << argv[i] << std::endl;
+
+                return false;
+            }
+        }
+
+        if (options.outputPath.empty() || options.inputPath.empty() == options.proceduralName.empty()) {
+            printCookerUsage();
+
+            return false;
+        }
+
+        return true;
+    }
+
+    bool readNetpbmToken(std::istream &stream, std::string &token) {
+        token.clear();
+
+        while (stream) {
+            const int character = stream.get();
+
+            if (character == '#') {
+                std::string comment;
+                std::getline(stream, comment);
+            } else if (character == EOF) {
+                break;
+            } else if (std::isspace(character)) {
+                if (!token.empty()) {
+                    break;
+                }
+            } else {
+                token.push_back(static_cast<char>(character));
+            }
+        }
+
+        return !token.empty();
+    }
+
+    bool readNetpbmHeader(std::istream &stream, const std::string &magic,
+                          unsigned int &width, unsigned int &height, unsigned int &channels) {
+        std::string token;
+        unsigned int maxValue = 0;
+
+        if (magic == "P6") {
+            channels = 3;
+
+            for (unsigned int *value : { &width, &height, &maxValue }) {
+                if (!readNetpbmToken(stream, token)) {
+                    return false;
+                }
+
+                *value = static_cast<unsigned int>(std::strtoul(token.c_str(), nullptr, 10));
+            }
+        } else {
+            channels = 0;
+
+            while (readNetpbmToken(stream, token) && token != "ENDHDR") {
+                std::string value;
+
+                if (token == "TUPLTYPE") {
+                    std::string tupleType;
+                    std::getline(stream, tupleType);
+
+                    continue;
+                }
+
+                if (!readNetpbmToken(stream, value)) {
+                    return false;
+                }
+
+                const unsigned int number = static_cast<unsigned int>(
+                    std::strtoul(value.c_str(), nullptr, 10));
+
+                if (token == "WIDTH") {
+                    width = number;
+                } else if (token == "HEIGHT") {
+                    height = number;
+                } else if (token == "DEPTH") {
+                    channels = number;
+                } else if (token == "MAXVAL") {
+                    maxValue = number;
+                }
+            }
+        }
+
+        return maxValue == 255 && channels >= 1 && channels <= 4 &&
+               width > 0 && height > 0 && width <= s_cookerMaxSize && height <= s_cookerMaxSize;
+    }
+
+    bool loadNetpbmImage(const std::string &path, CookerImage &image) {
+        std::ifstream file(path, std::ios::binary);
+        std::string magic;
+
+        if (!file || !readNetpbmToken(file, magic) || (magic != "P6" && magic != "P7")) {
+            std::cerr << "Can't read " << path << ": only binary PPM (P6) and PAM (P7) are supported"
+                      << std::endl;
+
+            return false;
+        }
+
+        unsigned int channels = 0;
+
+        if (!readNetpbmHeader(file, magic, image.width, image.height, channels)) {
+            std::cerr << "Can't read " << path << ": unsupported header" << std::endl;
+
+            return false;
+        }
+
+        std::vector<unsigned char> source(static_cast<size_t>(image.width) * image.height * channels);
+        file.read(reinterpret_cast<char*>(source.data()), static_cast<std::streamsize>(source.size()));
+
+        if (!file) {
+            std::cerr << "Can't read " << path << ": truncated pixel data" << std::endl;
+
+            return false;
+        }
+
+        const size_t pixelsCount = static_cast<size_t>(image.width) * image.height;
+        image.pixels.resize(pixelsCount * 4);
+
+        for (size_t i = 0; i < pixelsCount; ++i) {
+            const unsigned char *pixel = source.data() + i * channels;
+            unsigned char *destination = image.pixels.data() + i * 4;
+
+            destination[0] = pixel[0];
+            destination[1] = channels >= 3 ? pixel[1] : pixel[0];
+            destination[2] = channels >= 3 ? pixel[2] : pixel[0];
+            destination[3] = channels == 4 ? pixel[3] : (channels == 2 ? pixel[1] : 255);
+        }
+
+        return true;
+    }
+
+    bool generateCookerImage(const CookerOptions &options, CookerImage &image) {
+        if (options.proceduralSize == 0 || options.proceduralSize > s_cookerMaxSize) {
+            std::cerr << "Procedural size must be in [1, " << s_cookerMaxSize << "]" << std::endl;
+
+            return false;
+        }
+
+        image.width = options.proceduralSize;
+        image.height = options.proceduralSize;
+        image.pixels.assign(static_cast<size_t>(image.width) * image.height * 4, 0);
+
+        if (options.proceduralName == "noise") {
+            game_engine::ProceduralImage proceduralImage;
+            proceduralImage.addNoise(std::max(image.width / 8, 1u), 5, 1337,
+                                     game_engine::ImageColor{ 20, 40, 90, 255 },
+                                     game_engine::ImageColor{ 230, 200, 120, 255 });
+
+            return proceduralImage.generate(image.getView());
+        }
+
+        std::vector<unsigned char> rgbPixels(static_cast<size_t>(image.width) * image.height * 3);
+        const ImageView rgbView{ rgbPixels.data(), image.width, image.height, 3 };
+        bool isGenerated = false;
+
+        if (options.proceduralName == "smile") {
+            isGenerated = game_engine::generateSmileTexture(rgbView);
+        } else if (options.proceduralName == "quads") {
+            isGenerated = game_engine::generateQuadsTexture(rgbView);
+        } else {
+            std::cerr << "Unknown procedural texture: " << options.proceduralName << std::endl;
+
+            return false;
+        }
+
+        for (size_t i = 0; i < rgbPixels.size() / 3; ++i) {
+            std::memcpy(image.pixels.data() + i * 4, rgbPixels.data() + i * 3, 3);
+            image.pixels[i * 4 + 3] = 255;
+        }
+
+        return isGenerated;
+    }
+
+    int runTextureCooker(const int argc, char **argv) {
+        CookerOptions options;
+
+        if (!parseCookerOptions(argc, argv, options)) {
+            return 2;
+        }
+
+        game_engine::JobSystem::initialize();
+
+        CookerImage image;
+        const bool isImageReady = options.proceduralName.empty() ?
+                                  loadNetpbmImage(options.inputPath, image) :
+                                  generateCookerImage(options, image);
+
+        if (!isImageReady) {
+            game_engine::JobSystem::shutdown();
+
+            return 2;
+        }
+
+        const auto cookBegin = std::chrono::steady_clock::now();
+
+        TextureContainer container;
+        const bool isCooked = game_engine::cookTexture(image.getView(), options.format,
+                                                       options.generateMipmaps, container);
+
+        const double cookMs = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - cookBegin).count();
+
+        game_engine::JobSystem::shutdown();
+
+        if (!isCooked || !container.save(options.outputPath)) {
+            std::cerr << "Can't cook " << options.outputPath << std::endl;
+
+            return 2;
+        }
+
+        const size_t sourceSize = game_engine::calculateTextureMemorySize(
+            TextureFormat::RGBA8, container.getWidth(), container.getHeight(),
+            static_cast<unsigned int>(container.getLevelsCount()));
+
+        std::cout << options.outputPath << ": " << container.getWidth() << "x"
+                  << container.getHeight() << " "
+                  << game_engine::getTextureFormatInfo(container.getFormat()).name << ", "
+                  << container.getLevelsCount() << " levels" << std::endl;
+        std::cout << std::fixed << std::setprecision(2)
+                  << "RGBA8 " << sourceSize / 1024.0 << " KiB -> "
+                  << container.getDataSize() / 1024.0 << " KiB (ratio "
+                  << static_cast<double>(sourceSize) / static_cast<double>(container.getDataSize())
+                  << ":1), cooked in " << cookMs << " ms" << std::endl;
+
+        return 0;
+    }
+}
+
+int main(int argc, char **argv) {
+    return game_engine_tools::runTextureCooker(argc, argv);
+}